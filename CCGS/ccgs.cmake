@@ -22,5 +22,7 @@ IF (BUILD_TESTING)
   ADD_EXECUTABLE(CellML2C CCGS/tests/CellML2C.cpp)
   TARGET_LINK_LIBRARIES(CellML2C cellml ccgs cuses cevas malaes annotools)
   ADD_TEST(CheckCodeGenerator ${BASH} ${CMAKE_CURRENT_SOURCE_DIR}/tests/RetryWrapper ${CMAKE_CURRENT_SOURCE_DIR}/tests/CheckCodeGenerator)
+  ADD_EXECUTABLE(TimeCodeGeneration CCGS/tests/TimeCodeGeneration.cpp)
+  TARGET_LINK_LIBRARIES(TimeCodeGeneration cellml ccgs cuses cevas malaes annotools)
   DECLARE_TEST_LIB(ccgs)
 ENDIF()
@@ -1,3 +1,5 @@
+#ifndef _CCGSBootstrap_hpp
+#define _CCGSBootstrap_hpp
 #include "cda_compiler_support.h"
 #ifdef IN_CCGS_MODULE
 #define CCGS_PUBLIC_PRE CDA_EXPORT_PRE
@@ -16,3 +18,26 @@ CCGS_PUBLIC_PRE
   already_AddRefd<iface::cellml_services::CodeGeneratorBootstrap>
   CreateCodeGeneratorBootstrap(void)
 CCGS_PUBLIC_POST;
+
+/**
+ * Receives notification as code generators enter and leave each phase of
+ * code generation, so tools can profile them. Phases don't nest; anything one
+ * phase does on behalf of another is counted in the outer one.
+ */
+class CCGSPhaseObserver
+{
+public:
+  virtual ~CCGSPhaseObserver() {}
+  virtual void phaseStarted(const char* aPhase) = 0;
+  virtual void phaseFinished(const char* aPhase) = 0;
+};
+
+/**
+ * Sets the phase observer (or NULL for none) for code generation done on the
+ * calling thread. Code generators running on other threads are unaffected.
+ */
+CCGS_PUBLIC_PRE
+  void SetCCGSPhaseObserver(CCGSPhaseObserver* aObserver)
+CCGS_PUBLIC_POST;
+
+#endif // _CCGSBootstrap_hpp
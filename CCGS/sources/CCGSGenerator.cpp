@@ -3,6 +3,7 @@
 #include <map>
 #include <set>
 #include <iterator>
+#include <algorithm>
 #include <cmath>
 #include "CodeGenerationState.hxx"
 #include <stdio.h>
@@ -16,7 +17,9 @@
 #include "RDFBootstrap.hpp"
 #endif
 
-// Asymptotic complexity is bound around O(n^(((t^2)+t)/2)) for t=SEARCH_DEPTH. This is a pretty poor upper bound.
+// How many equations FindBigSystem tries removing at once, for systems which
+// can't be split by matching. Asymptotic complexity is bound around
+// O(n^(((t^2)+t)/2)) for t=SEARCH_DEPTH. This is a pretty poor upper bound.
 #define SEARCH_DEPTH 3
 #define MATHML_NS L"http://www.w3.org/1998/Math/MathML"
 
@@ -717,13 +720,15 @@ CodeGenerationState::GenerateStateInformation(std::wstring& aStr)
     {
       wchar_t id[32];
       any_swprintf(id, 32, L"%lu", ct->mAssignedIndex);
+      std::wstring idStr(id), empty;
+      const std::wstring* values[] = { &idStr, &empty, &empty };
       if (ct->mEvaluationType == iface::cellml_services::STATE_VARIABLE)
       {
-        aStr += ReplaceIDs(mConstrainedRateStateInfoPattern, id, L"", L"");
+        mTemplates.mConstrainedRateStateInfo.Expand(aStr, values);
       }
       else if (ct->mEvaluationType == iface::cellml_services::PSEUDOSTATE_VARIABLE)
       {
-        aStr += ReplaceIDs(mUnconstrainedRateStateInfoPattern, id, L"", L"");
+        mTemplates.mUnconstrainedRateStateInfo.Expand(aStr, values);
       }
     }
   }
@@ -906,6 +911,8 @@ CodeGenerationState::ODESolverStyleCodeGeneration()
   GenerateStateToRateCascades();
   
   GenerateInfDelayUpdates();
+
+  ComputeRateDependencies(sysByTargReq);
 }
 
 bool
@@ -1144,46 +1151,10 @@ CodeGenerationState::GenerateResidualForString
 {
   wchar_t residNo[30];
   any_swprintf(residNo, 30, L"%lu", aResidNo);
+  std::wstring residNoStr(residNo);
 
-  size_t curIdx = 0;
-
-  while (true)
-  {
-    size_t lIdx = mResidualPattern.find(L"<LHS>", curIdx),
-      rIdx = mResidualPattern.find(L"<RHS>", curIdx),
-      rnIdx = mResidualPattern.find(L"<RNO>", curIdx),
-      iIdx = mResidualPattern.find(L"<XMLID>", curIdx);
-    if ((lIdx == rIdx) && (lIdx == rnIdx) && (lIdx == iIdx) &&
-        (lIdx == std::string::npos))
-    {
-      aAppendTo += mResidualPattern.substr(curIdx);
-      return;
-    }
-    if (lIdx <= rIdx && lIdx <= rnIdx && lIdx <= iIdx)
-    {
-      aAppendTo += mResidualPattern.substr(curIdx, lIdx - curIdx);
-      aAppendTo += aLHS;
-      curIdx = lIdx + sizeof("<LHS>") - 1;
-    }
-    else if (rIdx <= rnIdx && rIdx <= iIdx)
-    {
-      aAppendTo += mResidualPattern.substr(curIdx, rIdx - curIdx);
-      aAppendTo += aRHS;
-      curIdx = rIdx + sizeof("<RHS>") - 1;
-    }
-    else if (rnIdx <= iIdx)
-    {
-      aAppendTo += mResidualPattern.substr(curIdx, rnIdx - curIdx);
-      aAppendTo += residNo;
-      curIdx = rnIdx + sizeof("<RNO>") - 1;
-    }
-    else
-    {
-      aAppendTo += mResidualPattern.substr(curIdx, iIdx - curIdx);
-      aAppendTo += aXmlId;
-      curIdx = iIdx + sizeof("<XMLID>") - 1;
-    }
-  }
+  const std::wstring* values[] = { &aLHS, &aRHS, &residNoStr, &aXmlId };
+  mTemplates.mResidual.Expand(aAppendTo, values);
 }
 
 void
@@ -1571,6 +1542,7 @@ CodeGenerationState::GetTargetOfDegree(ptr_tag<CDA_ComputationTarget> aBase,
 void
 CodeGenerationState::CreateBaseComputationTargets()
 {
+  CodeGenerationPhase phase(mCurrentPhase, "CreateBaseComputationTargets");
   uint32_t i, l = mCeVAS->length();
 
   for (i = 0; i < l; i++)
@@ -1728,6 +1700,7 @@ CodeGenerationState::ContextError
 void
 CodeGenerationState::CreateMathStatements()
 {
+  CodeGenerationPhase phase(mCurrentPhase, "CreateMathStatements");
   RETURN_INTO_OBJREF(cci, iface::cellml_api::CellMLComponentIterator,
                      mCeVAS->iterateRelevantComponents());
 
@@ -2074,6 +2047,7 @@ CodeGenerationState::SetupMathMLMathStatement
 void
 CodeGenerationState::FirstPassTargetClassification()
 {
+  CodeGenerationPhase phase(mCurrentPhase, "FirstPassTargetClassification");
   std::list<ptr_tag<CDA_ComputationTarget> >::iterator i;
   for (i =  mBaseTargets.begin();
        i != mBaseTargets.end();
@@ -2462,37 +2436,8 @@ CodeGenerationState::AppendAssign
  const std::wstring& aXmlID
 )
 {
-  size_t curIdx = 0;
-
-  while (true)
-  {
-    size_t lIdx = mAssignPattern.find(L"<LHS>", curIdx),
-      rIdx = mAssignPattern.find(L"<RHS>", curIdx),
-      iIdx = mAssignPattern.find(L"<XMLID>", curIdx);
-    if ((lIdx == rIdx) && (lIdx == iIdx) && (lIdx == std::string::npos))
-    {
-      aAppendTo += mAssignPattern.substr(curIdx);
-      return;
-    }
-    if (lIdx <= rIdx && lIdx <= iIdx)
-    {
-      aAppendTo += mAssignPattern.substr(curIdx, lIdx - curIdx);
-      aAppendTo += aLHS;
-      curIdx = lIdx + sizeof("<LHS>") - 1;
-    }
-    else if (rIdx <= iIdx)
-    {
-      aAppendTo += mAssignPattern.substr(curIdx, rIdx - curIdx);
-      aAppendTo += aRHS;
-      curIdx = rIdx + sizeof("<RHS>") - 1;
-    }
-    else
-    {
-      aAppendTo += mAssignPattern.substr(curIdx, iIdx - curIdx);
-      aAppendTo += aXmlID;
-      curIdx = iIdx + sizeof("<XMLID>") - 1;
-    }
-  }
+  const std::wstring* values[] = { &aLHS, &aRHS, &aXmlID };
+  mTemplates.mAssign.Expand(aAppendTo, values);
 }
 
 void
@@ -2504,37 +2449,8 @@ CodeGenerationState::AppendConstantAssign
  const std::wstring& aXmlID
 )
 {
-  size_t curIdx = 0;
-
-  while (true)
-  {
-    size_t lIdx = mAssignConstantPattern.find(L"<LHS>", curIdx),
-      rIdx = mAssignConstantPattern.find(L"<RHS>", curIdx),
-      iIdx = mAssignConstantPattern.find(L"<XMLID>", curIdx);
-    if ((lIdx == rIdx) && (lIdx == iIdx) && (lIdx == std::string::npos))
-    {
-      aAppendTo += mAssignConstantPattern.substr(curIdx);
-      return;
-    }
-    if (lIdx <= rIdx && lIdx <= iIdx)
-    {
-      aAppendTo += mAssignConstantPattern.substr(curIdx, lIdx - curIdx);
-      aAppendTo += aLHS;
-      curIdx = lIdx + sizeof("<LHS>") - 1;
-    }
-    else if (rIdx <= iIdx)
-    {
-      aAppendTo += mAssignConstantPattern.substr(curIdx, rIdx - curIdx);
-      aAppendTo += aRHS;
-      curIdx = rIdx + sizeof("<RHS>") - 1;
-    }
-    else
-    {
-      aAppendTo += mAssignConstantPattern.substr(curIdx, iIdx - curIdx);
-      aAppendTo += aXmlID;
-      curIdx = iIdx + sizeof("<XMLID>") - 1;
-    }
-  }
+  const std::wstring* values[] = { &aLHS, &aRHS, &aXmlID };
+  mTemplates.mAssignConstant.Expand(aAppendTo, values);
 }
 
 
@@ -2623,6 +2539,7 @@ CodeGenerationState::DecomposeIntoAssignments
  std::list<System*>& aSystems
 )
 {
+  CodeGenerationPhase phase(mCurrentPhase, "DecomposeIntoSystems");
   std::set<ptr_tag<CDA_ComputationTarget> > start(aStart);
 
   bool progress = true;
@@ -2758,6 +2675,371 @@ CodeGenerationState::DecomposeIntoAssignments
   }
 }
 
+// Marks a slot or unknown which hasn't been matched, or a statement which
+// hasn't been visited.
+static const uint32_t NO_MATCH = 0xFFFFFFFF;
+
+// A maximum matching between the unknowns of a set of math statements and the
+// degrees of freedom ('slots') those statements provide, found with the
+// Hopcroft-Karp algorithm in O(E sqrt(V)).
+class SlotMatching
+{
+public:
+  SlotMatching(const std::vector<std::vector<uint32_t> >& aSlotVars,
+               uint32_t aVarCount)
+    : mSlotVars(aSlotVars), mSlotMatch(aSlotVars.size(), NO_MATCH),
+      mVarMatch(aVarCount, NO_MATCH), mLayer(aSlotVars.size())
+  {
+    while (LayerFreeSlots())
+      for (uint32_t s = 0; s < mSlotVars.size(); s++)
+        if (mSlotMatch[s] == NO_MATCH)
+          Augment(s);
+  }
+
+  const std::vector<std::vector<uint32_t> >& mSlotVars;
+  std::vector<uint32_t> mSlotMatch, mVarMatch;
+
+private:
+  // Breadth-first search from the free slots along alternating paths. Returns
+  // true if there is an augmenting path.
+  bool LayerFreeSlots()
+  {
+    std::vector<uint32_t> queue;
+    for (uint32_t s = 0; s < mSlotVars.size(); s++)
+      if (mSlotMatch[s] == NO_MATCH)
+      {
+        mLayer[s] = 0;
+        queue.push_back(s);
+      }
+      else
+        mLayer[s] = NO_MATCH;
+
+    bool found = false;
+    for (uint32_t qi = 0; qi < queue.size(); qi++)
+    {
+      uint32_t s = queue[qi];
+      const std::vector<uint32_t>& vars = mSlotVars[s];
+      for (std::vector<uint32_t>::const_iterator v = vars.begin();
+           v != vars.end(); v++)
+      {
+        uint32_t next = mVarMatch[*v];
+        if (next == NO_MATCH)
+          found = true;
+        else if (mLayer[next] == NO_MATCH)
+        {
+          mLayer[next] = mLayer[s] + 1;
+          queue.push_back(next);
+        }
+      }
+    }
+    return found;
+  }
+
+  // Depth-first search along the layers for an augmenting path starting at
+  // aSlot, flipping the matching along it if one is found. This keeps its own
+  // stack so that long alternating paths can't overflow the real one.
+  bool Augment(uint32_t aSlot)
+  {
+    // The slots on the path, and how many of their unknowns have been tried.
+    std::vector<std::pair<uint32_t, uint32_t> > path;
+    path.push_back(std::pair<uint32_t, uint32_t>(aSlot, 0));
+    while (!path.empty())
+    {
+      uint32_t slot = path.back().first;
+      const std::vector<uint32_t>& vars = mSlotVars[slot];
+      if (path.back().second == vars.size())
+      {
+        // Dead end; don't look here again in this phase.
+        mLayer[slot] = NO_MATCH;
+        path.pop_back();
+        continue;
+      }
+
+      uint32_t var = vars[path.back().second++];
+      uint32_t next = mVarMatch[var];
+      if (next == NO_MATCH)
+      {
+        // Each slot on the path takes the unknown it was last trying.
+        for (std::vector<std::pair<uint32_t, uint32_t> >::iterator p =
+               path.begin(); p != path.end(); p++)
+        {
+          uint32_t v = mSlotVars[(*p).first][(*p).second - 1];
+          mSlotMatch[(*p).first] = v;
+          mVarMatch[v] = (*p).first;
+        }
+        return true;
+      }
+      if (mLayer[next] == mLayer[slot] + 1)
+        path.push_back(std::pair<uint32_t, uint32_t>(next, 0));
+    }
+    return false;
+  }
+
+  std::vector<uint32_t> mLayer;
+};
+
+/*
+ * The block lower triangular form of the math statements still to be put into
+ * systems. Each unknown is matched to a statement to compute it, and the
+ * strongly connected components of the resulting 'needs a value computed by'
+ * graph between the statements are the smallest systems which can be solved
+ * one after another.
+ */
+class BlockTriangularForm
+{
+public:
+  void Build(std::set<ptr_tag<MathStatement> >& aMathStatements,
+             std::set<ptr_tag<CDA_ComputationTarget> >& aVars,
+             std::set<ptr_tag<CDA_ComputationTarget> >& aStart);
+  void SolvableOrder(std::vector<uint32_t>& aOrder);
+
+  // The statements in each component, in ptr_tag order.
+  std::vector<std::vector<ptr_tag<MathStatement> > > mComponents;
+  // The other components each component needs values from.
+  std::vector<std::vector<uint32_t> > mNeeds;
+  // A component is blocked if it can never be solved on its own: it needs an
+  // unknown that no statement is matched to, has a degree of freedom that no
+  // unknown is matched to, mixes sampling from a distribution with other
+  // statements, or needs a blocked component.
+  std::vector<bool> mBlocked;
+  // Statements with a degree of freedom left over once all their unknowns are
+  // computed, other than samples (whose outputs might be known already).
+  std::set<ptr_tag<MathStatement> > mOverdetermined;
+};
+
+void
+BlockTriangularForm::Build
+(
+ std::set<ptr_tag<MathStatement> >& aMathStatements,
+ std::set<ptr_tag<CDA_ComputationTarget> >& aVars,
+ std::set<ptr_tag<CDA_ComputationTarget> >& aStart
+)
+{
+  mComponents.clear();
+  mNeeds.clear();
+  mBlocked.clear();
+  mOverdetermined.clear();
+
+  std::vector<ptr_tag<CDA_ComputationTarget> > vars(aVars.begin(), aVars.end());
+  std::map<ptr_tag<CDA_ComputationTarget>, uint32_t> varIndex;
+  for (uint32_t v = 0; v < vars.size(); v++)
+    varIndex.insert(std::pair<ptr_tag<CDA_ComputationTarget>, uint32_t>
+                    (vars[v], v));
+
+  std::vector<ptr_tag<MathStatement> > stmts(aMathStatements.begin(),
+                                             aMathStatements.end());
+  // The unknowns each statement involves, and each slot can compute.
+  std::vector<std::vector<uint32_t> > stmtVars(stmts.size()), slotVars;
+  std::vector<uint32_t> slotStmt;
+  uint32_t s;
+  for (s = 0; s < stmts.size(); s++)
+  {
+    MathStatement* ms = stmts[s];
+    SampleFromDistribution* sfd = NULL;
+    if (ms->mType == MathStatement::SAMPLE_FROM_DIST)
+      sfd = static_cast<SampleFromDistribution*>(ms);
+
+    std::vector<uint32_t> computable;
+    for (std::list<ptr_tag<CDA_ComputationTarget> >::iterator k =
+           ms->mTargets.begin(); k != ms->mTargets.end(); k++)
+    {
+      if (aStart.count(*k))
+        continue;
+      std::map<ptr_tag<CDA_ComputationTarget>, uint32_t>::iterator vi =
+        varIndex.find(*k);
+      assert(vi != varIndex.end());
+      stmtVars[s].push_back((*vi).second);
+      // A sample only computes its outputs; its other unknowns are inputs.
+      if (sfd == NULL || sfd->mOutSet.count(*k))
+        computable.push_back((*vi).second);
+    }
+
+    for (uint32_t d = ms->degFreedom(); d > 0; d--)
+    {
+      slotVars.push_back(computable);
+      slotStmt.push_back(s);
+    }
+  }
+
+  SlotMatching matching(slotVars, vars.size());
+
+  std::vector<bool> blocked(stmts.size(), false);
+  for (uint32_t k = 0; k < slotVars.size(); k++)
+    if (matching.mSlotMatch[k] == NO_MATCH)
+    {
+      blocked[slotStmt[k]] = true;
+      if (stmts[slotStmt[k]]->mType != MathStatement::SAMPLE_FROM_DIST)
+        mOverdetermined.insert(stmts[slotStmt[k]]);
+    }
+
+  std::vector<std::vector<uint32_t> > needs(stmts.size());
+  for (s = 0; s < stmts.size(); s++)
+    for (std::vector<uint32_t>::iterator vi = stmtVars[s].begin();
+         vi != stmtVars[s].end(); vi++)
+    {
+      uint32_t slot = matching.mVarMatch[*vi];
+      if (slot == NO_MATCH)
+        blocked[s] = true;
+      else if (slotStmt[slot] != s)
+        needs[s].push_back(slotStmt[slot]);
+    }
+
+  // Tarjan's strongly connected components, without recursion so that long
+  // chains of equations can't overflow the stack. Each component is produced
+  // after every component it needs.
+  std::vector<uint32_t> index(stmts.size(), NO_MATCH), lowLink(stmts.size()),
+    componentOf(stmts.size());
+  std::vector<bool> onStack(stmts.size(), false);
+  std::vector<uint32_t> sccStack;
+  std::vector<std::pair<uint32_t, uint32_t> > callStack;
+  uint32_t nextIndex = 0;
+
+  for (uint32_t root = 0; root < stmts.size(); root++)
+  {
+    if (index[root] != NO_MATCH)
+      continue;
+
+    callStack.push_back(std::pair<uint32_t, uint32_t>(root, 0));
+    while (!callStack.empty())
+    {
+      s = callStack.back().first;
+      uint32_t& edge = callStack.back().second;
+      if (index[s] == NO_MATCH)
+      {
+        index[s] = lowLink[s] = nextIndex++;
+        sccStack.push_back(s);
+        onStack[s] = true;
+      }
+
+      if (edge < needs[s].size())
+      {
+        uint32_t t = needs[s][edge++];
+        if (index[t] == NO_MATCH)
+          callStack.push_back(std::pair<uint32_t, uint32_t>(t, 0));
+        else if (onStack[t] && index[t] < lowLink[s])
+          lowLink[s] = index[t];
+        continue;
+      }
+
+      callStack.pop_back();
+      if (!callStack.empty())
+      {
+        uint32_t parent = callStack.back().first;
+        if (lowLink[s] < lowLink[parent])
+          lowLink[parent] = lowLink[s];
+      }
+      if (lowLink[s] != index[s])
+        continue;
+
+      std::vector<uint32_t> component;
+      uint32_t member;
+      do
+      {
+        member = sccStack.back();
+        sccStack.pop_back();
+        onStack[member] = false;
+        component.push_back(member);
+      }
+      while (member != s);
+      std::sort(component.begin(), component.end());
+
+      uint32_t c = mComponents.size();
+      mComponents.push_back(std::vector<ptr_tag<MathStatement> >());
+      mNeeds.push_back(std::vector<uint32_t>());
+      bool componentBlocked = false;
+      std::vector<uint32_t>::iterator ci;
+      for (ci = component.begin(); ci != component.end(); ci++)
+        componentOf[*ci] = c;
+      for (ci = component.begin(); ci != component.end(); ci++)
+      {
+        mComponents[c].push_back(stmts[*ci]);
+        if (blocked[*ci])
+          componentBlocked = true;
+        for (std::vector<uint32_t>::iterator ni = needs[*ci].begin();
+             ni != needs[*ci].end(); ni++)
+        {
+          if (componentOf[*ni] == c)
+            continue;
+          mNeeds[c].push_back(componentOf[*ni]);
+          if (mBlocked[componentOf[*ni]])
+            componentBlocked = true;
+        }
+        // Sampling cannot be part of a set of simultaneous equations.
+        if (component.size() > 1 &&
+            stmts[*ci]->mType == MathStatement::SAMPLE_FROM_DIST)
+          componentBlocked = true;
+      }
+      mBlocked.push_back(componentBlocked);
+    }
+  }
+}
+
+// Orders components with fewer statements first, and then the one whose
+// statements come first, so that the systems come out in the order a search
+// for the smallest square subsystem would find them.
+class SmallerComponent
+{
+public:
+  SmallerComponent(const std::vector<std::vector<ptr_tag<MathStatement> > >&
+                   aComponents)
+    : mComponents(aComponents) {}
+
+  bool operator()(uint32_t aA, uint32_t aB) const
+  {
+    const std::vector<ptr_tag<MathStatement> >& a = mComponents[aA];
+    const std::vector<ptr_tag<MathStatement> >& b = mComponents[aB];
+    if (a.size() != b.size())
+      return a.size() < b.size();
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+  }
+
+private:
+  const std::vector<std::vector<ptr_tag<MathStatement> > >& mComponents;
+};
+
+/*
+ * Puts every component which isn't blocked into aOrder, each after all the
+ * components it needs. This is a topological sort of the whole form in one
+ * pass; of the components whose inputs are all known at each step, the
+ * smallest goes next.
+ */
+void
+BlockTriangularForm::SolvableOrder(std::vector<uint32_t>& aOrder)
+{
+  aOrder.clear();
+  std::vector<uint32_t> waitingOn(mComponents.size(), 0);
+  std::vector<std::vector<uint32_t> > neededBy(mComponents.size());
+  uint32_t c;
+  for (c = 0; c < mComponents.size(); c++)
+  {
+    // Nothing unblocked needs a blocked component, so they can be left out.
+    if (mBlocked[c])
+      continue;
+    for (std::vector<uint32_t>::iterator i = mNeeds[c].begin();
+         i != mNeeds[c].end(); i++)
+    {
+      waitingOn[c]++;
+      neededBy[*i].push_back(c);
+    }
+  }
+
+  std::set<uint32_t, SmallerComponent> ready((SmallerComponent(mComponents)));
+  for (c = 0; c < mComponents.size(); c++)
+    if (!mBlocked[c] && waitingOn[c] == 0)
+      ready.insert(c);
+
+  while (!ready.empty())
+  {
+    c = *ready.begin();
+    ready.erase(ready.begin());
+    aOrder.push_back(c);
+    for (std::vector<uint32_t>::iterator i = neededBy[c].begin();
+         i != neededBy[c].end(); i++)
+      if (--waitingOn[*i] == 0)
+        ready.insert(*i);
+  }
+}
+
 bool
 CodeGenerationState::DecomposeIntoSystems
 (
@@ -2768,6 +3050,7 @@ CodeGenerationState::DecomposeIntoSystems
  bool aIgnoreInfdelayed
 )
 {
+  CodeGenerationPhase phase(mCurrentPhase, "DecomposeIntoSystems");
   std::set<ptr_tag<CDA_ComputationTarget> > start(aStart);
 
   while (true)
@@ -2904,11 +3187,31 @@ CodeGenerationState::DecomposeIntoSystems
       (*j).second.first.insert(*i);
     }
 
-    bool progress = false;
-
     // We now have a set of disjoint sets of variables (i.e. there are no
     // equations which have not yet been used linking variables in different
-    // disjoint sets), and the equations linking them.
+    // disjoint sets), and the equations linking them. Everything that can be
+    // split up by matching comes out of one decomposition of all of them,
+    // in an order it can be solved in.
+    BlockTriangularForm form;
+    {
+      std::set<ptr_tag<MathStatement> > allStatements;
+      std::set<ptr_tag<CDA_ComputationTarget> > allVars;
+      for (MapMathStatCTSetPairByCT::iterator i(targets.begin());
+           i != targets.end();
+           i++)
+      {
+        allStatements.insert((*i).second.first.begin(), (*i).second.first.end());
+        allVars.insert((*i).second.second.begin(), (*i).second.second.end());
+      }
+      form.Build(allStatements, allVars, start);
+    }
+
+    // Go round again after solving those, because they might have left a
+    // statement with nothing to compute, which is overconstrained.
+    if (FindBlockTriangularSystems(form, start, aCandidates, aSystems))
+      continue;
+
+    bool progress = false;
     for (MapMathStatCTSetPairByCT::iterator i(targets.begin());
          i != targets.end();
          i++)
@@ -2916,62 +3219,34 @@ CodeGenerationState::DecomposeIntoSystems
       if ((*i).second.first.empty())
         continue;
 
-      if (FindSmallSystem((*i).second.first, (*i).second.second, start,
-                          aCandidates, aSystems))
+      // If nothing in the set could be solved because a statement in it has
+      // more degrees of freedom than unknowns, the model is overconstrained.
+      for (std::set<ptr_tag<MathStatement> >::iterator j =
+             (*i).second.first.begin(); j != (*i).second.first.end(); j++)
       {
-        progress = true;
-        continue;
+        if (form.mOverdetermined.count(*j) == 0)
+          continue;
+
+        MathStatement* ms = *j;
+        if (ms->mType == MathStatement::INITIAL_ASSIGNMENT)
+          throw OverconstrainedError(NULL);
+        else
+          throw OverconstrainedError(static_cast<MathMLMathStatement*>(ms)->mMaths);
       }
 
-      // We failed to find a small system. Instead, start off with everything
-      // in one system and start taking stuff out...
+      // No part of the set could be matched up. Instead, start off with
+      // everything in one system and start taking stuff out...
       bool error = FindBigSystem((*i).second.first, (*i).second.second, start, aCandidates,
                                  aSystems);
-
       progress |= (!error);
     }
 
     if (!progress)
       return (aCandidates.size() != 0) || (mUnusedMathStatements.size() != 0);
 
-    // Having found one system, we may have further fragmented the systems by
-    // removing the linking variables. The next iteration will detect this and
-    // then we can try again.
-  }
-}
-
-bool
-CodeGenerationState::FindSmallSystem
-(
- std::set<ptr_tag<MathStatement> >& aUseMathStatements,
- std::set<ptr_tag<CDA_ComputationTarget> >& aUseVars,
- std::set<ptr_tag<CDA_ComputationTarget> >& aStart,
- std::set<ptr_tag<CDA_ComputationTarget> >& aCandidates,
- std::list<System*>& aSystems
-)
-{
-
-  for (uint32_t systemCardinality = 1;
-       systemCardinality <= SEARCH_DEPTH;
-       systemCardinality++)
-  {
-    std::set<ptr_tag<MathStatement> > s;
-    std::set<ptr_tag<MathStatement> >::iterator i(aUseMathStatements.begin());
-
-    // printf("Trying to find small system of size %u from network of %u candidates, %u equations\n",
-    //        systemCardinality, aCandidates.size(), aUseMathStatements.size());
-    if (RecursivelyTestSmallSystem(s, i, systemCardinality,
-                                   aUseMathStatements, aUseVars, aStart, aCandidates,
-                                   aSystems
-                                  ))
-    {
-      // printf("Success\n");
-      return true;
-    }
-    // printf("No luck, upping cardinality.\n");
+    // The statements FindBigSystem used might have linked components
+    // elsewhere, so decompose what is left again.
   }
-
-  return false;
 }
 
 uint32_t
@@ -2984,133 +3259,50 @@ ComputeSystemSize(std::set<ptr_tag<MathStatement> >& aSystem)
   return totalDegF;
 }
 
+/*
+ * Takes every component of the block lower triangular form that can be solved
+ * on its own out as a system, each after the systems it needs.
+ * Returns true if any systems were found.
+ */
 bool
-CodeGenerationState::RecursivelyTestSmallSystem
+CodeGenerationState::FindBlockTriangularSystems
 (
- std::set<ptr_tag<MathStatement> >& aSystem,
- std::set<ptr_tag<MathStatement> >::iterator& aEqIt,
- uint32_t aNeedToAdd,
- std::set<ptr_tag<MathStatement> >& aUseMathStatements,
- std::set<ptr_tag<CDA_ComputationTarget> >& aUseVars,
+ BlockTriangularForm& aForm,
  std::set<ptr_tag<CDA_ComputationTarget> >& aStart,
  std::set<ptr_tag<CDA_ComputationTarget> >& aCandidates,
  std::list<System*>& aSystems
 )
 {
-  // Pre: aNeedToAdd is >= 1...
-  aNeedToAdd--;
+  std::vector<uint32_t> order;
+  aForm.SolvableOrder(order);
 
-  for (std::set<ptr_tag<MathStatement> >::iterator i(aEqIt); i != aUseMathStatements.end();)
+  for (std::vector<uint32_t>::iterator c = order.begin(); c != order.end(); c++)
   {
-    if ((*i)->mType == MathStatement::SAMPLE_FROM_DIST)
-    {
-      // Sampling cannot be part of a set of simultaneous equation, but can appear by itself.
-      if (aNeedToAdd > 0 || aSystem.size() > 0)
-      {
-        i++;
-        continue;
-      }
-    }
-
-    // We do this insert and erase thing rather than copy the set to save stack
-    // space.
-    std::set<ptr_tag<MathStatement> >::iterator sysEq(aSystem.insert(*i).first);
-    i++;
-
-
-    if (aNeedToAdd > 0)
-    {
-      if (RecursivelyTestSmallSystem(aSystem, i, aNeedToAdd, aUseMathStatements,
-                                     aUseVars, aStart, aCandidates, aSystems))
-        return true;
-    }
-    else
-    {
-      // Well, we now have a set of equations which we are going to consider as
-      // a possible system in aSystem. Work out the variables involved...
-      std::set<ptr_tag<CDA_ComputationTarget> > targets;
-      std::set<ptr_tag<CDA_ComputationTarget> > known;
-
-      for (std::set<ptr_tag<MathStatement> >::iterator j(aSystem.begin());
-           j != aSystem.end(); j++)
-        for (std::list<ptr_tag<CDA_ComputationTarget> >::iterator k
-               ((*j)->mTargets.begin());
-             k != ((*j)->mTargets.end()); k++)
-        {
-          if (aStart.count(*k))
-          {
-            assert(aCandidates.count(*k) == 0);
-            known.insert(*k);
-          }
-          else
-          {
-            assert(aCandidates.count(*k));
-            assert(aUseVars.count(*k));
-            targets.insert(*k);
-          }
-        }
-      
-      uint32_t nEqns = ComputeSystemSize(aSystem), nUnknowns = targets.size();
-
-#if 0
-      if ((*targets.begin())->mVariable->name() == L"GK1_scal_rv")
-      {
-        for (std::set<ptr_tag<CDA_ComputationTarget> >::iterator i = targets.begin();
-             i != targets.end(); i++)
-        {
-          assert((*i)->mEvaluationType != iface::cellml_services::LOCALLY_BOUND);
-        }
-        asm("int $3");
-      }
-#endif
-
-      if ((*aSystem.begin())->mType == MathStatement::SAMPLE_FROM_DIST &&
-          static_cast<SampleFromDistribution*>(static_cast<MathStatement*>(*aSystem.begin()))->mOutSet != targets)
-      {
-        aSystem.erase(sysEq);
-        continue;
-      }
-
-      // printf("In this case, nEqns = %u, nUnknowns = %u\n", nEqns, nUnknowns);
-
-      if (nEqns > nUnknowns)
-      {
-        MathStatement * me = *(aUseMathStatements.begin());
-        if (me->mType != MathStatement::INITIAL_ASSIGNMENT)
-          throw OverconstrainedError(static_cast<MathMLMathStatement*>(me)->mMaths);
+    std::set<ptr_tag<MathStatement> > sysStmts
+      (aForm.mComponents[*c].begin(), aForm.mComponents[*c].end());
+    std::set<ptr_tag<CDA_ComputationTarget> > known, targets;
+    std::set<ptr_tag<MathStatement> >::iterator i;
+    for (i = sysStmts.begin(); i != sysStmts.end(); i++)
+      for (std::list<ptr_tag<CDA_ComputationTarget> >::iterator k =
+             (*i)->mTargets.begin(); k != (*i)->mTargets.end(); k++)
+        if (aStart.count(*k))
+          known.insert(*k);
         else
-          throw OverconstrainedError(NULL);
-      }
-
-      if (nEqns < nUnknowns)
-      {
-        aSystem.erase(sysEq);
-        continue;
-      }
-
-      // If we get here, we found a small system to remove.
-      System* syst = new System(aSystem, known, targets);
-      mSystems.push_back(syst);
-      aSystems.push_back(syst);
-
-      aStart.insert(targets.begin(), targets.end());
-
-      for (std::set<ptr_tag<CDA_ComputationTarget> >::iterator k(targets.begin());
-           k != targets.end();
-           k++)
-        aCandidates.erase(*k);
+          targets.insert(*k);
 
-      for (std::set<ptr_tag<MathStatement> >::iterator k(aSystem.begin());
-           k != aSystem.end(); k++)
-        mUnusedMathStatements.erase(*k);
-
-      return true;
-    }
+    System* syst = new System(sysStmts, known, targets);
+    mSystems.push_back(syst);
+    aSystems.push_back(syst);
 
-    aSystem.erase(sysEq);
+    aStart.insert(targets.begin(), targets.end());
+    for (std::set<ptr_tag<CDA_ComputationTarget> >::iterator k =
+           targets.begin(); k != targets.end(); k++)
+      aCandidates.erase(*k);
+    for (i = sysStmts.begin(); i != sysStmts.end(); i++)
+      mUnusedMathStatements.erase(*i);
   }
 
-  return false;
+  return !order.empty();
 }
 
 bool
@@ -3293,6 +3485,7 @@ CodeGenerationState::GenerateCodeForSet
    aSysByTargReq
 )
 {
+  CodeGenerationPhase phase(mCurrentPhase, "EmitCode");
   std::list<System*> sysCopy(aSystems);
   while (!sysCopy.empty())
   {
@@ -3368,6 +3561,7 @@ CodeGenerationState::GenerateCodeForSetByType
    aSysByTargReq
 )
 {
+  CodeGenerationPhase phase(mCurrentPhase, "EmitCode");
   // Make a list of all systems which allow us to compute rates...
   std::list<System*> rateSys;
   for
@@ -3407,98 +3601,32 @@ CodeGenerationState::GenerateCodeForSetByType
   GenerateCodeForSet(mCodeInfo->mVarsStr, aKnown, aSystems, aSysByTargReq);
 }
 
-static std::wstring
-SubstituteCase
+void
+CodeGenerationState::GenerateCasesIntoTemplate
 (
- std::pair<std::wstring, std::wstring>& aPair,
- std::wstring& aTemplate
+ std::wstring& aCodeTo,
+ std::list<std::pair<std::wstring, std::wstring> >& aCases
 )
 {
-  uint32_t state = 0;
-  std::wstring result;
-  for (std::wstring::iterator i = aTemplate.begin(); i != aTemplate.end();)
+  assert(aCases.begin() != aCases.end());
+  // The text outside <CASES> gets the first case, and each <CASES> section
+  // is repeated for the rest.
+  const std::wstring* first[] =
+    { &aCases.front().second, &aCases.front().first };
+  const SectionedCodeTemplate& t = mTemplates.mConditionalAssignment;
+  std::vector<SectionedCodeTemplate::Section>::const_iterator s;
+  for (s = t.mSections.begin(); s != t.mSections.end(); s++)
   {
-    wchar_t c = *i;
-    switch (state)
+    (*s).mBefore.Expand(aCodeTo, first);
+    for (std::list<std::pair<std::wstring, std::wstring> >::iterator i = ++aCases.begin();
+         i != aCases.end();
+         i++)
     {
-    case 0:
-      if (c != '<')
-      {
-        result += c;
-        i++;
-        continue;
-      }
-      else
-      {
-        state = 1;
-        i++;
-      }
-
-      continue;
-
-    default:
-      if (c == 'C')
-      {
-        if (aTemplate.substr(i - aTemplate.begin(), 10) == L"CONDITION>")
-        {
-          result += aPair.second;
-          i += 10;
-          state = 0;
-          continue;
-        }
-      }
-      else if (c == 'S')
-      {
-        if (aTemplate.substr(i - aTemplate.begin(), 10) == L"STATEMENT>")
-        {
-          result += aPair.first;
-          i += 10;
-          state = 0;
-          continue;
-        }
-      }
-      result += L"<";
-      state = 0;
-      continue;
+      const std::wstring* values[] = { &(*i).second, &(*i).first };
+      (*s).mEach.Expand(aCodeTo, values);
     }
   }
-
-  return result;
-}
-
-void
-CodeGenerationState::GenerateCasesIntoTemplate
-(
- std::wstring& aCodeTo,
- std::list<std::pair<std::wstring, std::wstring> >& aCases
-)
-{
-  size_t casepos = mConditionalAssignmentPattern.find(L"<CASES>"), initEnd, caseStart, caseEnd, finiStart;
-  if (casepos == std::wstring::npos)
-    initEnd = caseStart = caseEnd = finiStart = mConditionalAssignmentPattern.size();
-  else
-  {
-    initEnd = casepos;
-    caseStart = casepos + 7;
-    caseEnd = mConditionalAssignmentPattern.find(L"</CASES>", caseStart);
-    if (caseEnd == std::wstring::npos)
-      finiStart = caseEnd = std::wstring::npos;
-    else
-      finiStart = caseEnd + 8;
-  }
-  std::wstring init = mConditionalAssignmentPattern.substr(0, initEnd);
-  std::wstring each = mConditionalAssignmentPattern.substr(caseStart, caseEnd - caseStart);
-  std::wstring fini = mConditionalAssignmentPattern.substr(finiStart);
-
-  assert(aCases.begin() != aCases.end());
-  aCodeTo += SubstituteCase(*(aCases.begin()), init);
-  for (std::list<std::pair<std::wstring, std::wstring> >::iterator i = ++aCases.begin();
-       i != aCases.end();
-       i++)
-  {
-    aCodeTo += SubstituteCase(*i, each);
-  }
-  aCodeTo += SubstituteCase(*(aCases.begin()), fini);
+  t.mAfter.Expand(aCodeTo, first);
 }
 
 void
@@ -3713,6 +3841,42 @@ TryMakePiecewiseConditionsIntoRoots(const std::list<iface::mathml_dom::MathMLEle
     TryMakeAPiecewiseConditionIntoRoot(*i, aOutput);
 }
 
+void
+CodeGenerationState::ExpandSampleDensityFunction
+(
+ std::wstring& aCodeTo,
+ const SectionedCodeTemplate& aTemplate,
+ const std::wstring& aId,
+ const std::wstring& aRootCount,
+ const std::wstring& aExpr,
+ const std::list<std::wstring>& aRoots
+)
+{
+  const std::wstring* values[] = { &aId, &aRootCount, &aExpr };
+
+  std::vector<SectionedCodeTemplate::Section>::const_iterator s;
+  for (s = aTemplate.mSections.begin(); s != aTemplate.mSections.end(); s++)
+  {
+    (*s).mBefore.Expand(aCodeTo, values);
+
+    int rootID = 0;
+    for (std::list<std::wstring>::const_iterator rootIt = aRoots.begin();
+         rootIt != aRoots.end(); rootIt++)
+    {
+      wchar_t buf[30];
+      any_swprintf(buf, 30, L"%u", rootID++);
+      std::wstring rootIdStr(buf);
+      const std::wstring* rootValues[] =
+        { &aId, &aRootCount, &*rootIt, &rootIdStr };
+
+      // Anything after <ROOTSUP> goes into the supplementary code...
+      (*s).mEach.Expand(aCodeTo, rootValues);
+      (*s).mAfterSeparator.Expand(mCodeInfo->mFuncsStr, rootValues);
+    }
+  }
+  aTemplate.mAfter.Expand(aCodeTo, values);
+}
+
 void
 CodeGenerationState::GenerateCodeForSampleFromDist(std::wstring& aCodeTo, SampleFromDistribution* aSFD)
 {
@@ -3728,14 +3892,10 @@ CodeGenerationState::GenerateCodeForSampleFromDist(std::wstring& aCodeTo, Sample
   RETURN_INTO_WSTRING(du, csop->definitionURL());
   if (du == L"http://www.cellml.org/uncertainty-1#distributionFromDensity")
   {
-    std::wstring t = mSampleDensityFunctionPattern;
     wchar_t buf[30];
     any_swprintf(buf, 30, L"%u", mNextSolveId++);
+    std::wstring id(buf);
 
-    size_t pos = 0;
-    while ((pos = t.find(L"<ID>", pos)) != std::wstring::npos)
-      t.replace(pos, 4, buf);
-    
     if (mae->nArguments() != 2)
       ContextError(L"distributionFromDensity descriptions should have exactly one argument, the probability density function.",
                    mae, aSFD->mContext);
@@ -3812,59 +3972,15 @@ CodeGenerationState::GenerateCodeForSampleFromDist(std::wstring& aCodeTo, Sample
 
     wchar_t rcBuf[30];
     any_swprintf(rcBuf, 30, L"%u", pwRootStrs.size());
-    pos = 0;
-    while ((pos = t.find(L"<ROOTCOUNT>", pos)) != std::wstring::npos)
-      t.replace(pos, 11, rcBuf);
+    std::wstring rootCount(rcBuf);
 
-    pos = 0;
-    for (pos = t.find(L"<FOREACH_ROOT>", pos); pos != std::wstring::npos; pos = t.find(L"<FOREACH_ROOT>", pos))
-    {
-      size_t posEnd = t.find(L"</FOREACH_ROOT>", pos);
-      if (posEnd == std::wstring::npos)
-        break;
-      std::wstring templ = t.substr(pos + 14, posEnd - pos - 14);
-      std::wstring rootStr;
-      int rootID = 0;
-      for (std::list<std::wstring>::iterator rootIt = pwRootStrs.begin(); rootIt != pwRootStrs.end(); rootIt++)
-      {
-        std::wstring thisRootStr = templ;
-        wchar_t buf[30];
-        any_swprintf(buf, 30, L"%u", rootID++);
-
-        size_t rsPos = 0;
-        while ((rsPos = thisRootStr.find(L"<EXPR>", rsPos)) != std::wstring::npos)
-          thisRootStr.replace(rsPos, 6, *rootIt);
-        rsPos = 0;
-        while ((rsPos = thisRootStr.find(L"<ROOTID>", rsPos)) != std::wstring::npos)
-          thisRootStr.replace(rsPos, 8, buf);
-
-        rsPos = thisRootStr.find(L"<ROOTSUP>");
-        if (rsPos == std::wstring::npos)
-          rootStr += thisRootStr;
-        else
-        {
-          rootStr += thisRootStr.substr(0, rsPos);
-          mCodeInfo->mFuncsStr += thisRootStr.substr(rsPos + 9);
-        }
-      }
-      t.replace(pos, posEnd - pos + 15, rootStr);
-      pos++;
-    }
-
-    pos = 0;
-    while ((pos = t.find(L"<EXPR>", pos)) != std::wstring::npos)
-      t.replace(pos, 6, exprStr);
-
-    // Look for <SUP> and split there if we need to...
+    // The part before <SUP> is the expression for the sample, and the rest
+    // goes into the supplementary code, after any <ROOTSUP> code.
     std::wstring main, sup;
-    pos = t.find(L"<SUP>");
-    if (pos == std::wstring::npos)
-      main = t;
-    else
-    {
-      main = t.substr(0, pos);
-      sup = t.substr(pos + 5);
-    }
+    ExpandSampleDensityFunction(main, mTemplates.mSampleDensityFunction, id,
+                                rootCount, exprStr, pwRootStrs);
+    ExpandSampleDensityFunction(sup, mTemplates.mSampleDensityFunctionSup, id,
+                                rootCount, exprStr, pwRootStrs);
 
     if (sup != L"")
       mCodeInfo->mFuncsStr += sup;
@@ -3885,81 +4001,72 @@ CodeGenerationState::GenerateCodeForSampleFromDist(std::wstring& aCodeTo, Sample
       ContextError(L"Argument to distributionFromRealisations should be a vector.",
                    arg, aSFD->mContext);
 
-    std::wstring output = mSampleRealisationsPattern;
-
     wchar_t buf[30];
     any_swprintf(buf, 30, L"%u", vec->ncomponents());
-    size_t pos = 0;
-    while ((pos = output.find(L"<numChoices>", pos)) != std::wstring::npos)
-    {
-      output.replace(pos, 12, buf);
-      pos++;
-    }
+    std::wstring numChoices(buf);
+    const std::wstring* values[] = { &numChoices };
 
-    size_t ecpos = output.find(L"<eachChoice>");
-    if (ecpos != std::wstring::npos)
+    std::vector<std::wstring> choiceAssignments;
+    for (uint32_t i = 1, l = vec->ncomponents(); i <= l; i++)
     {
-      size_t ecEndPos = output.find(L"</eachChoice>", ecpos + 12);
-      if (ecEndPos != std::wstring::npos)
+      std::wstring assignments;
+      RETURN_INTO_OBJREF(ce, iface::mathml_dom::MathMLContentElement,
+                         vec->getComponent(i));
+      DECLARE_QUERY_INTERFACE_OBJREF(ivec, ce, mathml_dom::MathMLVectorElement);
+      if (ivec != NULL)
       {
-        std::wstring templ = output.substr(ecpos + 12, ecEndPos - ecpos - 12);
-        std::wstring allChoices;
-        for (uint32_t i = 1, l = vec->ncomponents(); i <= l; i++)
+        if (ivec->ncomponents() != aSFD->mOutTargets.size())
+          ContextError(L"Realisations of a distribution must be either a vector of constants or contants", ce, aSFD->mContext);
+        std::vector<ptr_tag<CDA_ComputationTarget> >::iterator k;
+        uint32_t j = 1;
+        for (j = 1, k = aSFD->mOutTargets.begin(); k != aSFD->mOutTargets.end();
+             k++, j++)
         {
-          std::wstring subIn = templ, assignments;
-          RETURN_INTO_OBJREF(ce, iface::mathml_dom::MathMLContentElement,
-                             vec->getComponent(i));
-          DECLARE_QUERY_INTERFACE_OBJREF(ivec, ce, mathml_dom::MathMLVectorElement);
-          if (ivec != NULL)
-          {
-            if (ivec->ncomponents() != aSFD->mOutTargets.size())
-              ContextError(L"Realisations of a distribution must be either a vector of constants or contants", ce, aSFD->mContext);
-            std::vector<ptr_tag<CDA_ComputationTarget> >::iterator k;
-            uint32_t j = 1;
-            for (j = 1, k = aSFD->mOutTargets.begin(); k != aSFD->mOutTargets.end();
-                 k++, j++)
-            {
-              RETURN_INTO_OBJREF(mel, iface::mathml_dom::MathMLContentElement,
-                                 ivec->getComponent(j));
-              RETURN_INTO_OBJREF(localVar, iface::cellml_api::CellMLVariable,
-                                 GetVariableInComponent(aSFD->mContext,
-                                                        (*k)->mVariable));
-              RETURN_INTO_OBJREF(mr, iface::cellml_services::MaLaESResult,
-                                 mTransform->transform(mCeVAS, mCUSES, mAnnoSet, mel,
-                                                       aSFD->mContext, localVar,
-                                                       NULL, 0));
-              GenerateAssignmentMaLaESResult(assignments, *k, mr, describeMaths(aSFD));
-            }
-          }
-          else if (aSFD->mOutTargets.size() != 1)
-            ContextError(L"Realisations of a distribution that generates more than one output must be a vector", ce, aSFD->mContext);
-          else
-          {
-            ptr_tag<CDA_ComputationTarget> ct = *aSFD->mOutTargets.begin();
-            RETURN_INTO_OBJREF(localVar, iface::cellml_api::CellMLVariable,
-                               GetVariableInComponent(aSFD->mContext,
-                                                      ct->mVariable));
-            RETURN_INTO_OBJREF(mr, iface::cellml_services::MaLaESResult,
-                               mTransform->transform(mCeVAS, mCUSES, mAnnoSet, ce,
-                                                     aSFD->mContext, localVar,
-                                                     NULL, 0));
-            GenerateAssignmentMaLaESResult(assignments, ct, mr, describeMaths(aSFD));
-          }
+          RETURN_INTO_OBJREF(mel, iface::mathml_dom::MathMLContentElement,
+                             ivec->getComponent(j));
+          RETURN_INTO_OBJREF(localVar, iface::cellml_api::CellMLVariable,
+                             GetVariableInComponent(aSFD->mContext,
+                                                    (*k)->mVariable));
+          RETURN_INTO_OBJREF(mr, iface::cellml_services::MaLaESResult,
+                             mTransform->transform(mCeVAS, mCUSES, mAnnoSet, mel,
+                                                   aSFD->mContext, localVar,
+                                                   NULL, 0));
+          GenerateAssignmentMaLaESResult(assignments, *k, mr, describeMaths(aSFD));
+        }
+      }
+      else if (aSFD->mOutTargets.size() != 1)
+        ContextError(L"Realisations of a distribution that generates more than one output must be a vector", ce, aSFD->mContext);
+      else
+      {
+        ptr_tag<CDA_ComputationTarget> ct = *aSFD->mOutTargets.begin();
+        RETURN_INTO_OBJREF(localVar, iface::cellml_api::CellMLVariable,
+                           GetVariableInComponent(aSFD->mContext,
+                                                  ct->mVariable));
+        RETURN_INTO_OBJREF(mr, iface::cellml_services::MaLaESResult,
+                           mTransform->transform(mCeVAS, mCUSES, mAnnoSet, ce,
+                                                 aSFD->mContext, localVar,
+                                                 NULL, 0));
+        GenerateAssignmentMaLaESResult(assignments, ct, mr, describeMaths(aSFD));
+      }
 
-          any_swprintf(buf, 30, L"%u", i - 1);
-          pos = 0;
-          while ((pos = subIn.find(L"<choiceNumber>", pos)) != std::wstring::npos)
-            subIn.replace(pos, 14, buf);
-          pos = 0;
-          while ((pos = subIn.find(L"<choiceAssignments>", pos)) != std::wstring::npos)
-            subIn.replace(pos, 19, assignments);
+      choiceAssignments.push_back(assignments);
+    }
 
-          allChoices += subIn;
-        }
-        output.replace(ecpos, ecEndPos - ecpos + 13, allChoices);
+    const SectionedCodeTemplate& t = mTemplates.mSampleRealisations;
+    std::vector<SectionedCodeTemplate::Section>::const_iterator s;
+    for (s = t.mSections.begin(); s != t.mSections.end(); s++)
+    {
+      (*s).mBefore.Expand(aCodeTo, values);
+      for (uint32_t i = 0; i < choiceAssignments.size(); i++)
+      {
+        any_swprintf(buf, 30, L"%u", i);
+        std::wstring choiceNumber(buf);
+        const std::wstring* choiceValues[] =
+          { &numChoices, &choiceNumber, &choiceAssignments[i] };
+        (*s).mEach.Expand(aCodeTo, choiceValues);
       }
     }
-    aCodeTo += output;
+    t.mAfter.Expand(aCodeTo, values);
   }
   else
     ContextError(L"The only supported ways to specify distributions for uncertain parameters are distributionFromDensity and distributionFromRealisations", csop, aSFD->mContext);
@@ -4177,6 +4284,79 @@ CodeGenerationState::GenerateStateToRateCascades()
   }
 }
 
+// Works out which state variables each rate depends on (the sparsity pattern
+// of the Jacobian), by following the systems which compute each rate back to
+// the state variables they use.
+void
+CodeGenerationState::ComputeRateDependencies
+(
+ std::map<ptr_tag<CDA_ComputationTarget>, System*>& aSysByTargReq
+)
+{
+  std::map<System*, std::set<uint32_t> > systemDependencies;
+  mCodeInfo->mRateDependencies.clear();
+  mCodeInfo->mRateDependencies.resize(mCodeInfo->mRateIndexCount);
+
+  std::list<ptr_tag<CDA_ComputationTarget> >::iterator i;
+  for (i = mBaseTargets.begin(); i != mBaseTargets.end(); i++)
+  {
+    // Every degree below the highest is a state, and its rate is the next
+    // degree up.
+    for (ptr_tag<CDA_ComputationTarget> ct = *i; ct->mUpDegree != NULL;
+         ct = ct->mUpDegree)
+    {
+      if (ct->mEvaluationType != iface::cellml_services::STATE_VARIABLE)
+        continue;
+      uint32_t rateIndex = ct->mAssignedIndex - mArrayOffset;
+      if (rateIndex >= mCodeInfo->mRateDependencies.size())
+        continue;
+
+      std::set<uint32_t> deps;
+      AddStateDependencies(ct->mUpDegree, aSysByTargReq, systemDependencies,
+                           deps);
+      mCodeInfo->mRateDependencies[rateIndex].assign(deps.begin(), deps.end());
+    }
+  }
+}
+
+void
+CodeGenerationState::AddStateDependencies
+(
+ ptr_tag<CDA_ComputationTarget> aTarget,
+ std::map<ptr_tag<CDA_ComputationTarget>, System*>& aSysByTargReq,
+ std::map<System*, std::set<uint32_t> >& aSystemDependencies,
+ std::set<uint32_t>& aDependencies
+)
+{
+  if (aTarget->mEvaluationType == iface::cellml_services::STATE_VARIABLE)
+  {
+    aDependencies.insert(aTarget->mAssignedIndex - mArrayOffset);
+    return;
+  }
+
+  std::map<ptr_tag<CDA_ComputationTarget>, System*>::iterator si =
+    aSysByTargReq.find(aTarget);
+  // Constants and the variable of integration don't depend on any states.
+  if (si == aSysByTargReq.end())
+    return;
+
+  System* sys = (*si).second;
+  std::map<System*, std::set<uint32_t> >::iterator di =
+    aSystemDependencies.find(sys);
+  if (di == aSystemDependencies.end())
+  {
+    // Systems form a DAG, so this recursion always ends.
+    std::set<uint32_t> sysDeps;
+    for (std::set<ptr_tag<CDA_ComputationTarget> >::iterator k =
+           sys->mKnowns.begin(); k != sys->mKnowns.end(); k++)
+      AddStateDependencies(*k, aSysByTargReq, aSystemDependencies, sysDeps);
+    di = aSystemDependencies.insert
+      (std::pair<System*, std::set<uint32_t> >(sys, sysDeps)).first;
+  }
+
+  aDependencies.insert((*di).second.begin(), (*di).second.end());
+}
+
 void
 CodeGenerationState::GenerateInfDelayUpdates()
 {
@@ -4296,226 +4476,11 @@ CodeGenerationState::GenerateSolveCode
     (mInitialOverrides.find(aComputedTarget));
   if (ivIt != mInitialOverrides.end())
     any_swprintf(iv, 30, L"%g", (*ivIt).second);
-  uint32_t state = 0;
-  uint32_t idx = 0;
-  std::wstring* dest = &aCodeTo;
-  for (idx = 0; idx < mSolvePattern.length(); idx++)
-  {
-    wchar_t c = mSolvePattern[idx];
-    switch (state)
-    {
-    case 0:
-      if (c == L'<')
-        state = 1;
-      else
-        *dest += c;
-      continue;
-    case 1: // Seen <
-      if (c == L'L')
-        state = 2;
-      else if (c == L'R')
-        state = 3;
-      else if (c == L'I')
-        state = 4;
-      else if (c == L'V')
-        state = 5;
-      else if (c == L'S')
-        state = 13;
-      else if (c == L'X')
-        state = 17;
-      else
-      {
-        *dest += L'<';
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 2: // Seen <L
-      if (c == L'H')
-        state = 6;
-      else
-      {
-        *dest += L"<L";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 3: // Seen <R
-      if (c == L'H')
-        state = 8;
-      else
-      {
-        *dest += L"<R";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 4: // Seen <I
-      if (c == L'D')
-        state = 10;
-      else if (c == L'V')
-        state = 16;
-      else
-      {
-        *dest += L"<I";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 5: // Seen <V
-      if (c == L'A')
-        state = 11;
-      else
-      {
-        *dest += L"<V";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 6: // Seen <LH
-      if (c == L'S')
-        state = 7;
-      else
-      {
-        *dest += L"<LH";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 7: // Seen <LHS
-      if (c == L'>')
-      {
-        // Matched <LHS>
-        *dest += e1;
-        state = 0;
-      }
-      else
-      {
-        *dest += L"<LHS";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 8: // Seen <RH
-      if (c == L'S')
-        state = 9;
-      else
-      {
-        *dest += L"<RH";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 9: // Seen <RHS
-      if (c == L'>')
-      {
-        // Matched <RHS>
-        *dest += e2;
-        state = 0;
-      }
-      else
-      {
-        *dest += L"<RHS";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 10: // Seen <ID
-      if (c == L'>')
-      {
-        // Matched <ID>
-        *dest += id;
-        state = 0;
-      }
-      else
-      {
-        *dest += L"<ID";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 11: // Seen <VA
-      if (c == L'R')
-        state = 12;
-      else
-      {
-        *dest += L"<VA";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 12: // Seen <VAR
-      if (c == L'>')
-      {
-        // Matched <VAR>
-        *dest += vname;
-        state = 0;
-      }
-      else
-      {
-        *dest += L"<VAR";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 13: // Seen <S
-      if (c == L'U')
-        state = 14;
-      else
-      {
-        *dest += L"<S";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 14: // Seen <SU
-      if (c == L'P')
-        state = 15;
-      else
-      {
-        *dest += L"<SU";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 15: // Seen <SUP
-      if (c == L'>')
-      {
-        // Matched <SUP>
-        dest = &mCodeInfo->mFuncsStr;
-        state = 0;
-      }
-      break;
-    case 16: // Seen <IV
-      if (c == L'>')
-      {
-        // Matched <IV>
-        *dest += iv;
-        state = 0;
-      }
-      else
-      {
-        *dest += L"<IV";
-        *dest += c;
-        state = 0;
-      }
-      break;
-    case 17: // Seen <X
-      if (mSolvePattern.substr(idx, 5) == L"MLID>")
-      {
-        *dest += describeMaths(aEq);
-        idx += 4;
-        state = 0;
-      }
-      else
-      {
-        state = 0;
-        *dest += L"<X";
-        *dest += c;
-      }
-      break;
-    }
-  }
+  std::wstring idStr(id), ivStr(iv), xmlId(describeMaths(aEq)), empty;
+  const std::wstring* values[] = { &e1, &e2, &idStr, &vname, &ivStr, &xmlId,
+                                   &empty };
+  mTemplates.mSolve.Expand(aCodeTo, values);
+  mTemplates.mSolveSup.Expand(mCodeInfo->mFuncsStr, values);
 }
 
 void
@@ -4525,6 +4490,20 @@ CodeGenerationState::GenerateMultivariateSolveCode
  System* aSys
 )
 {
+  // If the pattern can take explicitly computed variables inside the
+  // objective function, we tear the system so the solver only iterates on
+  // some of the unknowns. The constant initialisation patterns can't be used
+  // inside the objective function, so we never tear there.
+  std::vector<ptr_tag<MathStatement> > residuals;
+  std::vector<ptr_tag<CDA_ComputationTarget> > iterationVars;
+  std::wstring tornCode;
+  if (mIsConstant || !mTemplates.mSolveNLSystemTears ||
+      !TearSystem(aSys, residuals, iterationVars, tornCode))
+  {
+    residuals.assign(aSys->mMathStatements.begin(), aSys->mMathStatements.end());
+    iterationVars.assign(aSys->mUnknowns.begin(), aSys->mUnknowns.end());
+  }
+
   /*
    * Annotate the equation with the code... We implement a bit of a kludge
    * here: because we assume the number of equations is equal to the number of
@@ -4532,9 +4511,9 @@ CodeGenerationState::GenerateMultivariateSolveCode
    * that in our specification language we can use a single
    * <EQUATION></EQUATION> iterator construct.
    */
-  std::set<ptr_tag<CDA_ComputationTarget> >::iterator k(aSys->mUnknowns.begin());
-  for (std::set<ptr_tag<MathStatement> >::iterator i(aSys->mMathStatements.begin());
-       i != aSys->mMathStatements.end();
+  std::vector<ptr_tag<CDA_ComputationTarget> >::iterator k(iterationVars.begin());
+  for (std::vector<ptr_tag<MathStatement> >::iterator i(residuals.begin());
+       i != residuals.end();
        i++, k++)
   {
     MathStatement * ms(*i);
@@ -4614,107 +4593,281 @@ CodeGenerationState::GenerateMultivariateSolveCode
   wchar_t id[20];
   any_swprintf(id, 20, L"%u", mNextSolveId++);
 
-  // See if there is a <SUP> marker...
-  size_t supPos = mSolveNLSystemPattern.find(L"<SUP>");
-  if (supPos == std::wstring::npos)
-    GenerateMultivariateSolveCodeTo(aCodeTo, aSys, mSolveNLSystemPattern, id);
-  else
-  {
-    GenerateMultivariateSolveCodeTo(aCodeTo, aSys,
-                                    mSolveNLSystemPattern.substr(0, supPos), id);
-    GenerateMultivariateSolveCodeTo(mCodeInfo->mFuncsStr, aSys,
-                                    mSolveNLSystemPattern.substr(supPos + 5), id);
-  }
+  std::wstring idStr(id);
+  GenerateMultivariateSolveCodeTo(aCodeTo, residuals, iterationVars,
+                                  mTemplates.mSolveNLSystem, idStr, tornCode);
+  GenerateMultivariateSolveCodeTo(mCodeInfo->mFuncsStr, residuals,
+                                  iterationVars, mTemplates.mSolveNLSystemSup,
+                                  idStr, tornCode);
 }
 
-std::wstring
-CodeGenerationState::ReplaceIDs(std::wstring aReplaceFrom,
-                                const wchar_t* aId,
-                                const wchar_t* aIndex,
-                                const wchar_t* aCount)
+bool
+CodeGenerationState::TearSystem
+(
+ System* aSys,
+ std::vector<ptr_tag<MathStatement> >& aResiduals,
+ std::vector<ptr_tag<CDA_ComputationTarget> >& aIterationVars,
+ std::wstring& aTornCode
+)
 {
-  size_t offset = 0;
-
-  while (true)
+  // Only plain equations can be rearranged into assignments, and we need one
+  // degree of freedom per statement for the residual count to come out right.
+  std::set<ptr_tag<MathStatement> >::iterator i;
+  for (i = aSys->mMathStatements.begin(); i != aSys->mMathStatements.end(); i++)
+    if (((*i)->mType != MathStatement::EQUATION &&
+         (*i)->mType != MathStatement::PIECEWISE) ||
+        (*i)->degFreedom() != 1)
+      return false;
+
+  std::set<ptr_tag<MathStatement> > remaining(aSys->mMathStatements);
+  std::set<ptr_tag<CDA_ComputationTarget> > unsolved(aSys->mUnknowns);
+  std::vector<std::pair<ptr_tag<MathStatement>, ptr_tag<CDA_ComputationTarget> > >
+    assignments;
+  std::set<std::pair<ptr_tag<MathStatement>, ptr_tag<CDA_ComputationTarget> > >
+    needSolve;
+
+  while (!unsolved.empty())
   {
-    offset = aReplaceFrom.find(L"<ID>", offset);
-    if (offset == std::wstring::npos)
+    // Assign any equation which has only one unknown left that it can be
+    // rearranged for. Anything it uses has either been assigned already or
+    // is being iterated on, so the assignments come out in a valid order.
+    bool progress = false;
+    for (i = remaining.begin(); i != remaining.end(); i++)
+    {
+      if ((*i)->mType != MathStatement::EQUATION)
+        continue;
+
+      ptr_tag<CDA_ComputationTarget> only;
+      uint32_t count = 0;
+      std::list<ptr_tag<CDA_ComputationTarget> >::iterator t;
+      for (t = (*i)->mTargets.begin(); t != (*i)->mTargets.end(); t++)
+        if (unsolved.count(*t) && *t != only)
+        {
+          only = *t;
+          count++;
+        }
+      if (count != 1 ||
+          needSolve.count(std::pair<ptr_tag<MathStatement>,
+                                    ptr_tag<CDA_ComputationTarget> >(*i, only)))
+        continue;
+
+      Equation* eq = static_cast<Equation*>(static_cast<MathStatement*>(*i));
+      try
+      {
+        std::wstring throwAway;
+        mDryRun = true;
+        GenerateCodeForEquation(throwAway, eq, only, true);
+        mDryRun = false;
+      }
+      catch (AssignmentOnlyRequestedNeedSolve aorns)
+      {
+        mDryRun = false;
+        needSolve.insert(std::pair<ptr_tag<MathStatement>,
+                                   ptr_tag<CDA_ComputationTarget> >(*i, only));
+        continue;
+      }
+
+      assignments.push_back
+        (std::pair<ptr_tag<MathStatement>, ptr_tag<CDA_ComputationTarget> >(*i, only));
+      unsolved.erase(only);
+      remaining.erase(i);
+      progress = true;
       break;
+    }
+    if (progress)
+      continue;
+
+    // We are stuck, so iterate on whichever unknown appears in the most of
+    // the remaining statements, in the hope of unlocking as many of them as
+    // possible.
+    std::map<ptr_tag<CDA_ComputationTarget>, uint32_t> uses;
+    for (i = remaining.begin(); i != remaining.end(); i++)
+    {
+      std::set<ptr_tag<CDA_ComputationTarget> > seen;
+      std::list<ptr_tag<CDA_ComputationTarget> >::iterator t;
+      for (t = (*i)->mTargets.begin(); t != (*i)->mTargets.end(); t++)
+        if (unsolved.count(*t) && seen.insert(*t).second)
+          uses[*t]++;
+    }
 
-    aReplaceFrom.replace(offset, 4, aId);
-    offset++;
+    ptr_tag<CDA_ComputationTarget> best(*unsolved.begin());
+    uint32_t bestUses = 0;
+    std::map<ptr_tag<CDA_ComputationTarget>, uint32_t>::iterator u;
+    for (u = uses.begin(); u != uses.end(); u++)
+      if ((*u).second > bestUses)
+      {
+        best = (*u).first;
+        bestUses = (*u).second;
+      }
+
+    aIterationVars.push_back(best);
+    unsolved.erase(best);
   }
-  offset = 0;
-  while (true)
+
+  // Every assignment removed one statement and one unknown, and every tear
+  // removed one unknown, so what is left balances the iteration variables.
+  if (assignments.empty() || aIterationVars.empty() ||
+      remaining.size() != aIterationVars.size())
   {
-    offset = aReplaceFrom.find(L"<INDEX>", offset);
-    if (offset == std::wstring::npos)
-      break;
+    aIterationVars.clear();
+    return false;
+  }
+
+  aResiduals.assign(remaining.begin(), remaining.end());
+
+  std::vector<std::pair<ptr_tag<MathStatement>, ptr_tag<CDA_ComputationTarget> > >::iterator a;
+  for (a = assignments.begin(); a != assignments.end(); a++)
+    GenerateCodeForEquation(aTornCode,
+                            static_cast<Equation*>
+                            (static_cast<MathStatement*>((*a).first)),
+                            (*a).second, true);
+
+  return true;
+}
+
+static const wchar_t* sAssignTags[] = { L"<LHS>", L"<RHS>", L"<XMLID>", NULL };
+static const wchar_t* sResidualTags[] =
+  { L"<LHS>", L"<RHS>", L"<RNO>", L"<XMLID>", NULL };
+static const wchar_t* sIDTags[] = { L"<ID>", L"<INDEX>", L"<COUNT>", NULL };
+static const wchar_t* sSolveTags[] =
+  { L"<LHS>", L"<RHS>", L"<ID>", L"<VAR>", L"<IV>", L"<XMLID>", L"<SUP>", NULL };
+static const wchar_t* sNLSystemTags[] =
+  { L"<ID>", L"<INDEX>", L"<COUNT>", L"<TORN>", NULL };
+static const wchar_t* sNLEquationTags[] =
+  { L"<ID>", L"<INDEX>", L"<IV>", L"<VAR>", L"<EXPR>", L"<XMLID>", L"<TORN>",
+    NULL };
+static const wchar_t* sDensityTags[] =
+  { L"<ID>", L"<ROOTCOUNT>", L"<EXPR>", NULL };
+static const wchar_t* sDensityRootTags[] =
+  { L"<ID>", L"<ROOTCOUNT>", L"<EXPR>", L"<ROOTID>", NULL };
+static const wchar_t* sRealisationsTags[] = { L"<numChoices>", NULL };
+static const wchar_t* sChoiceTags[] =
+  { L"<numChoices>", L"<choiceNumber>", L"<choiceAssignments>", NULL };
+static const wchar_t* sCaseTags[] = { L"<CONDITION>", L"<STATEMENT>", NULL };
 
-    aReplaceFrom.replace(offset, 7, aIndex);
-    offset++;
+static void
+SplitAtSup(const std::wstring& aPattern, std::wstring& aMain,
+           std::wstring& aSup)
+{
+  size_t supPos = aPattern.find(L"<SUP>");
+  if (supPos == std::wstring::npos)
+  {
+    aMain = aPattern;
+    aSup = L"";
   }
-  offset = 0;
-  while (true)
+  else
   {
-    offset = aReplaceFrom.find(L"<COUNT>", offset);
-    if (offset == std::wstring::npos)
-      break;
-
-    aReplaceFrom.replace(offset, 7, aCount);
-    offset++;
+    aMain = aPattern.substr(0, supPos);
+    aSup = aPattern.substr(supPos + 5);
   }
+}
+
+void
+CodeGeneratorTemplates::CompileAssign(const std::wstring& aPattern)
+{
+  mAssign.Compile(aPattern, sAssignTags);
+}
+
+void
+CodeGeneratorTemplates::CompileAssignConstant(const std::wstring& aPattern)
+{
+  mAssignConstant.Compile(aPattern, sAssignTags);
+}
+
+void
+CodeGeneratorTemplates::CompileSolve(const std::wstring& aPattern)
+{
+  std::wstring main, sup;
+  SplitAtSup(aPattern, main, sup);
+  mSolve.Compile(main, sSolveTags);
+  mSolveSup.Compile(sup, sSolveTags);
+}
+
+void
+CodeGeneratorTemplates::CompileSolveNLSystem(const std::wstring& aPattern)
+{
+  std::wstring main, sup;
+  SplitAtSup(aPattern, main, sup);
+  mSolveNLSystem.Compile(main, L"<EQUATIONS>", L"</EQUATIONS>", L"<JOIN>",
+                         sNLSystemTags, sNLEquationTags, sNLSystemTags);
+  mSolveNLSystemSup.Compile(sup, L"<EQUATIONS>", L"</EQUATIONS>", L"<JOIN>",
+                            sNLSystemTags, sNLEquationTags, sNLSystemTags);
+  mSolveNLSystemTears = (aPattern.find(L"<TORN>") != std::wstring::npos);
+}
 
-  return aReplaceFrom;
+void
+CodeGeneratorTemplates::CompileSampleDensityFunction(const std::wstring& aPattern)
+{
+  std::wstring main, sup;
+  SplitAtSup(aPattern, main, sup);
+  mSampleDensityFunction.Compile(main, L"<FOREACH_ROOT>", L"</FOREACH_ROOT>",
+                                 L"<ROOTSUP>", sDensityTags, sDensityRootTags,
+                                 sDensityRootTags);
+  mSampleDensityFunctionSup.Compile(sup, L"<FOREACH_ROOT>", L"</FOREACH_ROOT>",
+                                    L"<ROOTSUP>", sDensityTags,
+                                    sDensityRootTags, sDensityRootTags);
+}
+
+void
+CodeGeneratorTemplates::CompileSampleRealisations(const std::wstring& aPattern)
+{
+  mSampleRealisations.Compile(aPattern, L"<eachChoice>", L"</eachChoice>",
+                              NULL, sRealisationsTags, sChoiceTags,
+                              sChoiceTags);
+}
+
+void
+CodeGeneratorTemplates::CompileConditionalAssignment(const std::wstring& aPattern)
+{
+  mConditionalAssignment.Compile(aPattern, L"<CASES>", L"</CASES>", NULL,
+                                 sCaseTags, sCaseTags, sCaseTags);
+}
+
+void
+CodeGeneratorTemplates::CompileResidual(const std::wstring& aPattern)
+{
+  mResidual.Compile(aPattern, sResidualTags);
+}
+
+void
+CodeGeneratorTemplates::CompileConstrainedRateStateInfo(const std::wstring& aPattern)
+{
+  mConstrainedRateStateInfo.Compile(aPattern, sIDTags);
+}
+
+void
+CodeGeneratorTemplates::CompileUnconstrainedRateStateInfo(const std::wstring& aPattern)
+{
+  mUnconstrainedRateStateInfo.Compile(aPattern, sIDTags);
 }
 
 void
 CodeGenerationState::GenerateMultivariateSolveCodeTo
 (
  std::wstring& aCodeTo,
- System* aSys,
- const std::wstring& aPattern,
- const wchar_t* aId
+ const std::vector<ptr_tag<MathStatement> >& aStatements,
+ const std::vector<ptr_tag<CDA_ComputationTarget> >& aTargets,
+ const SectionedCodeTemplate& aTemplate,
+ const std::wstring& aId,
+ const std::wstring& aTornCode
 )
 {
-  // Look for <EQUATIONS>...
-  size_t offset = 0;
-  size_t occurrence;
-
   wchar_t countStr[15];
-  any_swprintf(countStr, 15, L"%u", aSys->mMathStatements.size());
+  any_swprintf(countStr, 15, L"%u", aStatements.size());
+  std::wstring count(countStr), empty;
+  const std::wstring* values[] = { &aId, &empty, &count, &aTornCode };
 
-  while ((occurrence = aPattern.find(L"<EQUATIONS>", offset))
-         != std::wstring::npos)
+  // Each <EQUATIONS> section is expanded once per equation...
+  std::vector<SectionedCodeTemplate::Section>::const_iterator s;
+  for (s = aTemplate.mSections.begin(); s != aTemplate.mSections.end(); s++)
   {
-    aCodeTo += ReplaceIDs(aPattern.substr(offset, occurrence - offset),
-                          aId, L"", countStr);
-    offset = occurrence + 11;
-
-    occurrence = aPattern.find(L"</EQUATIONS>", offset);
-    if (occurrence == std::wstring::npos)
-    {
-      // This only happens if we were given a dubious string with no closing
-      // </EQUATIONS>...
-      offset -= 11;
-      break;
-    }
-
-    std::wstring perEqPattern(aPattern.substr(offset, occurrence - offset));
-
-    size_t joinOffset(perEqPattern.find(L"<JOIN>"));
-    std::wstring join;
-    if (joinOffset != std::wstring::npos)
-    {
-      join = perEqPattern.substr(joinOffset + 6);
-      perEqPattern = perEqPattern.substr(0, joinOffset);
-    }
+    (*s).mBefore.Expand(aCodeTo, values);
 
     uint32_t index = 0 + mArrayOffset;
-    std::set<ptr_tag<MathStatement> >::iterator i;
-    std::set<ptr_tag<CDA_ComputationTarget> >::iterator j;
-    for(i = aSys->mMathStatements.begin(), j = aSys->mUnknowns.begin();
-        i != aSys->mMathStatements.end(); i++, j++)
+    std::vector<ptr_tag<MathStatement> >::const_iterator i;
+    std::vector<ptr_tag<CDA_ComputationTarget> >::const_iterator j;
+    for(i = aStatements.begin(), j = aTargets.begin();
+        i != aStatements.end(); i++, j++)
     {
       wchar_t ivStr[30] = {L'0', L'.', L'1', L'\0'};
       std::map<ptr_tag<CDA_ComputationTarget>, double>::iterator ioi(mInitialOverrides.find(*j));
@@ -4724,236 +4877,19 @@ CodeGenerationState::GenerateMultivariateSolveCodeTo
       wchar_t indexStr[15];
       any_swprintf(indexStr, 15, L"%u", index);
       index++;
-      if (i != aSys->mMathStatements.begin())
-        aCodeTo += ReplaceIDs(join, aId, indexStr, countStr);
-      GenerateMultivariateSolveCodeEq(aCodeTo, *i, perEqPattern, aId, indexStr,
-                                      ivStr);
-    }
-
-    offset = occurrence + 12;
-  }
-
-  aCodeTo += ReplaceIDs(aPattern.substr(offset), aId, L"", countStr);
-}
-
-void
-CodeGenerationState::GenerateMultivariateSolveCodeEq
-(
- std::wstring& aCodeTo,
- ptr_tag<MathStatement> aEq,
- const std::wstring& aPattern,
- const wchar_t* aId,
- const wchar_t* aIndex,
- const wchar_t* aIV
-)
-{
-  uint32_t state = 0;
-  uint32_t idx = 0;
-  for (idx = 0; idx < aPattern.length(); idx++)
-  {
-    wchar_t c = aPattern[idx];
-    switch (state)
-    {
-    case 0:
-      if (c == L'<')
-        state = 1;
-      else
-        aCodeTo += c;
-      continue;
-    case 1: // Seen <
-      if (c == L'E')
-        state = 2;
-      else if (c == L'I')
-        state = 4;
-      else if (c == L'V')
-        state = 5;
-      else if (c == L'X')
-        state = 18;
-      else
-      {
-        aCodeTo += L'<';
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 2: // Seen <E
-      if (c == L'X')
-        state = 6;
-      else
-      {
-        aCodeTo += L"<E";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 4: // Seen <I
-      if (c == L'D')
-        state = 10;
-      else if (c == L'N')
-        state = 13;
-      else if (c == L'V')
-        state = 17;
-      else
-      {
-        aCodeTo += L"<I";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 5: // Seen <V
-      if (c == L'A')
-        state = 11;
-      else
-      {
-        aCodeTo += L"<V";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 6: // Seen <EX
-      if (c == L'P')
-        state = 7;
-      else
-      {
-        aCodeTo += L"<EX";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 7: // Seen <EXP
-      if (c == L'R')
-        state = 8;
-      else
-      {
-        aCodeTo += L"<EXP";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 8: // Seen <EXPR
-      if (c == L'>')
-      {
-        // Matched <EXPR>
-        aCodeTo += aEq->mCode;
-        state = 0;
-      }
-      else
+      std::wstring indexVal(indexStr), iv(ivStr), xmlId(describeMaths(*i));
+      if (i != aStatements.begin())
       {
-        aCodeTo += L"<EXPR";
-        aCodeTo += c;
-        state = 0;
+        const std::wstring* joinValues[] = { &aId, &indexVal, &count, &aTornCode };
+        (*s).mAfterSeparator.Expand(aCodeTo, joinValues);
       }
-      break;
-    case 10: // Seen <ID
-      if (c == L'>')
-      {
-        // Matched <ID>
-        aCodeTo += aId;
-        state = 0;
-      }
-      else
-      {
-        aCodeTo += L"<ID";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 11: // Seen <VA
-      if (c == L'R')
-        state = 12;
-      else
-      {
-        aCodeTo += L"<VA";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 12: // Seen <VAR
-      if (c == L'>')
-      {
-        // Matched <VAR>
-        aCodeTo += aEq->mVarName;
-        state = 0;
-      }
-      else
-      {
-        aCodeTo += L"<VAR";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 13: // Seen <IN
-      if (c == L'D')
-        state = 14;
-      else
-      {
-        aCodeTo += L"<IN";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 14: // Seen <IND
-      if (c == L'E')
-        state = 15;
-      else
-      {
-        aCodeTo += L"<IND";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 15: // Seen <INDE
-      if (c == L'X')
-        state = 16;
-      else
-      {
-        aCodeTo += L"<INDE";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 16: // Seen <INDEX
-      if (c == L'>')
-      {
-        // Matched <INDEX>
-        aCodeTo += aIndex;
-        state = 0;
-      }
-      else
-      {
-        aCodeTo += L"<INDEX";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 17: // Seen <IV
-      if (c == L'>')
-      {
-        // matched <IV>
-        aCodeTo += aIV;
-        state = 0;
-      }
-      else
-      {
-        aCodeTo += L"<IV";
-        aCodeTo += c;
-        state = 0;
-      }
-      break;
-    case 18: // Seen <X
-      if (aPattern.substr(idx, 5) == L"MLID>")
-      {
-        aCodeTo += describeMaths(aEq);
-        idx += 4;
-        state = 0;
-      }
-      else
-      {
-        state = 0;
-        aCodeTo += L"<X";
-        aCodeTo += c;
-      }
-      break;
+
+      MathStatement* ms = *i;
+      const std::wstring* eqValues[] =
+        { &aId, &indexVal, &iv, &ms->mVarName, &ms->mCode, &xmlId, &aTornCode };
+      (*s).mEach.Expand(aCodeTo, eqValues);
     }
   }
+
+  aTemplate.mAfter.Expand(aCodeTo, values);
 }
@@ -308,6 +308,27 @@ CDA_CodeInformation::missingInitial() throw()
   return mMissingInitial;
 }
 
+uint32_t
+CDA_CodeInformation::rateDependencyCount(uint32_t aRateIndex)
+  throw(std::exception&)
+{
+  if (aRateIndex >= mRateIndexCount)
+    throw iface::cellml_api::CellMLException(L"Rate index out of range");
+  if (aRateIndex >= mRateDependencies.size())
+    return 0;
+  return mRateDependencies[aRateIndex].size();
+}
+
+uint32_t
+CDA_CodeInformation::rateDependency(uint32_t aRateIndex,
+                                    uint32_t aDependencyNumber)
+  throw(std::exception&)
+{
+  if (aDependencyNumber >= rateDependencyCount(aRateIndex))
+    throw iface::cellml_api::CellMLException(L"Rate dependency number out of range");
+  return mRateDependencies[aRateIndex][aDependencyNumber];
+}
+
 CDA_CodeGenerator::CDA_CodeGenerator(bool aIDAStyle)
  : mConstantPattern(L"CONSTANTS[%]"),
    mStateVariableNamePattern(L"STATES[%]"),
@@ -437,6 +458,16 @@ CDA_CodeGenerator::CDA_CodeGenerator(bool aIDAStyle)
    mArrayOffset(0),
    mIDAStyle(aIDAStyle)
 {
+  mTemplates.CompileAssign(mAssignPattern);
+  mTemplates.CompileAssignConstant(mAssignConstantPattern);
+  mTemplates.CompileSolve(mSolvePattern);
+  mTemplates.CompileSolveNLSystem(mSolveNLSystemPattern);
+  mTemplates.CompileSampleDensityFunction(mSampleDensityFunctionPattern);
+  mTemplates.CompileSampleRealisations(mSampleRealisationsPattern);
+  mTemplates.CompileConditionalAssignment(mConditionalAssignmentPattern);
+  mTemplates.CompileResidual(mResidualPattern);
+  mTemplates.CompileConstrainedRateStateInfo(mConstrainedRateStateInfoPattern);
+  mTemplates.CompileUnconstrainedRateStateInfo(mUnconstrainedRateStateInfoPattern);
 }
 
 std::wstring
@@ -509,6 +540,7 @@ void
 CDA_CodeGenerator::sampleDensityFunctionPattern(const std::wstring& aPattern) throw()
 {
   mSampleDensityFunctionPattern = aPattern;
+  mTemplates.CompileSampleDensityFunction(aPattern);
 }
 
 std::wstring
@@ -521,6 +553,7 @@ void
 CDA_CodeGenerator::sampleRealisationsPattern(const std::wstring& aPattern) throw()
 {
   mSampleRealisationsPattern = aPattern;
+  mTemplates.CompileSampleRealisations(aPattern);
 }
 
 std::wstring
@@ -557,6 +590,7 @@ void
 CDA_CodeGenerator::assignPattern(const std::wstring& aPattern) throw()
 {
   mAssignPattern = aPattern;
+  mTemplates.CompileAssign(aPattern);
 }
 
 std::wstring
@@ -569,6 +603,7 @@ void
 CDA_CodeGenerator::assignConstantPattern(const std::wstring& aPattern) throw()
 {
   mAssignConstantPattern = aPattern;
+  mTemplates.CompileAssignConstant(aPattern);
 }
 
 std::wstring
@@ -581,6 +616,7 @@ void
 CDA_CodeGenerator::solvePattern(const std::wstring& aPattern) throw()
 {
   mSolvePattern = aPattern;
+  mTemplates.CompileSolve(aPattern);
 }
 
 std::wstring
@@ -593,6 +629,7 @@ void
 CDA_CodeGenerator::solveNLSystemPattern(const std::wstring& aPattern) throw()
 {
   mSolveNLSystemPattern = aPattern;
+  mTemplates.CompileSolveNLSystem(aPattern);
 }
 
 std::wstring
@@ -635,6 +672,7 @@ CDA_CodeGenerator::conditionalAssignmentPattern(const std::wstring& aPattern)
   throw()
 {
   mConditionalAssignmentPattern = aPattern;
+  mTemplates.CompileConditionalAssignment(aPattern);
 }
 
 std::wstring
@@ -649,6 +687,7 @@ CDA_CodeGenerator::residualPattern(const std::wstring& aPattern)
   throw()
 {
   mResidualPattern = aPattern;
+  mTemplates.CompileResidual(aPattern);
 }
 
 std::wstring
@@ -663,6 +702,7 @@ CDA_CodeGenerator::constrainedRateStateInfoPattern(const std::wstring& aPattern)
   throw()
 {
   mConstrainedRateStateInfoPattern = aPattern;
+  mTemplates.CompileConstrainedRateStateInfo(aPattern);
 }
 
 std::wstring
@@ -677,6 +717,7 @@ CDA_CodeGenerator::unconstrainedRateStateInfoPattern(const std::wstring& aPatter
   throw()
 {
   mUnconstrainedRateStateInfoPattern = aPattern;
+  mTemplates.CompileUnconstrainedRateStateInfo(aPattern);
 }
 
 std::wstring
@@ -848,7 +889,7 @@ CDA_CodeGenerator::makeCodeGenerationState(int aCompat, iface::cellml_api::Model
       mResidualPattern, mConstrainedRateStateInfoPattern,
       mUnconstrainedRateStateInfoPattern,
       mInfDelayedRatePattern, mInfDelayedStatePattern,
-      mConditionVariablePattern, mTrackPiecewiseConditions,
+      mConditionVariablePattern, mTemplates, mTrackPiecewiseConditions,
       mArrayOffset, mTransform,
       mCeVAS, mCUSES, mAnnoSet, mIDAStyle
       )
@@ -995,6 +1036,10 @@ CDA_CustomGenerator::CDA_CustomGenerator
     mSolvePattern(aSolvePattern), mSolveNLSystemPattern(aSolveNLSystemPattern),
     mArrayOffset(aArrayOffset)
 {
+  mTemplates.CompileAssign(mAssignPattern);
+  mTemplates.CompileAssignConstant(mAssignConstantPattern);
+  mTemplates.CompileSolve(mSolvePattern);
+  mTemplates.CompileSolveNLSystem(mSolveNLSystemPattern);
 }
 
 void
@@ -1058,8 +1103,8 @@ CDA_CustomGenerator::generateCode()
   CodeGenerationState cgs(1, mModel, emp, mStateVariableNamePattern, emp, emp, emp,
                           emp, emp, emp, mAssignPattern, mAssignConstantPattern,
                           mSolvePattern, mSolveNLSystemPattern,
-                          emp, emp, emp, emp, emp, emp, emp, emp, emp, false,
-                          mArrayOffset, mTransform, mCeVAS, mCUSES, mAnnoSet, false);
+                          emp, emp, emp, emp, emp, emp, emp, emp, emp,
+                          mTemplates, false, mArrayOffset, mTransform, mCeVAS, mCUSES, mAnnoSet, false);
   return
     cgs.GenerateCustomCode(mTargetSet, mRequestComputation, mKnown, mUnwanted);
 }
@@ -1081,3 +1126,19 @@ CreateCodeGeneratorBootstrap(void)
 {
   return new CDA_CodeGeneratorBootstrap();
 }
+
+// Each thread has its own observer, so a profiler on one thread doesn't see
+// (or race with) code generation on another.
+static ThreadLocal<CCGSPhaseObserver*> sCCGSPhaseObserver(1, NULL, NULL);
+
+void
+SetCCGSPhaseObserver(CCGSPhaseObserver* aObserver)
+{
+  sCCGSPhaseObserver = aObserver;
+}
+
+CCGSPhaseObserver*
+CurrentCCGSPhaseObserver()
+{
+  return static_cast<CCGSPhaseObserver*&>(sCCGSPhaseObserver);
+}
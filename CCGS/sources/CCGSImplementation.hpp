@@ -9,6 +9,7 @@
 #include "IfaceMathML_content_APISPEC.hxx"
 #include "IfaceCCGS.hxx"
 #include "Utilities.hxx"
+#include "CodeTemplate.hxx"
 #include <sstream>
 #include <vector>
 #include <list>
@@ -165,6 +166,9 @@ public:
   already_AddRefd<iface::mathml_dom::MathMLNodeList> flaggedEquations()
     throw();
   already_AddRefd<iface::cellml_services::ComputationTarget> missingInitial() throw();
+  uint32_t rateDependencyCount(uint32_t aRateIndex) throw(std::exception&);
+  uint32_t rateDependency(uint32_t aRateIndex, uint32_t aDependencyNumber)
+    throw(std::exception&);
 
   // CCGS implementation access only...
   std::wstring mErrorMessage;
@@ -174,6 +178,8 @@ public:
                mRootInformationStr;
   std::vector<iface::dom::Element*> mFlaggedEquations;
   CDA_ComputationTarget* mMissingInitial;
+  // For each rate, the sorted indices of the states it depends on.
+  std::vector<std::vector<uint32_t> > mRateDependencies;
 };
 
 class CDA_CustomCodeInformation
@@ -238,6 +244,7 @@ private:
   ObjRef<iface::cellml_services::AnnotationSet> mAnnoSet;
   std::wstring mStateVariableNamePattern, mAssignPattern, mAssignConstantPattern, mSolvePattern,
                mSolveNLSystemPattern;
+  CodeGeneratorTemplates mTemplates;
   uint32_t mArrayOffset;
 };
 
@@ -337,6 +344,7 @@ private:
     mConditionalAssignmentPattern, mResidualPattern, mConstrainedRateStateInfoPattern,
     mUnconstrainedRateStateInfoPattern, mInfDelayedRatePattern, mInfDelayedStatePattern,
     mConditionVariablePattern;
+  CodeGeneratorTemplates mTemplates;
   bool mTrackPiecewiseConditions, mAllowPassthrough;
   uint32_t mArrayOffset;
   bool mIDAStyle;
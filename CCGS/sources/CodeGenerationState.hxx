@@ -6,6 +6,8 @@
 #include <set>
 #include <map>
 #include "IfaceCellML_APISPEC.hxx"
+#include "CCGSBootstrap.hpp"
+#include "CodeTemplate.hxx"
 
 class MathStatement
 {
@@ -121,6 +123,8 @@ public:
   std::set<ptr_tag<CDA_ComputationTarget> > mUnknowns;
 };
 
+class BlockTriangularForm;
+
 class AssignmentOnlyRequestedNeedSolve
   : public std::exception
 {
@@ -129,6 +133,41 @@ public:
   const char* why() { return "assignmentOnly requested, but solve is required."; }
 };
 
+// The phase observer for the calling thread, if any.
+CCGSPhaseObserver* CurrentCCGSPhaseObserver();
+
+// Tells the phase observer, if any, about the outermost phase of code
+// generation in progress for as long as this is in scope.
+class CodeGenerationPhase
+{
+public:
+  CodeGenerationPhase(const char*& aCurrentPhase, const char* aPhase)
+    : mCurrentPhase(aCurrentPhase),
+      mPhase(aCurrentPhase == NULL ? aPhase : NULL)
+  {
+    if (mPhase == NULL)
+      return;
+    mCurrentPhase = mPhase;
+    CCGSPhaseObserver* observer = CurrentCCGSPhaseObserver();
+    if (observer != NULL)
+      observer->phaseStarted(mPhase);
+  }
+
+  ~CodeGenerationPhase()
+  {
+    if (mPhase == NULL)
+      return;
+    mCurrentPhase = NULL;
+    CCGSPhaseObserver* observer = CurrentCCGSPhaseObserver();
+    if (observer != NULL)
+      observer->phaseFinished(mPhase);
+  }
+
+private:
+  const char*& mCurrentPhase;
+  const char* mPhase;
+};
+
 class CodeGenerationState
 {
 public:
@@ -155,6 +194,7 @@ public:
                       std::wstring& aInfDelayedRatePattern,
                       std::wstring& aInfDelayedStatePattern,
                       std::wstring& aConditionVariablePattern,
+                      const CodeGeneratorTemplates& aTemplates,
                       bool aTrackPiecewiseConditions,
                       uint32_t aArrayOffset,
                       iface::cellml_services::MaLaESTransform* aTransform,
@@ -184,6 +224,7 @@ public:
       mInfDelayedRatePattern(aInfDelayedRatePattern),
       mInfDelayedStatePattern(aInfDelayedStatePattern),
       mConditionVariablePattern(aConditionVariablePattern),
+      mTemplates(aTemplates),
       mTrackPiecewiseConditions(aTrackPiecewiseConditions),
       mArrayOffset(aArrayOffset),
       mTransform(aTransform),
@@ -198,7 +239,8 @@ public:
       mNextSolveId(0),
       mIDAStyle(aIDAStyle),
       mIsConstant(false),
-      mDryRun(false)
+      mDryRun(false),
+      mCurrentPhase(NULL)
   {
   }
 
@@ -297,9 +339,8 @@ public:
                                 std::set<ptr_tag<CDA_ComputationTarget> >& aCandidates,
                                 std::set<ptr_tag<CDA_ComputationTarget> >& aUnwanted,
                                 std::list<System*>& aSystems);
-  bool FindSmallSystem(
-                       std::set<ptr_tag<MathStatement> >& aUseEquations,
-                       std::set<ptr_tag<CDA_ComputationTarget> >& aUseVars,
+  bool FindBlockTriangularSystems(
+                       BlockTriangularForm& aForm,
                        std::set<ptr_tag<CDA_ComputationTarget> >& aStart,
                        std::set<ptr_tag<CDA_ComputationTarget> >& aCandidates,
                        std::list<System*>& aSystems
@@ -313,17 +354,6 @@ public:
                      std::list<System*>& aSystems
                     );
 
-  bool RecursivelyTestSmallSystem(
-                                  std::set<ptr_tag<MathStatement> >& aSystem,
-                                  std::set<ptr_tag<MathStatement> >::iterator& aEqIt,
-                                  uint32_t aNeedToAdd,
-                                  std::set<ptr_tag<MathStatement> >& aUseMathStatements,
-                                  std::set<ptr_tag<CDA_ComputationTarget> >& aUseVars,
-                                  std::set<ptr_tag<CDA_ComputationTarget> >& aStart,
-                                  std::set<ptr_tag<CDA_ComputationTarget> >& aCandidates,
-                                  std::list<System*>& aSystems
-                                 );
-
   bool RecursivelyTestBigSystem(
                                 std::set<ptr_tag<MathStatement> >& aNonSystem,
                                 std::set<ptr_tag<MathStatement> >::iterator& aEqIt,
@@ -353,6 +383,17 @@ public:
   );
   void GenerateStateToRateCascades();
   void GenerateInfDelayUpdates();
+  void ComputeRateDependencies
+  (
+   std::map<ptr_tag<CDA_ComputationTarget>, System*>& aSysByTargReq
+  );
+  void AddStateDependencies
+  (
+   ptr_tag<CDA_ComputationTarget> aTarget,
+   std::map<ptr_tag<CDA_ComputationTarget>, System*>& aSysByTargReq,
+   std::map<System*, std::set<uint32_t> >& aSystemDependencies,
+   std::set<uint32_t>& aDependencies
+  );
   void GenerateCasesIntoTemplate(std::wstring& aCodeTo,
                                  std::list<std::pair<std::wstring, std::wstring> >& aCases);
   void GenerateCodeForSystem(std::wstring& aCodeTo, System* aSys);
@@ -365,6 +406,15 @@ public:
   void GenerateCodeForEquation(std::wstring& aCodeTo, Equation* aEq, ptr_tag<CDA_ComputationTarget> aComputedTarget,
                                bool aAssignmentOnly = false);
   void GenerateCodeForSampleFromDist(std::wstring& aCodeTo, SampleFromDistribution* aSFD);
+  void ExpandSampleDensityFunction
+  (
+   std::wstring& aCodeTo,
+   const SectionedCodeTemplate& aTemplate,
+   const std::wstring& aId,
+   const std::wstring& aRootCount,
+   const std::wstring& aExpr,
+   const std::list<std::wstring>& aRoots
+  );
 
   void GenerateAssignmentMaLaESResult
   (
@@ -384,31 +434,23 @@ public:
    std::wstring& aCodeTo,
    System* aSys
   );
-  void GenerateMultivariateSolveCodeTo
+  bool TearSystem
   (
-   std::wstring& aCodeTo,
    System* aSys,
-   const std::wstring& aPattern,
-   const wchar_t* aId
+   std::vector<ptr_tag<MathStatement> >& aResiduals,
+   std::vector<ptr_tag<CDA_ComputationTarget> >& aIterationVars,
+   std::wstring& aTornCode
   );
-  void GenerateMultivariateSolveCodeEq
+  void GenerateMultivariateSolveCodeTo
   (
    std::wstring& aCodeTo,
-   ptr_tag<MathStatement> aMS,
-   const std::wstring& aPattern,
-   const wchar_t* aId,
-   const wchar_t* aIndex,
-   const wchar_t* aIV
+   const std::vector<ptr_tag<MathStatement> >& aStatements,
+   const std::vector<ptr_tag<CDA_ComputationTarget> >& aTargets,
+   const SectionedCodeTemplate& aTemplate,
+   const std::wstring& aId,
+   const std::wstring& aTornCode
   );
 
-  std::wstring ReplaceIDs
-  (
-   std::wstring aReplaceFrom,
-   const wchar_t* aId,
-   const wchar_t* aIndex,
-   const wchar_t* aCount
-  );
-  
   void GenerateStateInformation(std::wstring& aStr);
   void AllocateRateNamesAsConstants(std::list<System*>& aSystems);
   void RestoreSavedRates(std::wstring& aCode);
@@ -447,6 +489,9 @@ public:
     & mConstrainedRateStateInfoPattern, & mUnconstrainedRateStateInfoPattern,
     & mInfDelayedRatePattern, & mInfDelayedStatePattern,
     & mConditionVariablePattern;
+  // The patterns which are expanded for every equation or variable, split up
+  // at their tags when they were set on the generator...
+  const CodeGeneratorTemplates& mTemplates;
   bool mTrackPiecewiseConditions;
   uint32_t mArrayOffset;
   ObjRef<iface::cellml_services::MaLaESTransform> mTransform;
@@ -484,6 +529,7 @@ public:
 
   std::list<RootInformation> mRootInformation;
   bool mDryRun;
+  const char* mCurrentPhase;
 };
 
 #endif // _CodeGenerationState_hxx
@@ -0,0 +1,192 @@
+#ifndef _CodeTemplate_hxx
+#define _CodeTemplate_hxx
+
+#include <string>
+#include <vector>
+#include <wchar.h>
+
+/**
+ * A code generation pattern, split up once at its tags (such as <LHS>), so
+ * that it can be expanded many times by appending each piece to the output,
+ * without searching or shifting strings. Only the tags it was compiled with
+ * are recognised; anything else is copied through as it is.
+ */
+class CodeTemplate
+{
+public:
+  CodeTemplate()
+  {
+  }
+
+  CodeTemplate(const std::wstring& aPattern, const wchar_t* const* aTags)
+  {
+    Compile(aPattern, aTags);
+  }
+
+  /**
+   * Splits aPattern up at the tags in aTags, a NULL terminated list such as
+   * { L"<LHS>", L"<RHS>", NULL }. Each tag is replaced, when the template is
+   * expanded, by the value at the same index in the list.
+   */
+  void
+  Compile(const std::wstring& aPattern, const wchar_t* const* aTags)
+  {
+    mSegments.clear();
+
+    Segment s;
+    size_t start = 0, pos = 0;
+    while ((pos = aPattern.find(L'<', pos)) != std::wstring::npos)
+    {
+      int tag = -1;
+      size_t tagLength = 0;
+      for (int i = 0; aTags[i] != NULL; i++)
+      {
+        size_t l = wcslen(aTags[i]);
+        if (!aPattern.compare(pos, l, aTags[i]))
+        {
+          tag = i;
+          tagLength = l;
+          break;
+        }
+      }
+
+      if (tag == -1)
+      {
+        pos++;
+        continue;
+      }
+
+      s.mText = aPattern.substr(start, pos - start);
+      s.mTag = tag;
+      mSegments.push_back(s);
+      pos += tagLength;
+      start = pos;
+    }
+
+    s.mText = aPattern.substr(start);
+    s.mTag = -1;
+    mSegments.push_back(s);
+  }
+
+  /**
+   * Appends the template to aAppendTo, with each tag replaced by the value
+   * at its index in aValues.
+   */
+  void
+  Expand(std::wstring& aAppendTo, const std::wstring* const* aValues) const
+  {
+    for (std::vector<Segment>::const_iterator i = mSegments.begin();
+         i != mSegments.end(); i++)
+    {
+      aAppendTo += (*i).mText;
+      if ((*i).mTag != -1)
+        aAppendTo += *aValues[(*i).mTag];
+    }
+  }
+
+private:
+  // Some literal text, followed by a tag (or -1 at the end)...
+  struct Segment
+  {
+    std::wstring mText;
+    int mTag;
+  };
+
+  std::vector<Segment> mSegments;
+};
+
+/**
+ * A pattern with repeated sections, such as
+ *   <EQUATIONS> per equation text <JOIN> separator text </EQUATIONS>
+ * The text between the sections, each section, and the part of each section
+ * after its separator are compiled into CodeTemplates, each recognising its
+ * own list of tags. The caller expands a section once per item. A section
+ * with no closing tag is left as it is, as part of the text after it.
+ */
+class SectionedCodeTemplate
+{
+public:
+  struct Section
+  {
+    // The text before the section, the section up to its separator, and the
+    // section after its separator.
+    CodeTemplate mBefore, mEach, mAfterSeparator;
+  };
+
+  void
+  Compile(const std::wstring& aPattern, const wchar_t* aOpen,
+          const wchar_t* aClose, const wchar_t* aSeparator,
+          const wchar_t* const* aTags, const wchar_t* const* aSectionTags,
+          const wchar_t* const* aSeparatorTags)
+  {
+    mSections.clear();
+
+    size_t openLength = wcslen(aOpen), closeLength = wcslen(aClose);
+    size_t offset = 0, open, close;
+    while ((open = aPattern.find(aOpen, offset)) != std::wstring::npos &&
+           (close = aPattern.find(aClose, open + openLength)) !=
+             std::wstring::npos)
+    {
+      mSections.push_back(Section());
+      Section& s = mSections.back();
+      s.mBefore.Compile(aPattern.substr(offset, open - offset), aTags);
+
+      std::wstring section(aPattern.substr(open + openLength,
+                                           close - open - openLength));
+      size_t separator = std::wstring::npos;
+      if (aSeparator != NULL)
+        separator = section.find(aSeparator);
+      if (separator == std::wstring::npos)
+      {
+        s.mEach.Compile(section, aSectionTags);
+        s.mAfterSeparator.Compile(std::wstring(), aSeparatorTags);
+      }
+      else
+      {
+        s.mEach.Compile(section.substr(0, separator), aSectionTags);
+        s.mAfterSeparator.Compile(section.substr(separator + wcslen(aSeparator)),
+                                  aSeparatorTags);
+      }
+
+      offset = close + closeLength;
+    }
+
+    mAfter.Compile(aPattern.substr(offset), aTags);
+  }
+
+  std::vector<Section> mSections;
+  // The text after the last section.
+  CodeTemplate mAfter;
+};
+
+/**
+ * The CodeGenerator patterns which are expanded for each equation, variable
+ * or system, compiled whenever a pattern is set rather than every time code
+ * is generated. Patterns with a <SUP> marker are split there first; the part
+ * after it goes to the supplementary code.
+ */
+struct CodeGeneratorTemplates
+{
+  CodeGeneratorTemplates() : mSolveNLSystemTears(false) {}
+
+  void CompileAssign(const std::wstring& aPattern);
+  void CompileAssignConstant(const std::wstring& aPattern);
+  void CompileSolve(const std::wstring& aPattern);
+  void CompileSolveNLSystem(const std::wstring& aPattern);
+  void CompileSampleDensityFunction(const std::wstring& aPattern);
+  void CompileSampleRealisations(const std::wstring& aPattern);
+  void CompileConditionalAssignment(const std::wstring& aPattern);
+  void CompileResidual(const std::wstring& aPattern);
+  void CompileConstrainedRateStateInfo(const std::wstring& aPattern);
+  void CompileUnconstrainedRateStateInfo(const std::wstring& aPattern);
+
+  CodeTemplate mAssign, mAssignConstant, mSolve, mSolveSup, mResidual,
+    mConstrainedRateStateInfo, mUnconstrainedRateStateInfo;
+  SectionedCodeTemplate mSolveNLSystem, mSolveNLSystemSup,
+    mSampleDensityFunction, mSampleDensityFunctionSup, mSampleRealisations,
+    mConditionalAssignment;
+  // True if the nonlinear system pattern has a <TORN> marker.
+  bool mSolveNLSystemTears;
+};
+
+#endif // _CodeTemplate_hxx
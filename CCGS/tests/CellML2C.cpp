@@ -487,7 +487,7 @@ main(int argc, char** argv)
     return -1;
   }
 
-  uint32_t usenames = 0, useida = 0;
+  uint32_t usenames = 0, useida = 0, tear = 0, patterns = 0;
 
   for (int32_t i = 2; i < argc; i++)
   {
@@ -495,6 +495,10 @@ main(int argc, char** argv)
       usenames = 1;
     else if (!strcmp(argv[i], "useida"))
       useida = 1;
+    else if (!strcmp(argv[i], "tear"))
+      tear = 1;
+    else if (!strcmp(argv[i], "patterns"))
+      patterns = 1;
   }
 
   wchar_t* URL;
@@ -545,6 +549,74 @@ main(int argc, char** argv)
   if (usenames)
     doNameAnnotations(mod, cg);
 
+  // The default nonlinear system pattern, but with somewhere to put the
+  // explicitly computed unknowns, so systems get torn.
+  if (tear)
+    cg->solveNLSystemPattern
+      (
+       L"rootfind_<ID>(VOI, CONSTANTS, RATES, STATES, ALGEBRAIC, pret);\r\n"
+       L"<SUP>"
+       L"void objfunc_<ID>(double* p, double* hx, void *adata)\r\n"
+       L"{\r\n"
+       L"  struct rootfind_info* rfi = (struct rootfind_info*)adata;\r\n"
+       L"#define VOI rfi->aVOI\r\n"
+       L"#define CONSTANTS rfi->aCONSTANTS\r\n"
+       L"#define RATES rfi->aRATES\r\n"
+       L"#define STATES rfi->aSTATES\r\n"
+       L"#define ALGEBRAIC rfi->aALGEBRAIC\r\n"
+       L"#define pret rfi->aPRET\r\n"
+       L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
+       L"  </EQUATIONS>\r\n"
+       L"<TORN>"
+       L"  <EQUATIONS>hx[<INDEX>] = <EXPR>;<JOIN>\r\n"
+       L"  </EQUATIONS>\r\n"
+       L"#undef VOI\r\n"
+       L"#undef CONSTANTS\r\n"
+       L"#undef RATES\r\n"
+       L"#undef STATES\r\n"
+       L"#undef ALGEBRAIC\r\n"
+       L"#undef pret\r\n"
+       L"}\r\n"
+       L"void rootfind_<ID>(double VOI, double* CONSTANTS, double* RATES, "
+       L"double* STATES, double* ALGEBRAIC, int* pret)\r\n"
+       L"{\r\n"
+       L"  /* Solver for equations: <EQUATIONS><XMLID><JOIN>, </EQUATIONS> */\r\n"
+       L"  static double p[<COUNT>] = {<EQUATIONS><IV><JOIN>,</EQUATIONS>};\r\n"
+       L"  struct rootfind_info rfi;\r\n"
+       L"  rfi.aVOI = VOI;\r\n"
+       L"  rfi.aCONSTANTS = CONSTANTS;\r\n"
+       L"  rfi.aRATES = RATES;\r\n"
+       L"  rfi.aSTATES = STATES;\r\n"
+       L"  rfi.aALGEBRAIC = ALGEBRAIC;\r\n"
+       L"  rfi.aPRET = pret;\r\n"
+       L"  do_nonlinearsolve(objfunc_<ID>, p, pret, <COUNT>, &rfi);\r\n"
+       L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
+       L"  </EQUATIONS>\r\n"
+       L"<TORN>"
+       L"}\r\n"
+      );
+
+  // Patterns which use tags more than once, have more than one <CASES>
+  // section, and have a tag that doesn't belong to them.
+  if (patterns)
+  {
+    cg->assignPattern(L"<LHS> = <RHS>; /* <XMLID>: <LHS> */\r\n");
+    cg->conditionalAssignmentPattern
+      (
+       L"/* <CONDITION><CASES> or <CONDITION></CASES> */\r\n"
+       L"if (<CONDITION>)\r\n"
+       L"{\r\n"
+       L"  <STATEMENT>"
+       L"}\r\n"
+       L"<CASES>else if (<CONDITION>)\r\n"
+       L"{\r\n"
+       L"  <STATEMENT>"
+       L"}\r\n"
+       L"</CASES>"
+       L"/* <CONDITION>, <LHS> */\r\n"
+      );
+  }
+
   iface::cellml_services::CodeInformation* cci = NULL;
   try
   {
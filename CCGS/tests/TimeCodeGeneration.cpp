@@ -0,0 +1,385 @@
+/*
+ * Times each phase of code generation over a directory of models, and writes
+ * the results as JSON so that they can be compared between builds. For each
+ * phase it records the mean wall time and number of allocations per run, and
+ * the peak resident set size of the process at the end of the phase.
+ *
+ * Allocations are counted by replacing the global operator new, so only
+ * allocations made through it (which includes those in the API libraries on
+ * platforms with ELF-style symbol interposition) are counted.
+ */
+#include "cellml-api-cxx-support.hpp"
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <exception>
+#include <new>
+#include "cda_compiler_support.h"
+#include "IfaceCellML_APISPEC.hxx"
+#include "IfaceCCGS.hxx"
+#include "CCGSBootstrap.hpp"
+#include "CellMLBootstrap.hpp"
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <dirent.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+static uint64_t sAllocationCount = 0;
+
+void*
+operator new(size_t aSize) throw(std::bad_alloc)
+{
+  sAllocationCount++;
+  void* p = malloc(aSize == 0 ? 1 : aSize);
+  if (p == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+void*
+operator new[](size_t aSize) throw(std::bad_alloc)
+{
+  return operator new(aSize);
+}
+
+void
+operator delete(void* aPtr) throw()
+{
+  free(aPtr);
+}
+
+void
+operator delete[](void* aPtr) throw()
+{
+  free(aPtr);
+}
+
+static uint64_t
+NowMicros()
+{
+#ifdef WIN32
+  FILETIME ft;
+  GetSystemTimeAsFileTime(&ft);
+  return ((static_cast<uint64_t>(ft.dwHighDateTime) << 32) |
+          ft.dwLowDateTime) / 10;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<uint64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+#endif
+}
+
+// The peak resident set size of the process so far, in kilobytes, or 0 if it
+// isn't available on this platform.
+static uint64_t
+PeakRSSKilobytes()
+{
+#ifdef WIN32
+  return 0;
+#else
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) != 0)
+    return 0;
+#ifdef __APPLE__
+  return ru.ru_maxrss / 1024;
+#else
+  return ru.ru_maxrss;
+#endif
+#endif
+}
+
+struct PhaseStatistics
+{
+  PhaseStatistics() : wallMicros(0), allocations(0), peakRSS(0) {}
+
+  uint64_t wallMicros, allocations, peakRSS;
+};
+
+typedef std::map<std::string, PhaseStatistics> PhaseMap;
+
+class PhaseProfiler
+  : public CCGSPhaseObserver
+{
+public:
+  PhaseProfiler() : mStartMicros(0), mStartAllocations(0) {}
+
+  void phaseStarted(const char* aPhase)
+  {
+    mStartAllocations = sAllocationCount;
+    mStartMicros = NowMicros();
+  }
+
+  void phaseFinished(const char* aPhase)
+  {
+    uint64_t now = NowMicros();
+    PhaseStatistics& ps = mPhases[aPhase];
+    ps.wallMicros += now - mStartMicros;
+    ps.allocations += sAllocationCount - mStartAllocations;
+    ps.peakRSS = std::max(ps.peakRSS, PeakRSSKilobytes());
+  }
+
+  PhaseMap mPhases;
+
+private:
+  uint64_t mStartMicros, mStartAllocations;
+};
+
+static void
+ListModels(const std::string& aDirectory, std::vector<std::string>& aModels)
+{
+#ifdef WIN32
+  WIN32_FIND_DATAA fd;
+  HANDLE h = FindFirstFileA((aDirectory + "\\*.xml").c_str(), &fd);
+  if (h == INVALID_HANDLE_VALUE)
+    return;
+  do
+    aModels.push_back(aDirectory + "\\" + fd.cFileName);
+  while (FindNextFileA(h, &fd));
+  FindClose(h);
+#else
+  DIR* d = opendir(aDirectory.c_str());
+  if (d == NULL)
+    return;
+  struct dirent* de;
+  while ((de = readdir(d)) != NULL)
+  {
+    size_t l = strlen(de->d_name);
+    if (l > 4 && !strcmp(de->d_name + l - 4, ".xml"))
+      aModels.push_back(aDirectory + "/" + de->d_name);
+  }
+  closedir(d);
+#endif
+  std::sort(aModels.begin(), aModels.end());
+}
+
+static void
+WriteJSONString(FILE* aOut, const std::string& aStr)
+{
+  fputc('"', aOut);
+  for (std::string::const_iterator i = aStr.begin(); i != aStr.end(); i++)
+  {
+    unsigned char c = *i;
+    if (c == '"' || c == '\\')
+      fprintf(aOut, "\\%c", c);
+    else if (c < 0x20)
+      fprintf(aOut, "\\u%04x", c);
+    else
+      fputc(c, aOut);
+  }
+  fputc('"', aOut);
+}
+
+static void
+WritePhase(FILE* aOut, const char* aName, const PhaseStatistics& aStats,
+           uint32_t aRepeats)
+{
+  fprintf(aOut, "        ");
+  WriteJSONString(aOut, aName);
+  fprintf(aOut, ": {\"wallMicros\": %llu, \"allocations\": %llu, "
+          "\"peakRSSKilobytes\": %llu}",
+          static_cast<unsigned long long>(aStats.wallMicros / aRepeats),
+          static_cast<unsigned long long>(aStats.allocations / aRepeats),
+          static_cast<unsigned long long>(aStats.peakRSS));
+}
+
+static const char*
+ConstraintLevelToString(iface::cellml_services::ModelConstraintLevel aLevel)
+{
+  switch (aLevel)
+  {
+  case iface::cellml_services::UNDERCONSTRAINED:
+    return "underconstrained";
+  case iface::cellml_services::OVERCONSTRAINED:
+    return "overconstrained";
+  case iface::cellml_services::UNSUITABLY_CONSTRAINED:
+    return "unsuitably constrained";
+  case iface::cellml_services::CORRECTLY_CONSTRAINED:
+    return "correctly constrained";
+  }
+
+  return "invalid";
+}
+
+// Generates code for one model aRepeats times, and writes its entry in the
+// output. Returns false if the model couldn't be loaded.
+static bool
+TimeModel(FILE* aOut, iface::cellml_api::DOMModelLoader* aLoader,
+          iface::cellml_services::CodeGeneratorBootstrap* aCGB,
+          const std::string& aModelPath, uint32_t aRepeats, bool aFirst)
+{
+  size_t l = aModelPath.length();
+  wchar_t* URL = new wchar_t[l + 1];
+  memset(URL, 0, (l + 1) * sizeof(wchar_t));
+  const char* mbrurl = aModelPath.c_str();
+  mbsrtowcs(URL, &mbrurl, l, NULL);
+
+  ObjRef<iface::cellml_api::Model> mod;
+  try
+  {
+    mod = already_AddRefd<iface::cellml_api::Model>(aLoader->loadFromURL(URL));
+    mod->fullyInstantiateImports();
+  }
+  catch (...)
+  {
+    delete [] URL;
+    fprintf(stderr, "Error loading model %s\n", aModelPath.c_str());
+    return false;
+  }
+  delete [] URL;
+
+  PhaseProfiler profiler;
+  SetCCGSPhaseObserver(&profiler);
+
+  PhaseStatistics total;
+  iface::cellml_services::ModelConstraintLevel level =
+    iface::cellml_services::UNSUITABLY_CONSTRAINED;
+  std::wstring error;
+  for (uint32_t i = 0; i < aRepeats; i++)
+  {
+    // A fresh generator each time, so nothing is cached between runs.
+    RETURN_INTO_OBJREF(cg, iface::cellml_services::CodeGenerator,
+                       aCGB->createCodeGenerator());
+    uint64_t startAllocations = sAllocationCount;
+    uint64_t startMicros = NowMicros();
+    try
+    {
+      RETURN_INTO_OBJREF(cci, iface::cellml_services::CodeInformation,
+                         cg->generateCode(mod));
+      level = cci->constraintLevel();
+      error = cci->errorMessage();
+    }
+    catch (...)
+    {
+      error = L"Exception while generating code";
+    }
+    total.wallMicros += NowMicros() - startMicros;
+    total.allocations += sAllocationCount - startAllocations;
+    total.peakRSS = std::max(total.peakRSS, PeakRSSKilobytes());
+  }
+
+  SetCCGSPhaseObserver(NULL);
+
+  // Whatever isn't in one of the phases (setting up CeVAS and CUSES, and
+  // bookkeeping between phases) is reported as other.
+  PhaseStatistics other(total);
+  for (PhaseMap::iterator i = profiler.mPhases.begin();
+       i != profiler.mPhases.end(); i++)
+  {
+    other.wallMicros -= std::min(other.wallMicros, (*i).second.wallMicros);
+    other.allocations -= std::min(other.allocations, (*i).second.allocations);
+  }
+
+  size_t el = wcstombs(NULL, error.c_str(), 0);
+  std::string error8;
+  if (el != static_cast<size_t>(-1))
+  {
+    char* buf = new char[el + 1];
+    wcstombs(buf, error.c_str(), el + 1);
+    error8 = buf;
+    delete [] buf;
+  }
+
+  fprintf(aOut, "%s\n    {\n      \"model\": ", aFirst ? "" : ",");
+  WriteJSONString(aOut, aModelPath);
+  fprintf(aOut, ",\n      \"repeats\": %u,\n      \"constraintLevel\": ",
+          aRepeats);
+  WriteJSONString(aOut, ConstraintLevelToString(level));
+  fprintf(aOut, ",\n      \"error\": ");
+  WriteJSONString(aOut, error8);
+  fprintf(aOut, ",\n      \"phases\": {\n");
+  for (PhaseMap::iterator i = profiler.mPhases.begin();
+       i != profiler.mPhases.end(); i++)
+  {
+    WritePhase(aOut, (*i).first.c_str(), (*i).second, aRepeats);
+    fprintf(aOut, ",\n");
+  }
+  WritePhase(aOut, "Other", other, aRepeats);
+  fprintf(aOut, "\n      },\n");
+  fprintf(aOut, "      \"total\": {\"wallMicros\": %llu, \"allocations\": %llu, "
+          "\"peakRSSKilobytes\": %llu}\n    }",
+          static_cast<unsigned long long>(total.wallMicros / aRepeats),
+          static_cast<unsigned long long>(total.allocations / aRepeats),
+          static_cast<unsigned long long>(total.peakRSS));
+
+  return true;
+}
+
+void
+usage()
+{
+  puts("Usage: TimeCodeGeneration modelDirectory [numberOfRepeats [outputFile]]");
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    usage();
+    return 1;
+  }
+
+  uint32_t numRepeats = 1;
+  if (argc > 2)
+  {
+    numRepeats = strtoul(argv[2], NULL, 10);
+    if (numRepeats == 0)
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  std::vector<std::string> models;
+  ListModels(argv[1], models);
+  if (models.empty())
+  {
+    fprintf(stderr, "No models found in %s\n", argv[1]);
+    return 1;
+  }
+
+  FILE* out = stdout;
+  if (argc > 3)
+  {
+    out = fopen(argv[3], "w");
+    if (out == NULL)
+    {
+      fprintf(stderr, "Can't open %s for writing\n", argv[3]);
+      return 1;
+    }
+  }
+
+  RETURN_INTO_OBJREF(cb, iface::cellml_api::CellMLBootstrap,
+                     CreateCellMLBootstrap());
+  RETURN_INTO_OBJREF(ml, iface::cellml_api::DOMModelLoader, cb->modelLoader());
+  RETURN_INTO_OBJREF(cgb, iface::cellml_services::CodeGeneratorBootstrap,
+                     CreateCodeGeneratorBootstrap());
+
+  int ret = 0;
+  bool first = true;
+  fprintf(out, "{\n  \"models\": [");
+  for (std::vector<std::string>::iterator i = models.begin();
+       i != models.end(); i++)
+  {
+    if (TimeModel(out, ml, cgb, *i, numRepeats, first))
+      first = false;
+    else
+      ret = 1;
+  }
+  fprintf(out, "\n  ]\n}\n");
+
+  if (out != stdout)
+    fclose(out);
+
+  return ret;
+}
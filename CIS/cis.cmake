@@ -132,6 +132,7 @@ ENDIF()
 ADD_LIBRARY(cis
   CIS/sources/CISImplementation.cxx
   CIS/sources/CISSolve.cxx
+  CIS/sources/CISResults.cxx
   ${SUNDIALS_SOURCES}
   )
 ADD_CUSTOM_COMMAND(
@@ -21,6 +21,8 @@
 #endif
 #include "CISImplementation.hxx"
 #include <fstream>
+#include <sstream>
+#include <limits>
 #include "CISBootstrap.hpp"
 #ifdef _MSC_VER
 #include <direct.h>
@@ -50,42 +52,40 @@
 #include "clang/Basic/DiagnosticIDs.h"
 #include "clang/Basic/DiagnosticOptions.h"
 #include "clang/CodeGen/CodeGenAction.h"
-#include "clang/Driver/Compilation.h"
-#include "clang/Driver/Driver.h"
-#include "clang/Driver/Job.h"
-#include "clang/Driver/Tool.h"
-#include "clang/Driver/Util.h"
 #include "clang/Frontend/CompilerInvocation.h"
 #include "clang/Frontend/CompilerInstance.h"
 #include "clang/Frontend/TextDiagnosticPrinter.h"
-#include <clang/CodeGen/CodeGenAction.h>
+#include "clang/Lex/PreprocessorOptions.h"
 #include <llvm/Support/MemoryBuffer.h>
-#include <sstream>
 #endif
 
+// A loaded module of compiled model code. How the code got there (an external
+// compiler and a shared library, or the in-process JIT) is hidden behind this
+// interface.
 class CompiledModule {
 public:
-#ifdef ENABLE_CLANG
-  llvm::OwningPtr<llvm::Module> mModule;
-  llvm::OwningPtr<llvm::ExecutionEngine> mExecutionEngine;
-  std::list<llvm::Function*> mFunctions;
+  virtual ~CompiledModule() {}
 
-  void*
-  getSymbol(const char* aName)
+  virtual void* getSymbol(const char* aName) = 0;
+};
+
+class SharedLibraryModule
+  : public CompiledModule
+{
+public:
+  SharedLibraryModule(void* aLibrary)
+    : mLibrary(aLibrary)
   {
-    llvm::Function* f = mModule->getFunction(aName);
-    // mFunctions.push_back(f);
-    return mExecutionEngine->getPointerToFunction(f);
   }
 
-  ~CompiledModule()
+  ~SharedLibraryModule()
   {
-    for (std::list<llvm::Function*>::iterator i = mFunctions.begin();
-         i != mFunctions.end(); i++)
-      delete (*i);
-  }
+#ifdef WIN32
+    FreeLibrary((HMODULE)mLibrary);
 #else
-  void* mModule;
+    dlclose(mLibrary);
+#endif
+  }
 
   void*
   getSymbol(const char* aName)
@@ -95,20 +95,51 @@ public:
 #else
 #define getsym(m,s) dlsym(m,s)
 #endif
-    return (void*)getsym(mModule, aName);
+    return (void*)getsym(mLibrary, aName);
 #undef getsym
   }
 
-  ~CompiledModule() {
-#ifdef WIN32
-    FreeLibrary((HMODULE)mModule);
-#else
-    dlclose(mModule);
-#endif
+private:
+  void* mLibrary;
+};
+
+#ifdef ENABLE_CLANG
+class JITModule
+  : public CompiledModule
+{
+public:
+  JITModule()
+    : mContext(new llvm::LLVMContext()), mModule(NULL)
+  {
   }
-#endif
+
+  ~JITModule()
+  {
+    // The execution engine owns the module, and both must be gone before the
+    // context they were created in.
+    mExecutionEngine.reset();
+    delete mContext;
+  }
+
+  void*
+  getSymbol(const char* aName)
+  {
+    llvm::Function* f = mModule->getFunction(aName);
+    if (f == NULL)
+      return NULL;
+    return mExecutionEngine->getPointerToFunction(f);
+  }
+
+  llvm::LLVMContext* mContext;
+  llvm::Module* mModule;
+  llvm::OwningPtr<llvm::ExecutionEngine> mExecutionEngine;
 };
 
+// Clang and the LLVM JIT keep process-wide state (target registry, command
+// line options), so only one model is compiled in-process at a time.
+static CDAMutex sJITMutex;
+#endif
+
 char*
 attempt_make_tempdir(const char* parentDir)
 {
@@ -141,6 +172,115 @@ attempt_make_tempdir(const char* parentDir)
   }
 }
 
+std::string
+make_tempdir()
+{
+  const char* tmpenvs[] = {"TMPDIR", "TEMP", "TMP", NULL};
+  const char** p = tmpenvs;
+  char* fn = NULL;
+  while (!fn && *p)
+  {
+    char* env = getenv(*p);
+    if (env != NULL)
+      fn = attempt_make_tempdir(env);
+    p++;
+  }
+  if (fn == NULL)
+  {
+#ifdef WIN32
+    const char* tmpdirs[] = {"c:\\temp", "c:\\tmp", "\\temp", "\\tmp", NULL};
+#else
+    const char* tmpdirs[] = {"/tmp", "/var/tmp", "/usr/tmp", NULL};
+#endif
+    p = tmpdirs;
+    while (!fn && *p)
+    {
+      fn = attempt_make_tempdir(*p);
+      p++;
+    }
+  }
+  if (fn == NULL)
+    throw iface::cellml_api::CellMLException(L"Could not make temporary directory");
+  std::string dirname = fn;
+  free(fn);
+  return dirname;
+}
+
+void
+remove_tempdir(const std::string& aDirname)
+{
+#ifdef WIN32
+  struct _finddata_t d;
+  intptr_t hd;
+  std::string pat = aDirname;
+  pat += "*.*";
+  hd = _findfirst(pat.c_str(), &d);
+  if (hd != -1)
+  {
+    do
+    {
+      unlink(d.name);
+    }
+    while (_findnext(hd, &d) == 0);
+    _findclose(hd);
+  }
+#else
+  DIR* d = opendir(aDirname.c_str());
+  struct dirent* de;
+  while ((de = readdir(d)))
+  {
+    std::string n = aDirname;
+    n += "/";
+    n += de->d_name;
+    unlink(n.c_str());
+  }
+  closedir(d);
+#endif
+  rmdir(aDirname.c_str());
+}
+
+#ifdef WIN32
+#define MODULE_SUFFIX ".dll"
+#else
+#define MODULE_SUFFIX ".so"
+#endif
+
+void*
+load_module(const std::string& aPath)
+{
+#ifdef WIN32
+  return LoadLibrary(aPath.c_str());
+#else
+  return dlopen(aPath.c_str(), RTLD_NOW);
+#endif
+}
+
+bool
+read_file(const std::string& aPath, std::string& aContents)
+{
+  std::ifstream f(aPath.c_str(), std::ios::in | std::ios::binary);
+  if (!f)
+    return false;
+  std::ostringstream ss;
+  ss << f.rdbuf();
+  aContents = ss.str();
+  return true;
+}
+
+// 64 bit FNV-1a; this only names cache entries, which are then checked
+// against the full text, so it need not be cryptographically strong.
+uint64_t
+fnv1a_64(const std::string& aData)
+{
+  uint64_t h = 14695981039346656037ULL;
+  for (std::string::const_iterator i = aData.begin(); i != aData.end(); i++)
+  {
+    h ^= static_cast<unsigned char>(*i);
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
 CompiledModelFunctions*
 SetupCompiledModelFunctions(CompiledModule* module)
 {
@@ -154,6 +294,17 @@ SetupCompiledModelFunctions(CompiledModule* module)
   return cmf;
 }
 
+VectorisedModelFunctions*
+SetupVectorisedModelFunctions(CompiledModule* module)
+{
+  VectorisedModelFunctions* vmf = new VectorisedModelFunctions;
+  vmf->ComputeRates = (void (*)(double,double*,double*,double*,double*, struct fail_info*))
+    module->getSymbol("ComputeRatesVectorised");
+  vmf->ComputeVariables = (void (*)(double,double*,double*,double*,double*,struct fail_info*))
+    module->getSymbol("ComputeVariablesVectorised");
+  return vmf;
+}
+
 IDACompiledModelFunctions*
 SetupIDACompiledModelFunctions(CompiledModule* module)
 {
@@ -176,126 +327,114 @@ SetupIDACompiledModelFunctions(CompiledModule* module)
 CompiledModule*
 CDA_CellMLIntegrationService::CompileSource
 (
- std::string& destDir, std::string& sourceFile, std::wstring& lastError
+ const std::string& aSource, std::string& destDir, std::wstring& lastError
+)
+{
+  if (mCompilerBackend == iface::cellml_services::COMPILER_JIT)
+    return CompileSourceJIT(aSource, lastError);
+  return CompileSourceExternal(aSource, destDir, lastError);
+}
+
+CompiledModule*
+CDA_CellMLIntegrationService::CompileSourceJIT
+(
+ const std::string& aSource, std::wstring& lastError
 )
 {
 #ifdef ENABLE_CLANG
+  CDALock jitLock(sJITMutex);
   LLVMLinkInJIT();
-  // This code is modified from the code in OpenCOR.
+  llvm::InitializeNativeTarget();
 
-  // Firstly use the driver as if we were going to do a compilation, but don't
-  // actually run the compilation (we just do this to get the arguments we need).
+  // This code is originally based on the code in OpenCOR. We skip the driver
+  // and set up the compiler invocation directly, so that the source can come
+  // from memory rather than from a file.
   clang::DiagnosticsEngine diagnosticsEngine
     (
      llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(new clang::DiagnosticIDs()),
      NULL
     );
-  clang::driver::Driver driver(
-                               "internal code compilation",
-                               llvm::sys::getDefaultTargetTriple(),
-                               "", true, diagnosticsEngine);
-
-  const char* args[] = { "internal code compilation", "-fsyntax-only", "-Wno-implicit-function-declaration", "-O3", sourceFile.c_str()
-                       };
-  llvm::OwningPtr<clang::driver::Compilation> compilation
-    (driver.BuildCompilation(llvm::ArrayRef<const char*>(args, sizeof(args)/sizeof(char*))));
-
-  if (!compilation)
-  {
-    mLastError = L"Cannot create an LLVM compiler driver.";
-    throw iface::cellml_api::CellMLException(L"Cannot create an LLVM compiler driver.");
-  }
 
-  const clang::driver::JobList &jobList =
-    compilation->getJobs();
-  const clang::driver::Command* command =
-    llvm::cast<clang::driver::Command>(*(compilation->getJobs().begin()));
-  const clang::driver::ArgStringList &commandArguments = command->getArguments();
+  const char* sourceName = "generated.c";
+  std::string triple = llvm::sys::getDefaultTargetTriple();
+  const char* args[] =
+    {
+      "-triple", triple.c_str(), "-O3", "-w",
+#ifdef ENABLE_FAST_MATH
+      "-ffast-math",
+#endif
+      "-x", "c", sourceName
+    };
   llvm::OwningPtr<clang::CompilerInvocation> compilerInvocation(new clang::CompilerInvocation());
-
   clang::CompilerInvocation::CreateFromArgs(*compilerInvocation.get(),
-                                            const_cast<const char **>(commandArguments.data()),
-                                            const_cast<const char **>(commandArguments.data())+
-                                            commandArguments.size(),
+                                            args, args + sizeof(args)/sizeof(char*),
                                             diagnosticsEngine);
 
+  // Serve the source file from our buffer; nothing touches the filesystem.
+  compilerInvocation->getPreprocessorOpts().addRemappedFile
+    (sourceName, llvm::MemoryBuffer::getMemBufferCopy(aSource, sourceName));
+
   // By default, Clang deliberately leaks memory so it is faster if it is
   // just going to exit anyway. Tell it not to do that.
   compilerInvocation->getFrontendOpts().DisableFree = 0;
 
-    // Create a compiler instance to handle the actual work
-
-    clang::CompilerInstance compilerInstance;
-
-    compilerInstance.setInvocation(compilerInvocation.take());
-
-    // Create the compiler instance's diagnostics engine
+  clang::CompilerInstance compilerInstance;
+  compilerInstance.setInvocation(compilerInvocation.take());
 
 #ifdef DEBUG_LLVM
-    llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> diagnosticOptions = new clang::DiagnosticOptions();
+  llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> diagnosticOptions = new clang::DiagnosticOptions();
 #endif
-    compilerInstance.createDiagnostics(int(commandArguments.size()),
-                                       const_cast<char **>(commandArguments.data()),
+  compilerInstance.createDiagnostics(int(sizeof(args)/sizeof(char*)),
+                                     const_cast<char **>(args),
 #ifdef DEBUG_LLVM
-                                       new clang::TextDiagnosticPrinter(llvm::outs(), &*diagnosticOptions)
+                                     new clang::TextDiagnosticPrinter(llvm::outs(), &*diagnosticOptions)
 #else
-                                       NULL
+                                     NULL
 #endif
-                                      );
-    // Create an LLVM module
-
-    llvm::OwningPtr<CompiledModule> clangData(new CompiledModule());
-
-    clangData->mModule.reset
-      (new llvm::Module(sourceFile, llvm::getGlobalContext()));
-
-    // Initialise the native target, so not only can we then create a JIT
-    // execution engine, but more importantly its data layout will match that of
-    // our target platform...
-
-    llvm::InitializeNativeTarget();
-
-    // Create an execution engine
-
-    std::string whyFail;
-    clangData->mExecutionEngine.reset
-      (llvm::ExecutionEngine::createJIT(clangData->mModule.get(), &whyFail));
+                                    );
 
-    if (!clangData->mExecutionEngine)
-    {
-      wchar_t buffer[1024];
-      mbstowcs(buffer, whyFail.c_str(), 1024);
-      buffer[1023] = 0;
-      mLastError = std::wstring(L"Cannot create LLVM execution engine: ") + buffer;
-      throw iface::cellml_api::CellMLException(std::wstring(L"Cannot create LLVM execution engine: ") + buffer);
-    }
-
-    // Create and execute the frontend to generate the LLVM assembly code,
-    // making sure that all added functions end up in the same module
-
-    llvm::OwningPtr<clang::CodeGenAction> codeGenerationAction
-      (new clang::EmitLLVMOnlyAction(&clangData->mModule->getContext()));
+  // Each model gets its own context, so that it can be torn down without
+  // affecting any other compiled model.
+  llvm::OwningPtr<JITModule> jitModule(new JITModule());
+  llvm::OwningPtr<clang::CodeGenAction> codeGenerationAction
+    (new clang::EmitLLVMOnlyAction(jitModule->mContext));
 
-    codeGenerationAction->setLinkModule(clangData->mModule.take());
-
-    if (!compilerInstance.ExecuteAction(*codeGenerationAction))
-    {
-      mLastError = L"Error generating code with LLVM.";
-      throw iface::cellml_api::CellMLException(L"Error generating code with LLVM.");
-    }
+  if (!compilerInstance.ExecuteAction(*codeGenerationAction))
+  {
+    lastError = L"Error generating code with LLVM.";
+    throw iface::cellml_api::CellMLException(lastError);
+  }
 
-    // Switch from the source module to the linked module.
-    clangData->mModule.reset(codeGenerationAction->takeModule());
+  llvm::Module* module = codeGenerationAction->takeModule();
+  std::string whyFail;
+  jitModule->mExecutionEngine.reset
+    (llvm::ExecutionEngine::createJIT(module, &whyFail));
+  if (!jitModule->mExecutionEngine)
+  {
+    delete module;
+    wchar_t buffer[1024];
+    mbstowcs(buffer, whyFail.c_str(), 1024);
+    buffer[1023] = 0;
+    lastError = std::wstring(L"Cannot create LLVM execution engine: ") + buffer;
+    throw iface::cellml_api::CellMLException(lastError);
+  }
+  jitModule->mModule = module;
 
-    return clangData.take();
+  return jitModule.take();
 #else // ENABLE_CLANG
+  lastError = L"This CellML Integration Service was built without an in-process compiler.";
+  throw iface::cellml_api::CellMLException(lastError);
+#endif // !ENABLE_CLANG
+}
+
+CompiledModule*
+CDA_CellMLIntegrationService::CompileSourceExternal
+(
+ const std::string& aSource, std::string& destDir, std::wstring& lastError
+)
+{
   setvbuf(stdout, NULL, _IONBF, 0);
-  std::string targ = destDir;
-#ifdef WIN32
-  targ += "/generated.dll";
-#else
-  targ += "/generated.so";
-#endif
+
   std::string cmd = "gcc -ggdb "
 #ifdef WIN32
     "-mthreads -Llib -L. -lcis "
@@ -327,9 +466,8 @@ CDA_CellMLIntegrationService::CompileSource
     "-shared -o";
 #endif
 
-  cmd += targ;
-  cmd += " ";
-  cmd += sourceFile;
+  // Flags which have to come after the file names.
+  std::string cmdSuffix;
 #ifdef WIN32
   // -1 means no, 1 yes, 0 means to be determined...
   static int need_no_cygwin = 0;
@@ -381,10 +519,96 @@ CDA_CellMLIntegrationService::CompileSource
   }
 
   if (need_no_cygwin > 0)
-    cmd += " -mno-cygwin";
+    cmdSuffix += " -mno-cygwin";
 
   // Need this at the end for the import library to work in all cases.
-  cmd += " -lcis";
+  cmdSuffix += " -lcis";
+#else
+  // Add the "-fPIC" flag in case we are running on a 64-bit machine
+  // Note: we currently only check against "x86_64", but this doesn't
+  //       mean that there aren't other machines that also need that
+  //       flag...
+
+  utsname u;
+  uname(&u);
+
+  if (!strcmp(u.machine, "x86_64"))
+    cmdSuffix += " -fPIC";
+#endif
+
+  // Everything that goes into the module is identified by the text compiled
+  // and the command used, so that text is the key for the module cache.
+  std::string cacheDir, cacheEntry;
+  std::string source = aSource;
+  if (!mCacheDirectory.empty())
+  {
+    size_t l = wcstombs(NULL, mCacheDirectory.c_str(), 0) + 1;
+    char* cd8 = new char[l];
+    wcstombs(cd8, mCacheDirectory.c_str(), l);
+    cacheDir = cd8;
+    delete [] cd8;
+
+    source = "/* CIS " CIS_VERSION_STRING ": " + cmd + cmdSuffix + " */\n" + aSource;
+    char key[17];
+    any_snprintf(key, sizeof(key), "%016llX", (unsigned long long)fnv1a_64(source));
+    // Each entry is a directory holding the source and the library built
+    // from it. It only ever appears complete, so matching the stored source
+    // catches hash collisions rather than loading the wrong model.
+    cacheEntry = cacheDir + "/" + key;
+    std::string existing;
+    if (read_file(cacheEntry + "/generated.c", existing) && existing == source)
+    {
+      void* t = load_module(cacheEntry + "/generated" MODULE_SUFFIX);
+      if (t != NULL)
+      {
+        destDir = "";
+        return new SharedLibraryModule(t);
+      }
+    }
+
+    mkdir(cacheDir.c_str()
+#ifndef WIN32
+          , 0700
+#endif
+         );
+    // Build inside the cache directory so the entry can be renamed into
+    // place atomically.
+    char* fn = attempt_make_tempdir(cacheDir.c_str());
+    if (fn != NULL)
+    {
+      destDir = fn;
+      free(fn);
+    }
+    else
+      cacheDir = "";
+  }
+  if (destDir.empty())
+    destDir = make_tempdir();
+
+  // From here on, destDir is removed on every failure, and once it has been
+  // published to the cache or replaced by the entry already there.
+  std::string sourceFile = destDir + "/generated.c";
+  bool written;
+  {
+    std::ofstream ss(sourceFile.c_str());
+    ss << source;
+    written = ss.good();
+  }
+  if (!written)
+  {
+    remove_tempdir(destDir);
+    destDir = "";
+    lastError = L"Could not write the model code to a temporary file.";
+    throw iface::cellml_api::CellMLException(lastError);
+  }
+
+  std::string targ = destDir + "/generated" MODULE_SUFFIX;
+  cmd += targ;
+  cmd += " ";
+  cmd += sourceFile;
+  cmd += cmdSuffix;
+
+#ifdef WIN32
     STARTUPINFO si;
     PROCESS_INFORMATION pi;
 
@@ -408,6 +632,8 @@ CDA_CellMLIntegrationService::CompileSource
     ) 
     {
       free(commandstring);
+      remove_tempdir(destDir);
+      destDir = "";
       printf( "CreateProcess failed (%d)\n", GetLastError() );
       throw iface::cellml_api::CellMLException(L"CreateProcess failed");
     }
@@ -422,34 +648,48 @@ CDA_CellMLIntegrationService::CompileSource
     CloseHandle( pi.hProcess );
     CloseHandle( pi.hThread );
 #else
-  // Add the "-fPIC" flag in case we are running on a 64-bit machine
-  // Note: we currently only check against "x86_64", but this doesn't
-  //       mean that there aren't other machines that also need that
-  //       flag...
-
-  utsname u;
-  uname(&u);
-
-  if (!strcmp(u.machine, "x86_64"))
-    cmd += " -fPIC";
-
   // Execute the command (i.e. compile the model)
 
   int ret = system(cmd.c_str());
 #endif
   if (ret != 0)
   {
+    remove_tempdir(destDir);
+    destDir = "";
     lastError = L"Could not compile the model code.";
     throw iface::cellml_api::CellMLException(L"Could not compile the model code.");
   }
 
-#ifdef WIN32
-  void* t = LoadLibrary(targ.c_str());
-#else
-  void* t = dlopen(targ.c_str(), RTLD_NOW);
-#endif
+  // Publish the whole build directory as the cache entry with one rename.
+  // If another writer got there first the rename fails, and we use their
+  // entry instead, unless it holds different code (a hash collision), in
+  // which case this build is used from where it is and removed along with
+  // the model.
+  if (!cacheDir.empty())
+  {
+    std::string existing;
+    if (rename(destDir.c_str(), cacheEntry.c_str()) == 0)
+    {
+      destDir = "";
+      targ = cacheEntry + "/generated" MODULE_SUFFIX;
+    }
+    else if (read_file(cacheEntry + "/generated.c", existing) &&
+             existing == source)
+    {
+      remove_tempdir(destDir);
+      destDir = "";
+      targ = cacheEntry + "/generated" MODULE_SUFFIX;
+    }
+  }
+
+  void* t = load_module(targ);
   if (t == NULL)
   {
+    if (!destDir.empty())
+    {
+      remove_tempdir(destDir);
+      destDir = "";
+    }
     lastError = L"Cannot load the model code module";
 #ifndef WIN32
     char* msg = dlerror();
@@ -465,10 +705,7 @@ CDA_CellMLIntegrationService::CompileSource
     throw iface::cellml_api::CellMLException(lastError);
   }
 
-  CompiledModule *mod = new CompiledModule();
-  mod->mModule = t;
-  return mod;
-#endif // !ENABLE_CLANG
+  return new SharedLibraryModule(t);
 }
 
 CDA_CellMLCompiledModel::CDA_CellMLCompiledModel
@@ -486,34 +723,9 @@ CDA_CellMLCompiledModel::CDA_CellMLCompiledModel
 CDA_CellMLCompiledModel::~CDA_CellMLCompiledModel()
 {
   delete mModule;
-#ifdef WIN32
-  struct _finddata_t d;
-  intptr_t hd;
-  std::string pat = mDirname;
-  pat += "*.*";
-  hd = _findfirst(pat.c_str(), &d);
-  if (hd != -1)
-  {
-    do
-    {
-      unlink(d.name);
-    }
-    while (_findnext(hd, &d) == 0);
-    _findclose(hd);
-  }
-#else
-  DIR* d = opendir(mDirname.c_str());
-  struct dirent* de;
-  while ((de = readdir(d)))
-  {
-    std::string n = mDirname;
-    n += "/";
-    n += de->d_name;
-    unlink(n.c_str());
-  }
-  closedir(d);
-#endif
-  rmdir(mDirname.c_str());
+  // Models compiled in-process, or loaded from the cache, have no directory.
+  if (!mDirname.empty())
+    remove_tempdir(mDirname);
 }
 
 CDA_CellMLIntegrationRun::CDA_CellMLIntegrationRun
@@ -525,7 +737,9 @@ CDA_CellMLIntegrationRun::CDA_CellMLIntegrationRun
   mEpsAbs(1E-6), mEpsRel(1E-6), mScalVar(1.0), mScalRate(0.0),
   mStepSizeMax(1.0), mStartBvar(0.0), mStopBvar(10.0), mMaxPointDensity(10000.0),
   mTabulationStepSize(0.0), mObserver(NULL), mCancelIntegration(false),
-  mPauseIntegration(false), mStrictTabulation(false)
+  mPauseIntegration(false), mStrictTabulation(false), mRowsPerBatch(0),
+  mBatchInterval(0.1),
+  mLinearSolver(iface::cellml_services::LINEAR_SOLVER_AUTOMATIC)
 {
 }
 
@@ -640,8 +854,36 @@ CDA_CellMLIntegrationRun::setOverride
 }
 
 void
-CDA_CellMLIntegrationRun::start()
-  throw (std::exception&)
+CDA_CellMLIntegrationRun::setResultBatching
+(
+ uint32_t aRowsPerBatch, double aBatchInterval
+)
+  throw (std::exception&)
+{
+  mRowsPerBatch = aRowsPerBatch;
+  mBatchInterval = aBatchInterval;
+}
+
+iface::cellml_services::LinearSolverType
+CDA_CellMLIntegrationRun::linearSolver()
+  throw (std::exception&)
+{
+  return mLinearSolver;
+}
+
+void
+CDA_CellMLIntegrationRun::linearSolver
+(
+ iface::cellml_services::LinearSolverType aLinearSolver
+)
+  throw (std::exception&)
+{
+  mLinearSolver = aLinearSolver;
+}
+
+void
+CDA_CellMLIntegrationRun::start()
+  throw (std::exception&)
 {
   if (mIsStarted)
     throw iface::cellml_api::CellMLException(L"Call to start() on an integration run that is already started.");
@@ -714,6 +956,17 @@ CDA_CellMLIntegrationRun::resume()
 #endif
 }
 
+// The generated nonlinear solves start from the current value of what they
+// are solving for, falling back to the model's guess if it isn't a number, so
+// storage is marked as not yet computed before the model is set up.
+static void
+MarkUncomputed(double* aValues, uint32_t aCount)
+{
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  for (uint32_t i = 0; i < aCount; i++)
+    aValues[i] = nan;
+}
+
 void
 CDA_ODESolverRun::runthread()
 {
@@ -736,6 +989,8 @@ CDA_ODESolverRun::runthread()
     algebraic = rates + rateSize;
 
     memset(rates, 0, rateSize * sizeof(double));
+    MarkUncomputed(constants, constSize);
+    MarkUncomputed(algebraic, algSize);
 
     struct Override overrides;
     overrides.isOverriden = new bool[constSize];
@@ -805,6 +1060,554 @@ CDA_ODESolverRun::runthread()
   release_ref(); // Thread is finishing, cancel the add_ref call before startthread.
 }
 
+class EnsembleWorker
+  : public CDAThread
+{
+public:
+  EnsembleWorker(CDA_ODEEnsembleRun* aRun)
+    : mRun(aRun)
+  {
+  }
+
+protected:
+  void runthread()
+  {
+    mRun->runWorker();
+    delete this;
+  }
+
+private:
+  CDA_ODEEnsembleRun* mRun;
+};
+
+// Sends one member's rows to the ensemble observer, from the worker thread.
+// The batch storage belongs to the worker, and is reused from one member to
+// the next.
+class EnsembleResultSink
+  : public ResultSink
+{
+public:
+  EnsembleResultSink(CDA_ODEEnsembleRun* aRun, uint32_t aMember,
+                     std::vector<double>& aBlock, uint32_t aRowSize,
+                     uint32_t aRowsPerBatch)
+    : ResultSink(aRowSize, aRowsPerBatch, aRun->mBatchInterval), mRun(aRun),
+      mMember(aMember), mBlock(aBlock)
+  {
+    if (mBlock.size() != mCapacity)
+      mBlock.resize(mCapacity);
+    mRows = &mBlock[0];
+  }
+
+  bool stopRequested()
+  {
+    return mRun->isCancelled();
+  }
+
+protected:
+  double* sendBatch(uint32_t aLength)
+  {
+    mBlock.resize(aLength);
+    {
+      CDALock lock(mRun->mObserverMutex);
+      if (mRun->mEnsembleObserver != NULL)
+      {
+        try
+        {
+          mRun->mEnsembleObserver->results(mMember, mBlock);
+        }
+        catch (...)
+        {
+        }
+      }
+    }
+    mBlock.resize(mCapacity);
+    return &mBlock[0];
+  }
+
+private:
+  CDA_ODEEnsembleRun* mRun;
+  uint32_t mMember;
+  std::vector<double>& mBlock;
+};
+
+CDA_ODEEnsembleRun::CDA_ODEEnsembleRun(CDA_ODESolverModel* m)
+  : CDA_ODESolverRun(m), mMemberCount(1), mWorkerCount(0), mNextMember(0),
+    mRunningWorkers(0), mEnsembleObserver(NULL)
+{
+}
+
+CDA_ODEEnsembleRun::~CDA_ODEEnsembleRun()
+{
+  if (mEnsembleObserver != NULL)
+    mEnsembleObserver->release_ref();
+  // Workers wait on mResumeCondition rather than reading the command pipe, so
+  // there is no pipe for the base class to close.
+  mIsStarted = false;
+}
+
+void
+CDA_ODEEnsembleRun::setEnsemble
+(
+ uint32_t aMemberCount,
+ const std::vector<double>& aConstants,
+ const std::vector<double>& aInitialConditions
+)
+  throw (std::exception&)
+{
+  if (mIsStarted)
+    throw iface::cellml_api::CellMLException(L"Call to setEnsemble() on an ensemble run that is already started.");
+
+  uint32_t constSize = mModel->mCCI->constantIndexCount();
+  uint32_t rateSize = mModel->mCCI->rateIndexCount();
+  if (!aConstants.empty() && aConstants.size() != aMemberCount * constSize)
+    throw iface::cellml_api::CellMLException(L"Ensemble constants must have one row of constantIndexCount values per member");
+  if (!aInitialConditions.empty() &&
+      aInitialConditions.size() != aMemberCount * rateSize)
+    throw iface::cellml_api::CellMLException(L"Ensemble initial conditions must have one row of rateIndexCount values per member");
+
+  mMemberCount = aMemberCount;
+  mMemberConstants = aConstants;
+  mMemberInitialConditions = aInitialConditions;
+}
+
+uint32_t
+CDA_ODEEnsembleRun::workerCount()
+  throw (std::exception&)
+{
+  return mWorkerCount;
+}
+
+void
+CDA_ODEEnsembleRun::workerCount(uint32_t aWorkerCount)
+  throw (std::exception&)
+{
+  if (mIsStarted)
+    throw iface::cellml_api::CellMLException(L"Cannot change workerCount on an ensemble run that is already started.");
+  mWorkerCount = aWorkerCount;
+}
+
+void
+CDA_ODEEnsembleRun::setProgressObserver
+(
+ iface::cellml_services::EnsembleProgressObserver* aEpo
+)
+  throw (std::exception&)
+{
+  CDALock lock(mObserverMutex);
+  if (mEnsembleObserver != NULL)
+    mEnsembleObserver->release_ref();
+  mEnsembleObserver = aEpo;
+  if (mEnsembleObserver != NULL)
+    mEnsembleObserver->add_ref();
+}
+
+void
+CDA_ODEEnsembleRun::start()
+  throw (std::exception&)
+{
+  if (mIsStarted)
+    throw iface::cellml_api::CellMLException(L"Call to start() on an ensemble run that is already started.");
+  mIsStarted = true;
+
+  uint32_t nWorkers = mWorkerCount;
+  if (nWorkers == 0)
+  {
+#ifdef WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    nWorkers = si.dwNumberOfProcessors;
+#else
+    long nprocs = sysconf(_SC_NPROCESSORS_ONLN);
+    nWorkers = nprocs > 0 ? nprocs : 1;
+#endif
+  }
+  uint32_t nItems = (mMemberCount + blockSize() - 1) / blockSize();
+  if (nWorkers > nItems)
+    nWorkers = nItems;
+  if (nWorkers == 0)
+    nWorkers = 1;
+
+  // Each worker accesses this, so must add_ref. The last worker to finish
+  // releases it.
+  add_ref();
+  // Workers can't take members, or finish, until they have all been counted.
+  CDALock lock(mQueueMutex);
+  for (uint32_t i = 0; i < nWorkers; i++)
+  {
+    EnsembleWorker* w = new EnsembleWorker(this);
+    if (!w->startthread())
+    {
+      delete w;
+      break;
+    }
+    mRunningWorkers++;
+  }
+
+  // The workers that did start share the members out between them.
+  if (mRunningWorkers == 0)
+  {
+    // Nothing is running, so let the caller try again.
+    mIsStarted = false;
+    release_ref();
+    throw iface::cellml_api::CellMLException(L"Could not start a thread to integrate the ensemble.");
+  }
+}
+
+void
+CDA_ODEEnsembleRun::stop()
+  throw (std::exception&)
+{
+  CDALock lock(mQueueMutex);
+  mCancelIntegration = true;
+  mResumeCondition.Broadcast();
+}
+
+void
+CDA_ODEEnsembleRun::pause()
+  throw (std::exception&)
+{
+  CDALock lock(mQueueMutex);
+  if (!mIsStarted || mCancelIntegration)
+    return;
+  mPauseIntegration = true;
+}
+
+void
+CDA_ODEEnsembleRun::resume()
+  throw (std::exception&)
+{
+  CDALock lock(mQueueMutex);
+  mPauseIntegration = false;
+  mResumeCondition.Broadcast();
+}
+
+bool
+CDA_ODEEnsembleRun::isCancelled()
+{
+  CDALock lock(mQueueMutex);
+  waitWhilePaused();
+  return mCancelIntegration;
+}
+
+// Called with mQueueMutex held.
+void
+CDA_ODEEnsembleRun::waitWhilePaused()
+{
+  while (mPauseIntegration && !mCancelIntegration)
+    mResumeCondition.Wait(mQueueMutex);
+}
+
+bool
+CDA_ODEEnsembleRun::nextMembers(uint32_t& aFirst, uint32_t& aCount)
+{
+  CDALock lock(mQueueMutex);
+  waitWhilePaused();
+  if (mCancelIntegration || mNextMember >= mMemberCount)
+    return false;
+  aFirst = mNextMember;
+  aCount = mMemberCount - mNextMember;
+  if (aCount > blockSize())
+    aCount = blockSize();
+  mNextMember += aCount;
+  return true;
+}
+
+void
+CDA_ODEEnsembleRun::runWorker()
+{
+  uint32_t algSize = mModel->mCCI->algebraicIndexCount();
+  uint32_t constSize = mModel->mCCI->constantIndexCount();
+  uint32_t rateSize = mModel->mCCI->rateIndexCount();
+
+  // Everything a member needs is allocated once per worker, and reused for
+  // each member it integrates.
+  double* constants = new double[constSize];
+  double* buffer = new double[2 * rateSize + algSize + 1];
+  bool* isOverriden = new bool[constSize];
+  CVODEWorkspace* ws = CreateCVODEWorkspace(mStepType, rateSize, buffer + 1);
+  std::vector<double> block;
+
+  uint32_t member, count;
+  while (nextMembers(member, count))
+    integrateMember(member, ws, constants, buffer, isOverriden, block);
+
+  DestroyCVODEWorkspace(ws);
+  delete [] isOverriden;
+  delete [] buffer;
+  delete [] constants;
+
+  finishWorker();
+}
+
+void
+CDA_ODEEnsembleRun::finishWorker()
+{
+  bool isLast;
+  {
+    CDALock lock(mQueueMutex);
+    isLast = (--mRunningWorkers == 0);
+  }
+  if (!isLast)
+    return;
+
+  {
+    CDALock lock(mObserverMutex);
+    if (mEnsembleObserver != NULL)
+    {
+      try
+      {
+        mEnsembleObserver->done();
+      }
+      catch (...)
+      {
+      }
+    }
+  }
+
+  release_ref(); // Cancel the add_ref call made in start().
+}
+
+bool
+CDA_ODEEnsembleRun::setupMember
+(
+ uint32_t aMember, double* constants, double* buffer, bool* isOverriden,
+ struct fail_info& failInfo
+)
+{
+  CompiledModelFunctions* f = mModel->mCMF;
+  uint32_t constSize = mModel->mCCI->constantIndexCount();
+  uint32_t rateSize = mModel->mCCI->rateIndexCount();
+
+  buffer[0] = mStartBvar;
+  double* states = buffer + 1;
+  double* rates = states + rateSize;
+  double* algebraic = rates + rateSize;
+
+  memset(rates, 0, rateSize * sizeof(double));
+  MarkUncomputed(constants, constSize);
+  MarkUncomputed(algebraic, mModel->mCCI->algebraicIndexCount());
+
+  struct Override overrides;
+  overrides.isOverriden = isOverriden;
+  overrides.constants = constants;
+  overrides.nConstants = constSize;
+  for (uint32_t i = 0; i < constSize; i++)
+    isOverriden[i] = false;
+
+  OverrideList::iterator oli;
+  for (oli = mConstantOverrides.begin(); oli != mConstantOverrides.end();
+       oli++)
+    if ((*oli).first < constSize)
+    {
+      isOverriden[(*oli).first] = true;
+      constants[(*oli).first] = (*oli).second;
+    }
+
+  if (!mMemberConstants.empty())
+  {
+    const double* row = &mMemberConstants[aMember * constSize];
+    for (uint32_t i = 0; i < constSize; i++)
+      if (row[i] == row[i])
+      {
+        isOverriden[i] = true;
+        constants[i] = row[i];
+      }
+  }
+
+  f->SetupConstants(constants, rates, states, &overrides, &failInfo);
+  if (failInfo.failtype)
+    return false;
+
+  for (oli = mIVOverrides.begin(); oli != mIVOverrides.end(); oli++)
+    if ((*oli).first < rateSize)
+      states[(*oli).first] = (*oli).second;
+
+  if (!mMemberInitialConditions.empty())
+  {
+    const double* row = &mMemberInitialConditions[aMember * rateSize];
+    for (uint32_t i = 0; i < rateSize; i++)
+      if (row[i] == row[i])
+        states[i] = row[i];
+  }
+
+  {
+    CDALock lock(mObserverMutex);
+    if (mEnsembleObserver != NULL)
+    {
+      try
+      {
+        std::vector<double> constantsVec(constants, constants + constSize);
+        mEnsembleObserver->computedConstants(aMember, constantsVec);
+      }
+      catch (...)
+      {
+      }
+    }
+  }
+
+  f->ComputeRates(mStartBvar, constants, rates, states, algebraic, &failInfo);
+  f->ComputeVariables(mStartBvar, constants, rates, states, algebraic,
+                      &failInfo);
+  return !failInfo.failtype;
+}
+
+void
+CDA_ODEEnsembleRun::reportMemberFinished
+(
+ uint32_t aMember, struct fail_info& failInfo
+)
+{
+  CDALock lock(mObserverMutex);
+  if (mEnsembleObserver == NULL)
+    return;
+  try
+  {
+    if (failInfo.failtype)
+      mEnsembleObserver->memberFailed(aMember, failInfo.failmsg.c_str());
+    else
+      mEnsembleObserver->memberDone(aMember);
+  }
+  catch (...)
+  {
+  }
+}
+
+void
+CDA_ODEEnsembleRun::integrateMember
+(
+ uint32_t aMember, CVODEWorkspace* ws,
+ double* constants, double* buffer, bool* isOverriden,
+ std::vector<double>& block
+)
+{
+  struct fail_info failInfo;
+  uint32_t algSize = mModel->mCCI->algebraicIndexCount();
+  uint32_t rateSize = mModel->mCCI->rateIndexCount();
+  uint32_t recsize = 2 * rateSize + algSize + 1;
+
+  if (setupMember(aMember, constants, buffer, isOverriden, failInfo))
+  {
+    EnsembleResultSink sink(this, aMember, block, recsize, mRowsPerBatch);
+    memcpy(sink.beginRow(), buffer, recsize * sizeof(double));
+    sink.commitRow();
+
+    double* states = buffer + 1;
+    double* rates = states + rateSize;
+    double* algebraic = rates + rateSize;
+    IntegrateCVODE(ws, mModel->mCMF, constants, rateSize, rates, states,
+                   algSize, algebraic, &sink, failInfo);
+  }
+
+  reportMemberFinished(aMember, failInfo);
+}
+
+CDA_LockStepEnsembleRun::CDA_LockStepEnsembleRun
+(
+ CDA_VectorisedODESolverModel* m
+)
+  : CDA_ODEEnsembleRun(m), mVectorisedModel(m)
+{
+  mStepType = iface::cellml_services::RUNGE_KUTTA_4;
+}
+
+void
+CDA_LockStepEnsembleRun::start()
+  throw (std::exception&)
+{
+  if (mStepType != iface::cellml_services::RUNGE_KUTTA_4)
+    throw iface::cellml_api::CellMLException(L"Lock-step ensemble runs only support RUNGE_KUTTA_4.");
+  if (!(mStepSizeMax > 0.0))
+    throw iface::cellml_api::CellMLException(L"Lock-step ensemble runs need a positive maxStep, which is used as the fixed step size.");
+  CDA_ODEEnsembleRun::start();
+}
+
+void
+CDA_LockStepEnsembleRun::runWorker()
+{
+  uint32_t lanes = mVectorisedModel->mLaneCount;
+  uint32_t algSize = mModel->mCCI->algebraicIndexCount();
+  uint32_t constSize = mModel->mCCI->constantIndexCount();
+  uint32_t rateSize = mModel->mCCI->rateIndexCount();
+  uint32_t recsize = 2 * rateSize + algSize + 1;
+
+  // Each member is set up with the single-instance code, and then scattered
+  // into its lane of the structure-of-arrays storage used by the kernels.
+  double* constants = new double[constSize];
+  double* buffer = new double[recsize];
+  bool* isOverriden = new bool[constSize];
+  double* vconstants = new double[constSize * lanes];
+  double* vstates = new double[rateSize * lanes];
+  double* vrates = new double[rateSize * lanes];
+  double* valgebraic = new double[algSize * lanes];
+  ResultSink** sinks = new ResultSink*[lanes];
+  std::vector<double>* blocks = new std::vector<double>[lanes];
+  struct fail_info* failInfos = new struct fail_info[lanes];
+
+  // By default, the lanes share the usual batch size between them.
+  uint32_t rowsPerBatch = mRowsPerBatch;
+  if (rowsPerBatch == 0)
+    rowsPerBatch = (262016 / recsize + lanes - 1) / lanes;
+
+  uint32_t first, count;
+  while (nextMembers(first, count))
+  {
+    for (uint32_t lane = 0; lane < lanes; lane++)
+    {
+      sinks[lane] = NULL;
+      // Lanes past the end of the ensemble just repeat the last member set
+      // up, and their results are discarded.
+      if (lane < count)
+      {
+        failInfos[lane] = fail_info();
+        if (setupMember(first + lane, constants, buffer, isOverriden,
+                        failInfos[lane]))
+        {
+          sinks[lane] = new EnsembleResultSink(this, first + lane,
+                                               blocks[lane], recsize,
+                                               rowsPerBatch);
+          memcpy(sinks[lane]->beginRow(), buffer, recsize * sizeof(double));
+          sinks[lane]->commitRow();
+        }
+        else
+          reportMemberFinished(first + lane, failInfos[lane]);
+      }
+
+      uint32_t i;
+      for (i = 0; i < constSize; i++)
+        vconstants[i * lanes + lane] = constants[i];
+      for (i = 0; i < rateSize; i++)
+        vstates[i * lanes + lane] = buffer[1 + i];
+      for (i = 0; i < algSize; i++)
+        valgebraic[i * lanes + lane] = buffer[1 + 2 * rateSize + i];
+    }
+
+    // A lane that fails is reported on its own, and the others carry on.
+    IntegrateLockStepRK4(mVectorisedModel->mVMF, lanes, vconstants, rateSize,
+                         vrates, vstates, algSize, valgebraic, sinks,
+                         failInfos);
+
+    for (uint32_t lane = 0; lane < count; lane++)
+      if (sinks[lane] != NULL)
+      {
+        delete sinks[lane];
+        reportMemberFinished(first + lane, failInfos[lane]);
+      }
+  }
+
+  delete [] failInfos;
+  delete [] blocks;
+  delete [] sinks;
+  delete [] valgebraic;
+  delete [] vrates;
+  delete [] vstates;
+  delete [] vconstants;
+  delete [] isOverriden;
+  delete [] buffer;
+  delete [] constants;
+
+  finishWorker();
+}
+
 void
 CDA_DAESolverRun::runthread()
 {
@@ -831,6 +1634,8 @@ CDA_DAESolverRun::runthread()
 
     memset(rates, 0, rateSize * sizeof(double));
     memset(condvars, 0, condVarSize * sizeof(double));
+    MarkUncomputed(constants, constSize);
+    MarkUncomputed(algebraic, algSize);
 
     struct Override overrides;
     overrides.isOverriden = new bool[constSize];
@@ -892,9 +1697,7 @@ void
 CDA_CellMLIntegrationService::setupCodeEnvironment
 (
  iface::cellml_services::CodeInformation* cci,
- std::string& dirname,
- std::string& sourcename,
- std::ofstream& ss
+ std::ostream& ss
 )
 {
   iface::cellml_services::ModelConstraintLevel mcl = cci->constraintLevel();
@@ -912,40 +1715,6 @@ CDA_CellMLIntegrationService::setupCodeEnvironment
     }
   }
 
-  // Create a temporary directory...
-  const char* tmpenvs[] = {"TMPDIR", "TEMP", "TMP", NULL};
-  const char** p = tmpenvs;
-  char* fn = NULL;
-  while (!fn && *p)
-  {
-    char* env = getenv(*p);
-    if (env != NULL)
-      fn = attempt_make_tempdir(env);
-    p++;
-  }
-  if (fn == NULL)
-  {
-#ifdef WIN32
-    const char* tmpdirs[] = {"c:\\temp", "c:\\tmp", "\\temp", "\\tmp", NULL};
-#else
-    const char* tmpdirs[] = {"/tmp", "/var/tmp", "/usr/tmp", NULL};
-#endif
-    p = tmpdirs;
-    while (!fn && *p)
-    {
-      fn = attempt_make_tempdir(*p);
-      p++;
-    }
-  }
-  if (fn == NULL)
-    throw iface::cellml_api::CellMLException(L"Could not make temporary directory");
-  dirname = fn;
-  free(fn);
-
-  // We now have a temporary directory. Make the source file...
-  sourcename = dirname + "/generated.c";
-  ss.open(sourcename.c_str());
-
   ss << "/* This file is automatically generated and will be automatically"
      << std::endl
      << " * deleted. Don't edit it or changes will be lost. */" << std::endl
@@ -1014,6 +1783,86 @@ CDA_CellMLIntegrationService::compileDebugModelODE
   return compileModelODEInternal(aModel, true);
 }
 
+// The MaLaES description used for generated C code without the extra checks
+// made in debug models.
+static const wchar_t* sCTransform =
+L"opengroup: (\r\n"
+L"closegroup: )\r\n"
+L"abs: #prec[H]fabs(#expr1)\r\n"
+L"and: #prec[20]#exprs[&&]\r\n"
+L"arccos: #prec[H]acos(#expr1)\r\n"
+L"arccosh: #prec[H]acosh(#expr1)\r\n"
+L"arccot: #prec[1000(900)]atan(1.0/#expr1)\r\n"
+L"arccoth: #prec[1000(900)]atanh(1.0/#expr1)\r\n"
+L"arccsc: #prec[1000(900)]asin(1/#expr1)\r\n"
+L"arccsch: #prec[1000(900)]asinh(1/#expr1)\r\n"
+L"arcsec: #prec[1000(900)]acos(1/#expr1)\r\n"
+L"arcsech: #prec[1000(900)]acosh(1/#expr1)\r\n"
+L"arcsin: #prec[H]asin(#expr1)\r\n"
+L"arcsinh: #prec[H]asinh(#expr1)\r\n"
+L"arctan: #prec[H]atan(#expr1)\r\n"
+L"arctanh: #prec[H]atanh(#expr1)\r\n"
+L"ceiling: #prec[H]ceil(#expr1)\r\n"
+L"cos: #prec[H]cos(#expr1)\r\n"
+L"cosh: #prec[H]cosh(#expr1)\r\n"
+L"cot: #prec[900(0)]1.0/tan(#expr1)\r\n"
+L"coth: #prec[900(0)]1.0/tanh(#expr1)\r\n"
+L"csc: #prec[900(0)]1.0/sin(#expr1)\r\n"
+L"csch: #prec[900(0)]1.0/sinh(#expr1)\r\n"
+L"diff: #lookupDiffVariable\r\n"
+L"divide: #prec[900]#expr1/#expr2\r\n"
+L"eq: #prec[30]#exprs[==]\r\n"
+L"exp: #prec[H]exp(#expr1)\r\n"
+L"factorial: #prec[H]factorial(#expr1)\r\n"
+L"factorof: #prec[30(900)]#expr1 % #expr2 == 0\r\n"
+L"floor: #prec[H]floor(#expr1)\r\n"
+L"gcd: #prec[H]gcd_multi(#count, #exprs[, ])\r\n"
+L"geq: #prec[30]#exprs[>=]\r\n"
+L"gt: #prec[30]#exprs[>]\r\n"
+L"implies: #prec[10(950)] !#expr1 || #expr2\r\n"
+L"int: #prec[H]defint(func#unique1, VOI, CONSTANTS, RATES, STATES, ALGEBRAIC, &#bvarIndex, #lowlimit, #uplimit, "
+L"failInfo)#supplement double func#unique1(double VOI, "
+L"double* CONSTANTS, double* RATES, double* STATES, double* ALGEBRAIC, struct fail_info* failInfo) { return #expr1; }\r\n"
+L"lcm: #prec[H]lcm_multi(#count, #exprs[, ])\r\n"
+L"leq: #prec[30]#exprs[<=]\r\n"
+L"ln: #prec[H]log(#expr1)\r\n"
+L"log: #prec[H]arbitrary_log(#expr1, #logbase)\r\n"
+L"lt: #prec[30]#exprs[<]\r\n"
+L"max: #prec[H]multi_max(#count, #exprs[, ])\r\n"
+L"min: #prec[H]multi_min(#count, #exprs[, ])\r\n"
+L"minus: #prec[500]#expr1 - #expr2\r\n"
+L"neq: #prec[30]#expr1 != #expr2\r\n"
+L"not: #prec[950]!#expr1\r\n"
+L"or: #prec[10]#exprs[||]\r\n"
+L"plus: #prec[500]#exprs[+]\r\n"
+L"power: #prec[H]pow(#expr1, #expr2)\r\n"
+L"quotient: #prec[1000(0)] (double)(((int)#expr2) == 0 ? #expr1 / 0.0 : (int)(#expr1) / (int)(#expr2))\r\n"
+L"rem: #prec[1000(0)] (double)(((int)#expr2) == 0 ? (#expr1) / 0.0 : (int)(#expr1) % (int)(#expr2))\r\n"
+L"root: #prec[1000(900)] pow(#expr1, 1.0 / #degree)\r\n"
+L"sec: #prec[900(0)]1.0 / cos(#expr1)\r\n"
+L"sech: #prec[900(0)]1.0 / cosh(#expr1)\r\n"
+L"sin: #prec[H] sin(#expr1)\r\n"
+L"sinh: #prec[H] sinh(#expr1)\r\n"
+L"tan: #prec[H] tan(#expr1)\r\n"
+L"tanh: #prec[H] tanh(#expr1)\r\n"
+L"times: #prec[900] #exprs[*]\r\n"
+L"unary_minus: #prec[950]- #expr1\r\n"
+L"units_conversion: #prec[500(900)]#expr1*#expr2 + #expr3\r\n"
+L"units_conversion_factor: #prec[900]#expr1*#expr2\r\n"
+L"units_conversion_offset: #prec[500]#expr1+#expr2\r\n"
+L"xor: #prec[25(30)] (#expr1 != 0) ^ (#expr2 != 0)\r\n"
+L"piecewise_first_case: #prec[1000(5)](#expr1 ? #expr2 : \r\n"
+L"piecewise_extra_case: #prec[1000(5)]#expr1 ? #expr2 : \r\n"
+L"piecewise_otherwise: #prec[1000(5)]#expr1)\r\n"
+L"piecewise_no_otherwise: #prec[1000(5)]0.0/0.0)\r\n"
+L"eulergamma: #prec[999]0.577215664901533\r\n"
+L"exponentiale: #prec[999]2.71828182845905\r\n"
+L"false: #prec[999]0.0\r\n"
+L"infinity: #prec[900]1.0/0.0\r\n"
+L"notanumber: #prec[999]0.0/0.0\r\n"
+L"pi: #prec[999] 3.14159265358979\r\n"
+L"true: #prec[999]1.0\r\n";
+
 void
 CDA_CellMLIntegrationService::SetupCodeGenStrings(iface::cellml_services::CodeGenerator* aCGS, bool aIsDebug)
 {
@@ -1062,7 +1911,9 @@ CDA_CellMLIntegrationService::SetupCodeGenStrings(iface::cellml_services::CodeGe
      L"void rootfind_<ID>(double VOI, double* CONSTANTS, double* RATES, "
      L"double* STATES, double* ALGEBRAIC, struct fail_info* failInfo)\r\n"
      L"{\r\n"
-     L"  static double val = <IV>;\r\n"
+     L"  double val = <VAR>;\r\n"
+     L"  if (val - val != 0.0)\r\n"
+     L"    val = <IV>;\r\n"
      L"  struct rootfind_info rfi;\r\n"
      L"  rfi.aVOI = VOI;\r\n"
      L"  rfi.aCONSTANTS = CONSTANTS;\r\n"
@@ -1088,6 +1939,9 @@ CDA_CellMLIntegrationService::SetupCodeGenStrings(iface::cellml_services::CodeGe
     L"#define failInfo rfi->aFail\r\n"
     L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
     L"  </EQUATIONS>\r\n"
+    L"#define FAIL_RETURN\r\n"
+    L"<TORN>"
+    L"#undef FAIL_RETURN\r\n"
     L"  <EQUATIONS>TryAssign(hx + <INDEX>, <EXPR>, \"<XMLID>\", rfi->aFail);<JOIN>\r\n"
     L"  </EQUATIONS>\r\n"
     L"#undef VOI\r\n"
@@ -1101,7 +1955,11 @@ CDA_CellMLIntegrationService::SetupCodeGenStrings(iface::cellml_services::CodeGe
     L"double* STATES, double* ALGEBRAIC, struct fail_info* failInfo)\r\n"
     L"{\r\n"
     L"  /* Solver for equations: <EQUATIONS><XMLID><JOIN>, </EQUATIONS> */\r\n"
-    L"  static double p[<COUNT>] = {<EQUATIONS><IV><JOIN>,</EQUATIONS>};\r\n"
+    L"  double p[<COUNT>];\r\n"
+    L"  <EQUATIONS>p[<INDEX>] = <VAR>;\r\n"
+    L"  if (p[<INDEX>] - p[<INDEX>] != 0.0)\r\n"
+    L"    p[<INDEX>] = <IV>;<JOIN>\r\n"
+    L"  </EQUATIONS>\r\n"
     L"  struct rootfind_info rfi;\r\n"
     L"  rfi.aVOI = VOI;\r\n"
     L"  rfi.aCONSTANTS = CONSTANTS;\r\n"
@@ -1112,6 +1970,9 @@ CDA_CellMLIntegrationService::SetupCodeGenStrings(iface::cellml_services::CodeGe
     L"  do_nonlinearsolve(objfunc_<ID>, p, failInfo, <COUNT>, &rfi);\r\n"
     L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
     L"  </EQUATIONS>\r\n"
+    L"#define FAIL_RETURN\r\n"
+    L"<TORN>"
+    L"#undef FAIL_RETURN\r\n"
     L"}\r\n"
     );
   aCGS->conditionalAssignmentPattern
@@ -1250,7 +2111,9 @@ L"true: #prec[H]CreateEDouble(1.0)\r\n"
      L"void rootfind_<ID>(double VOI, double* CONSTANTS, double* RATES, "
      L"double* STATES, double* ALGEBRAIC, struct fail_info* failInfo)\r\n"
      L"{\r\n"
-     L"  static double val = <IV>;\r\n"
+     L"  double val = <VAR>;\r\n"
+     L"  if (val - val != 0.0)\r\n"
+     L"    val = <IV>;\r\n"
      L"  struct rootfind_info rfi;\r\n"
      L"  rfi.aVOI = VOI;\r\n"
      L"  rfi.aCONSTANTS = CONSTANTS;\r\n"
@@ -1277,6 +2140,9 @@ L"true: #prec[H]CreateEDouble(1.0)\r\n"
        L"#define failInfo rfi->aFail\r\n"
        L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
        L"  </EQUATIONS>\r\n"
+       L"#define FAIL_RETURN\r\n"
+       L"<TORN>"
+       L"#undef FAIL_RETURN\r\n"
        L"  <EQUATIONS>hx[<INDEX>] = <EXPR>;<JOIN>\r\n"
        L"  </EQUATIONS>\r\n"
        L"#undef VOI\r\n"
@@ -1290,7 +2156,11 @@ L"true: #prec[H]CreateEDouble(1.0)\r\n"
        L"double* STATES, double* ALGEBRAIC, struct fail_info* failInfo)\r\n"
        L"{\r\n"
        L"  /* Solver for equations: <EQUATIONS><XMLID><JOIN>, </EQUATIONS> */\r\n"
-       L"  static double p[<COUNT>] = {<EQUATIONS><IV><JOIN>,</EQUATIONS>};\r\n"
+       L"  double p[<COUNT>];\r\n"
+    L"  <EQUATIONS>p[<INDEX>] = <VAR>;\r\n"
+    L"  if (p[<INDEX>] - p[<INDEX>] != 0.0)\r\n"
+    L"    p[<INDEX>] = <IV>;<JOIN>\r\n"
+    L"  </EQUATIONS>\r\n"
        L"  struct rootfind_info rfi;\r\n"
        L"  rfi.aVOI = VOI;\r\n"
        L"  rfi.aCONSTANTS = CONSTANTS;\r\n"
@@ -1301,110 +2171,27 @@ L"true: #prec[H]CreateEDouble(1.0)\r\n"
        L"  do_nonlinearsolve(objfunc_<ID>, p, failInfo, <COUNT>, &rfi);\r\n"
        L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
        L"  </EQUATIONS>\r\n"
+       L"#define FAIL_RETURN\r\n"
+       L"<TORN>"
+       L"#undef FAIL_RETURN\r\n"
        L"}\r\n"
        );
     aCGS->assignConstantPattern(L"OverrideAssign(&(<LHS>), <RHS>, OVERRIDES);\r\n");
     aCGS->assignPattern(L"<LHS>= <RHS>;\r\n");
     ObjRef<iface::cellml_services::MaLaESTransform> transform
-      (
-       mb->compileTransformer(
-L"opengroup: (\r\n"
-L"closegroup: )\r\n"
-L"abs: #prec[H]fabs(#expr1)\r\n"
-L"and: #prec[20]#exprs[&&]\r\n"
-L"arccos: #prec[H]acos(#expr1)\r\n"
-L"arccosh: #prec[H]acosh(#expr1)\r\n"
-L"arccot: #prec[1000(900)]atan(1.0/#expr1)\r\n"
-L"arccoth: #prec[1000(900)]atanh(1.0/#expr1)\r\n"
-L"arccsc: #prec[1000(900)]asin(1/#expr1)\r\n"
-L"arccsch: #prec[1000(900)]asinh(1/#expr1)\r\n"
-L"arcsec: #prec[1000(900)]acos(1/#expr1)\r\n"
-L"arcsech: #prec[1000(900)]acosh(1/#expr1)\r\n"
-L"arcsin: #prec[H]asin(#expr1)\r\n"
-L"arcsinh: #prec[H]asinh(#expr1)\r\n"
-L"arctan: #prec[H]atan(#expr1)\r\n"
-L"arctanh: #prec[H]atanh(#expr1)\r\n"
-L"ceiling: #prec[H]ceil(#expr1)\r\n"
-L"cos: #prec[H]cos(#expr1)\r\n"
-L"cosh: #prec[H]cosh(#expr1)\r\n"
-L"cot: #prec[900(0)]1.0/tan(#expr1)\r\n"
-L"coth: #prec[900(0)]1.0/tanh(#expr1)\r\n"
-L"csc: #prec[900(0)]1.0/sin(#expr1)\r\n"
-L"csch: #prec[900(0)]1.0/sinh(#expr1)\r\n"
-L"diff: #lookupDiffVariable\r\n"
-L"divide: #prec[900]#expr1/#expr2\r\n"
-L"eq: #prec[30]#exprs[==]\r\n"
-L"exp: #prec[H]exp(#expr1)\r\n"
-L"factorial: #prec[H]factorial(#expr1)\r\n"
-L"factorof: #prec[30(900)]#expr1 % #expr2 == 0\r\n"
-L"floor: #prec[H]floor(#expr1)\r\n"
-L"gcd: #prec[H]gcd_multi(#count, #exprs[, ])\r\n"
-L"geq: #prec[30]#exprs[>=]\r\n"
-L"gt: #prec[30]#exprs[>]\r\n"
-L"implies: #prec[10(950)] !#expr1 || #expr2\r\n"
-L"int: #prec[H]defint(func#unique1, VOI, CONSTANTS, RATES, STATES, ALGEBRAIC, &#bvarIndex, #lowlimit, #uplimit, "
-L"failInfo)#supplement double func#unique1(double VOI, "
-L"double* CONSTANTS, double* RATES, double* STATES, double* ALGEBRAIC, struct fail_info* failInfo) { return #expr1; }\r\n"
-L"lcm: #prec[H]lcm_multi(#count, #exprs[, ])\r\n"
-L"leq: #prec[30]#exprs[<=]\r\n"
-L"ln: #prec[H]log(#expr1)\r\n"
-L"log: #prec[H]arbitrary_log(#expr1, #logbase)\r\n"
-L"lt: #prec[30]#exprs[<]\r\n"
-L"max: #prec[H]multi_max(#count, #exprs[, ])\r\n"
-L"min: #prec[H]multi_min(#count, #exprs[, ])\r\n"
-L"minus: #prec[500]#expr1 - #expr2\r\n"
-L"neq: #prec[30]#expr1 != #expr2\r\n"
-L"not: #prec[950]!#expr1\r\n"
-L"or: #prec[10]#exprs[||]\r\n"
-L"plus: #prec[500]#exprs[+]\r\n"
-L"power: #prec[H]pow(#expr1, #expr2)\r\n"
-L"quotient: #prec[1000(0)] (double)(((int)#expr2) == 0 ? #expr1 / 0.0 : (int)(#expr1) / (int)(#expr2))\r\n"
-L"rem: #prec[1000(0)] (double)(((int)#expr2) == 0 ? (#expr1) / 0.0 : (int)(#expr1) % (int)(#expr2))\r\n"
-L"root: #prec[1000(900)] pow(#expr1, 1.0 / #degree)\r\n"
-L"sec: #prec[900(0)]1.0 / cos(#expr1)\r\n"
-L"sech: #prec[900(0)]1.0 / cosh(#expr1)\r\n"
-L"sin: #prec[H] sin(#expr1)\r\n"
-L"sinh: #prec[H] sinh(#expr1)\r\n"
-L"tan: #prec[H] tan(#expr1)\r\n"
-L"tanh: #prec[H] tanh(#expr1)\r\n"
-L"times: #prec[900] #exprs[*]\r\n"
-L"unary_minus: #prec[950]- #expr1\r\n"
-L"units_conversion: #prec[500(900)]#expr1*#expr2 + #expr3\r\n"
-L"units_conversion_factor: #prec[900]#expr1*#expr2\r\n"
-L"units_conversion_offset: #prec[500]#expr1+#expr2\r\n"
-L"xor: #prec[25(30)] (#expr1 != 0) ^ (#expr2 != 0)\r\n"
-L"piecewise_first_case: #prec[1000(5)](#expr1 ? #expr2 : \r\n"
-L"piecewise_extra_case: #prec[1000(5)]#expr1 ? #expr2 : \r\n"
-L"piecewise_otherwise: #prec[1000(5)]#expr1)\r\n"
-L"piecewise_no_otherwise: #prec[1000(5)]0.0/0.0)\r\n"
-L"eulergamma: #prec[999]0.577215664901533\r\n"
-L"exponentiale: #prec[999]2.71828182845905\r\n"
-L"false: #prec[999]0.0\r\n"
-L"infinity: #prec[900]1.0/0.0\r\n"
-L"notanumber: #prec[999]0.0/0.0\r\n"
-L"pi: #prec[999] 3.14159265358979\r\n"
-L"true: #prec[999]1.0\r\n"
-                            )
-    );
+      (mb->compileTransformer(sCTransform));
     aCGS->transform(transform);
   }
 }
 
-already_AddRefd<iface::cellml_services::ODESolverCompiledModel>
-CDA_CellMLIntegrationService::compileModelODEInternal
+already_AddRefd<iface::cellml_services::CodeInformation>
+CDA_CellMLIntegrationService::GenerateODECode
 (
- iface::cellml_api::Model* aModel,
- bool aIsDebug
+ iface::cellml_services::CodeGenerator* cg,
+ iface::cellml_api::Model* aModel
 )
   throw(std::exception&)
 {
-  RETURN_INTO_OBJREF(cgb, iface::cellml_services::CodeGeneratorBootstrap,
-                     CreateCodeGeneratorBootstrap());
-  RETURN_INTO_OBJREF(cg, iface::cellml_services::CodeGenerator,
-                     cgb->createCodeGenerator());
-
-  SetupCodeGenStrings(cg, aIsDebug);
-
   // Generate code information...
   ObjRef<iface::cellml_services::CodeInformation> cci;
   try
@@ -1425,11 +2212,17 @@ CDA_CellMLIntegrationService::compileModelODEInternal
     throw iface::cellml_api::CellMLException(L"Unexpected exception generating code");
   }
 
-  std::ofstream ss;
-
-  std::string dirname, sourcename;
-  setupCodeEnvironment(cci, dirname, sourcename, ss);
+  cci->add_ref();
+  return cci.getPointer();
+}
 
+void
+CDA_CellMLIntegrationService::WriteODEFunctions
+(
+ iface::cellml_services::CodeInformation* cci,
+ std::ostream& ss
+)
+{
   ss << "void SetupConstants(double* CONSTANTS, double* RATES, "
     "double *STATES, struct Override* OVERRIDES, struct fail_info* failInfo)" << std::endl;
   std::wstring frag = cci->initConstsString();
@@ -1472,15 +2265,271 @@ CDA_CellMLIntegrationService::compileModelODEInternal
      << "#undef FAIL_RETURN" << std::endl
      << "}" << std::endl;
   delete [] frag8;
+}
 
-  ss.close();
+already_AddRefd<iface::cellml_services::ODESolverCompiledModel>
+CDA_CellMLIntegrationService::compileModelODEInternal
+(
+ iface::cellml_api::Model* aModel,
+ bool aIsDebug
+)
+  throw(std::exception&)
+{
+  RETURN_INTO_OBJREF(cgb, iface::cellml_services::CodeGeneratorBootstrap,
+                     CreateCodeGeneratorBootstrap());
+  RETURN_INTO_OBJREF(cg, iface::cellml_services::CodeGenerator,
+                     cgb->createCodeGenerator());
+
+  SetupCodeGenStrings(cg, aIsDebug);
+  RETURN_INTO_OBJREF(cci, iface::cellml_services::CodeInformation,
+                     GenerateODECode(cg, aModel));
+
+  std::ostringstream ss;
+  setupCodeEnvironment(cci, ss);
+  WriteODEFunctions(cci, ss);
 
-  CompiledModule* mod = CompileSource(dirname, sourcename, mLastError);
+  std::string dirname;
+  CompiledModule* mod = CompileSource(ss.str(), dirname, mLastError);
   CompiledModelFunctions* cmf = SetupCompiledModelFunctions(mod);
   
   return new CDA_ODESolverModel(mod, cmf, aModel, cci, dirname);
 }
 
+void
+CDA_CellMLIntegrationService::SetupVectorisedCodeGenStrings
+(
+ iface::cellml_services::CodeGenerator* aCGS
+)
+{
+  SetupCodeGenStrings(aCGS, false);
+
+  // Every array is laid out structure-of-arrays, and the kernel body is the
+  // inside of a loop over lane. Supplementary functions are prefixed with v
+  // so they don't clash with those of the single-instance code in the same
+  // file. They are passed arrays already offset to their lane, so lane is
+  // zero inside them.
+  aCGS->constantPattern(L"CONSTANTS[%*LANES+lane]");
+  aCGS->stateVariableNamePattern(L"STATES[%*LANES+lane]");
+  aCGS->algebraicVariableNamePattern(L"ALGEBRAIC[%*LANES+lane]");
+  aCGS->rateNamePattern(L"RATES[%*LANES+lane]");
+
+  aCGS->sampleDensityFunctionPattern
+    (
+     L"SampleUsingPDF(&vpdf_<ID>, <ROOTCOUNT>, vpdf_roots_<ID>, CONSTANTS + lane, ALGEBRAIC + lane, failInfo)"
+     L"<SUP>double vpdf_<ID>(double bvar, double* CONSTANTS, double* ALGEBRAIC, struct fail_info* failInfo)\r\n"
+     L"{\r\nconst int lane = 0;\r\nreturn (<EXPR>);\r\n}\r\n"
+     L"double (*vpdf_roots_<ID>[])(double bvar, double*, double*, struct fail_info* failInfo) = "
+     L"{<FOREACH_ROOT>vpdf_<ID>_root_<ROOTID>,<ROOTSUP>double vpdf_<ID>_root_<ROOTID>"
+     L"(double bvar, double* CONSTANTS, double* ALGEBRAIC)\r\n"
+     L"{\r\nconst int lane = 0;\r\nreturn (<EXPR>);\r\n}\r\n</FOREACH_ROOT>};\r\n");
+  aCGS->solvePattern
+    (
+     L"vrootfind_<ID>(VOI, CONSTANTS + lane, RATES + lane, STATES + lane, ALGEBRAIC + lane, failInfo);\r\n"
+     L"<SUP>"
+     L"void vobjfunc_<ID>(double* p, double* hx, void *adata)\r\n"
+     L"{\r\n"
+     L"  /* Solver for equation: <XMLID> */\r\n"
+     L"  struct rootfind_info* rfi = (struct rootfind_info*)adata;\r\n"
+     L"  const int lane = 0;\r\n"
+     L"#define VOI rfi->aVOI\r\n"
+     L"#define CONSTANTS rfi->aCONSTANTS\r\n"
+     L"#define RATES rfi->aRATES\r\n"
+     L"#define STATES rfi->aSTATES\r\n"
+     L"#define ALGEBRAIC rfi->aALGEBRAIC\r\n"
+     L"  <VAR> = *p;\r\n"
+     L"  *hx = (<LHS>) - (<RHS>);\r\n"
+     L"#undef VOI\r\n"
+     L"#undef CONSTANTS\r\n"
+     L"#undef RATES\r\n"
+     L"#undef STATES\r\n"
+     L"#undef ALGEBRAIC\r\n"
+     L"}\r\n"
+     L"void vrootfind_<ID>(double VOI, double* CONSTANTS, double* RATES, "
+     L"double* STATES, double* ALGEBRAIC, struct fail_info* failInfo)\r\n"
+     L"{\r\n"
+     L"  const int lane = 0;\r\n"
+     L"  double val = <VAR>;\r\n"
+     L"  if (val - val != 0.0)\r\n"
+     L"    val = <IV>;\r\n"
+     L"  struct rootfind_info rfi;\r\n"
+     L"  rfi.aVOI = VOI;\r\n"
+     L"  rfi.aCONSTANTS = CONSTANTS;\r\n"
+     L"  rfi.aRATES = RATES;\r\n"
+     L"  rfi.aSTATES = STATES;\r\n"
+     L"  rfi.aALGEBRAIC = ALGEBRAIC;\r\n"
+     L"  rfi.aFail = failInfo;\r\n"
+     L"  do_nonlinearsolve(vobjfunc_<ID>, &val, failInfo, 1, &rfi);\r\n"
+     L"  <VAR> = val;\r\n"
+     L"}\r\n"
+     );
+  aCGS->solveNLSystemPattern
+    (
+     L"vrootfind_<ID>(VOI, CONSTANTS + lane, RATES + lane, STATES + lane, ALGEBRAIC + lane, failInfo);\r\n"
+     L"<SUP>"
+     L"void vobjfunc_<ID>(double* p, double* hx, void *adata)\r\n"
+     L"{\r\n"
+     L"  struct rootfind_info* rfi = (struct rootfind_info*)adata;\r\n"
+     L"  const int lane = 0;\r\n"
+     L"#define VOI rfi->aVOI\r\n"
+     L"#define CONSTANTS rfi->aCONSTANTS\r\n"
+     L"#define RATES rfi->aRATES\r\n"
+     L"#define STATES rfi->aSTATES\r\n"
+     L"#define ALGEBRAIC rfi->aALGEBRAIC\r\n"
+     L"#define failInfo rfi->aFail\r\n"
+     L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
+     L"  </EQUATIONS>\r\n"
+     L"#define FAIL_RETURN\r\n"
+     L"<TORN>"
+     L"#undef FAIL_RETURN\r\n"
+     L"  <EQUATIONS>hx[<INDEX>] = <EXPR>;<JOIN>\r\n"
+     L"  </EQUATIONS>\r\n"
+     L"#undef VOI\r\n"
+     L"#undef CONSTANTS\r\n"
+     L"#undef RATES\r\n"
+     L"#undef STATES\r\n"
+     L"#undef ALGEBRAIC\r\n"
+     L"#undef failInfo\r\n"
+     L"}\r\n"
+     L"void vrootfind_<ID>(double VOI, double* CONSTANTS, double* RATES, "
+     L"double* STATES, double* ALGEBRAIC, struct fail_info* failInfo)\r\n"
+     L"{\r\n"
+     L"  /* Solver for equations: <EQUATIONS><XMLID><JOIN>, </EQUATIONS> */\r\n"
+     L"  const int lane = 0;\r\n"
+     L"  double p[<COUNT>];\r\n"
+    L"  <EQUATIONS>p[<INDEX>] = <VAR>;\r\n"
+    L"  if (p[<INDEX>] - p[<INDEX>] != 0.0)\r\n"
+    L"    p[<INDEX>] = <IV>;<JOIN>\r\n"
+    L"  </EQUATIONS>\r\n"
+     L"  struct rootfind_info rfi;\r\n"
+     L"  rfi.aVOI = VOI;\r\n"
+     L"  rfi.aCONSTANTS = CONSTANTS;\r\n"
+     L"  rfi.aRATES = RATES;\r\n"
+     L"  rfi.aSTATES = STATES;\r\n"
+     L"  rfi.aALGEBRAIC = ALGEBRAIC;\r\n"
+     L"  rfi.aFail = failInfo;\r\n"
+     L"  do_nonlinearsolve(vobjfunc_<ID>, p, failInfo, <COUNT>, &rfi);\r\n"
+     L"  <EQUATIONS><VAR> = p[<INDEX>];<JOIN>\r\n"
+     L"  </EQUATIONS>\r\n"
+     L"#define FAIL_RETURN\r\n"
+     L"<TORN>"
+     L"#undef FAIL_RETURN\r\n"
+     L"}\r\n"
+     );
+
+  // The definite integral rule passes its variables on to a supplementary
+  // function, so needs the same lane offset as the solvers.
+  std::wstring mal(sCTransform);
+  size_t intStart = mal.find(L"int: ");
+  size_t intEnd = mal.find(L"\r\n", intStart) + 2;
+  mal.replace(intStart, intEnd - intStart,
+              L"int: #prec[H]defint(vfunc#unique1, VOI, CONSTANTS + lane, "
+              L"RATES + lane, STATES + lane, ALGEBRAIC + lane, &#bvarIndex, "
+              L"#lowlimit, #uplimit, failInfo)#supplement double vfunc#unique1"
+              L"(double VOI, double* CONSTANTS, double* RATES, double* STATES, "
+              L"double* ALGEBRAIC, struct fail_info* failInfo) "
+              L"{ const int lane = 0; return #expr1; }\r\n");
+
+  ObjRef<iface::cellml_services::MaLaESBootstrap> mb(CreateMaLaESBootstrap());
+  ObjRef<iface::cellml_services::MaLaESTransform> transform
+    (mb->compileTransformer(mal));
+  aCGS->transform(transform);
+}
+
+already_AddRefd<iface::cellml_services::VectorisedODESolverCompiledModel>
+CDA_CellMLIntegrationService::compileVectorisedModelODE
+(
+ iface::cellml_api::Model* aModel,
+ uint32_t aLaneCount
+)
+  throw(std::exception&)
+{
+  if (aLaneCount == 0)
+  {
+    mLastError = L"laneCount must be at least 1.";
+    throw iface::cellml_api::CellMLException(mLastError);
+  }
+
+  RETURN_INTO_OBJREF(cgb, iface::cellml_services::CodeGeneratorBootstrap,
+                     CreateCodeGeneratorBootstrap());
+  RETURN_INTO_OBJREF(cg, iface::cellml_services::CodeGenerator,
+                     cgb->createCodeGenerator());
+  RETURN_INTO_OBJREF(vcg, iface::cellml_services::CodeGenerator,
+                     cgb->createCodeGenerator());
+
+  // The single-instance code sets up each member's constants and initial
+  // conditions; the kernels then integrate laneCount members at once.
+  SetupCodeGenStrings(cg, false);
+  SetupVectorisedCodeGenStrings(vcg);
+  RETURN_INTO_OBJREF(cci, iface::cellml_services::CodeInformation,
+                     GenerateODECode(cg, aModel));
+  RETURN_INTO_OBJREF(vcci, iface::cellml_services::CodeInformation,
+                     GenerateODECode(vcg, aModel));
+
+  if (cci->constantIndexCount() != vcci->constantIndexCount() ||
+      cci->rateIndexCount() != vcci->rateIndexCount() ||
+      cci->algebraicIndexCount() != vcci->algebraicIndexCount())
+  {
+    mLastError = L"Vectorised code does not match the single-instance code.";
+    throw iface::cellml_api::CellMLException(mLastError);
+  }
+
+  std::ostringstream ss;
+  setupCodeEnvironment(cci, ss);
+  WriteODEFunctions(cci, ss);
+
+  ss << "#define LANES " << aLaneCount << std::endl;
+  std::wstring frag = vcci->functionsString();
+  size_t fragLen = wcstombs(NULL, frag.c_str(), 0) + 1;
+  char* frag8 = new char[fragLen];
+  wcstombs(frag8, frag.c_str(), fragLen);
+  ss << frag8 << std::endl;
+  delete [] frag8;
+
+  ss << "void ComputeRatesVectorised(double VOI, double* CONSTANTS, "
+     << "double* RATES, double* STATES, double* ALGEBRAIC, "
+     << "struct fail_info* failInfo)" << std::endl;
+  frag = vcci->ratesString();
+  fragLen = wcstombs(NULL, frag.c_str(), 0) + 1;
+  frag8 = new char[fragLen];
+  wcstombs(frag8, frag.c_str(), fragLen);
+  ss << "{" << std::endl
+     << "  int lane;" << std::endl
+     << "#define FAIL_RETURN" << std::endl
+     << "  for (lane = 0; lane < LANES; lane++)" << std::endl
+     << "  {" << std::endl
+     << frag8 << std::endl
+     << "  }" << std::endl
+     << "#undef FAIL_RETURN" << std::endl
+     << "}" << std::endl;
+  delete [] frag8;
+
+  ss << "void ComputeVariablesVectorised(double VOI, double* CONSTANTS, "
+     << "double* RATES, double* STATES, double* ALGEBRAIC, "
+     << "struct fail_info* failInfo)" << std::endl;
+  frag = vcci->variablesString();
+  fragLen = wcstombs(NULL, frag.c_str(), 0) + 1;
+  frag8 = new char[fragLen];
+  wcstombs(frag8, frag.c_str(), fragLen);
+  ss << "{" << std::endl
+     << "  int lane;" << std::endl
+     << "#define FAIL_RETURN" << std::endl
+     << "  for (lane = 0; lane < LANES; lane++)" << std::endl
+     << "  {" << std::endl
+     << frag8 << std::endl
+     << "  }" << std::endl
+     << "#undef FAIL_RETURN" << std::endl
+     << "}" << std::endl;
+  delete [] frag8;
+
+  std::string dirname;
+  CompiledModule* mod = CompileSource(ss.str(), dirname, mLastError);
+  CompiledModelFunctions* cmf = SetupCompiledModelFunctions(mod);
+  VectorisedModelFunctions* vmf = SetupVectorisedModelFunctions(mod);
+
+  return new CDA_VectorisedODESolverModel(mod, cmf, vmf, aLaneCount, aModel,
+                                          cci, dirname);
+}
+
 already_AddRefd<iface::cellml_services::DAESolverCompiledModel>
 CDA_CellMLIntegrationService::compileModelDAE
 (
@@ -1535,10 +2584,8 @@ CDA_CellMLIntegrationService::compileModelDAEInternal
     throw iface::cellml_api::CellMLException(L"Unexpected exception generating code");
   }
 
-  std::ofstream ss;
-
-  std::string dirname, sourcename;
-  setupCodeEnvironment(cci, dirname, sourcename, ss);
+  std::ostringstream ss;
+  setupCodeEnvironment(cci, ss);
 
   ss << "void SetupFixedConstants(double* CONSTANTS, double* RATES, "
     "double *STATES, double *ALGEBRAIC, struct Override* OVERRIDES, "
@@ -1621,9 +2668,8 @@ CDA_CellMLIntegrationService::compileModelDAEInternal
      << "}" << std::endl;
   delete [] frag8;
 
-  ss.close();
-
-  CompiledModule* mod = CompileSource(dirname, sourcename, mLastError);
+  std::string dirname;
+  CompiledModule* mod = CompileSource(ss.str(), dirname, mLastError);
   IDACompiledModelFunctions* cmf = SetupIDACompiledModelFunctions(mod);
   
   return new CDA_DAESolverModel(mod, cmf, aModel, cci, dirname);
@@ -1649,6 +2695,81 @@ CDA_CellMLIntegrationService::createDAEIntegrationRun
   return new CDA_DAESolverRun(unsafe_dynamic_cast<CDA_DAESolverModel*>(aModel));
 }
 
+already_AddRefd<iface::cellml_services::ODEEnsembleRun>
+CDA_CellMLIntegrationService::createODEEnsembleRun
+(
+ iface::cellml_services::ODESolverCompiledModel* aModel
+)
+  throw (std::exception&)
+{
+  return new CDA_ODEEnsembleRun(unsafe_dynamic_cast<CDA_ODESolverModel*>(aModel));
+}
+
+already_AddRefd<iface::cellml_services::ODEEnsembleRun>
+CDA_CellMLIntegrationService::createLockStepEnsembleRun
+(
+ iface::cellml_services::VectorisedODESolverCompiledModel* aModel
+)
+  throw (std::exception&)
+{
+  return new CDA_LockStepEnsembleRun
+    (unsafe_dynamic_cast<CDA_VectorisedODESolverModel*>(aModel));
+}
+
+CDA_CellMLIntegrationService::CDA_CellMLIntegrationService()
+  :
+#ifdef ENABLE_CLANG
+    mCompilerBackend(iface::cellml_services::COMPILER_JIT)
+#else
+    mCompilerBackend(iface::cellml_services::COMPILER_EXTERNAL)
+#endif
+#ifdef ENABLE_CONTEXT
+  , mUnload(NULL)
+#endif
+{
+  const char* cacheDir = getenv("CELLML_CIS_CACHE_DIR");
+  if (cacheDir != NULL)
+  {
+    size_t l = mbstowcs(NULL, cacheDir, 0) + 1;
+    wchar_t* cacheDirW = new wchar_t[l];
+    mbstowcs(cacheDirW, cacheDir, l);
+    mCacheDirectory = cacheDirW;
+    delete [] cacheDirW;
+  }
+}
+
+iface::cellml_services::CompilerBackend
+CDA_CellMLIntegrationService::compilerBackend()
+  throw (std::exception&)
+{
+  return mCompilerBackend;
+}
+
+void
+CDA_CellMLIntegrationService::compilerBackend
+(
+ iface::cellml_services::CompilerBackend aBackend
+)
+  throw (std::exception&)
+{
+#ifndef ENABLE_CLANG
+  if (aBackend == iface::cellml_services::COMPILER_JIT)
+    throw iface::cellml_api::CellMLException(L"This CellML Integration Service was built without an in-process compiler.");
+#endif
+  mCompilerBackend = aBackend;
+}
+
+bool
+CDA_CellMLIntegrationService::jitAvailable()
+  throw (std::exception&)
+{
+#ifdef ENABLE_CLANG
+  return true;
+#else
+  return false;
+#endif
+}
+
 already_AddRefd<iface::cellml_services::CellMLIntegrationService>
 CreateIntegrationService()
 {
@@ -1,6 +1,7 @@
 #include "IfaceCCGS.hxx"
 #include "IfaceCIS.hxx"
 #include <string>
+#include <ostream>
 #include "cda_compiler_support.h"
 
 #undef ENABLE_CONTEXT
@@ -11,6 +12,7 @@ extern void UnloadCIS(void);
 #endif
 
 class CompiledModule;
+class CVODEWorkspace;
 
 // This is used opaquely from generated C code, which uses the C API to fail_info
 // below.
@@ -36,6 +38,16 @@ struct CompiledModelFunctions
                           double* STATES, double* ALGEBRAIC, struct fail_info*);
 };
 
+// Structure-of-arrays kernels from a vectorised model. Each call evaluates
+// every lane.
+struct VectorisedModelFunctions
+{
+  void (*ComputeRates)(double VOI, double* CONSTANTS, double* RATES,
+                       double* STATES, double* ALGEBRAIC, struct fail_info*);
+  void (*ComputeVariables)(double VOI, double* CONSTANTS, double* RATES,
+                           double* STATES, double* ALGEBRAIC, struct fail_info*);
+};
+
 struct IDACompiledModelFunctions
 {
   void (*SetupFixedConstants)(double* CONSTANTS, double* RATES, double *STATES,
@@ -117,6 +129,36 @@ public:
   CompiledModelFunctions* mCMF;
 };
 
+class CDA_VectorisedODESolverModel
+  : public CDA_ODESolverModel,
+    public iface::cellml_services::VectorisedODESolverCompiledModel
+{
+public:
+  CDA_VectorisedODESolverModel
+  (
+   CompiledModule* aModule, CompiledModelFunctions* aCMF,
+   VectorisedModelFunctions* aVMF, uint32_t aLaneCount,
+   iface::cellml_api::Model* aModel,
+   iface::cellml_services::CodeInformation* aCCI,
+   std::string& aDirname
+  )
+    : CDA_ODESolverModel(aModule, aCMF, aModel, aCCI, aDirname), mVMF(aVMF),
+      mLaneCount(aLaneCount)
+  {}
+
+  ~CDA_VectorisedODESolverModel() { delete mVMF; }
+
+  CDA_IMPL_QI2(cellml_services::CellMLCompiledModel, cellml_services::VectorisedODESolverCompiledModel);
+
+  uint32_t laneCount() throw(std::exception&)
+  {
+    return mLaneCount;
+  }
+
+  VectorisedModelFunctions* mVMF;
+  uint32_t mLaneCount;
+};
+
 class CDA_DAESolverModel
   : public CDA_CellMLCompiledModel
 {
@@ -168,11 +210,19 @@ public:
   void setOverride(iface::cellml_services::VariableEvaluationType aType,
                    uint32_t variableIndex, double newValue)
     throw (std::exception&);
+  void setResultBatching(uint32_t aRowsPerBatch, double aBatchInterval)
+    throw (std::exception&);
+  iface::cellml_services::LinearSolverType linearSolver()
+    throw (std::exception&);
+  void linearSolver(iface::cellml_services::LinearSolverType aLinearSolver)
+    throw (std::exception&);
   void start() throw (std::exception&);
   void stop() throw (std::exception&);
   void pause() throw (std::exception&);
   void resume() throw (std::exception&);
 
+  bool checkPauseOrCancellation();
+
 protected:
   virtual void runthread() = 0;
 
@@ -193,8 +243,76 @@ protected:
   OverrideList mConstantOverrides, mIVOverrides;
   bool mCancelIntegration, mPauseIntegration;
   bool mStrictTabulation;
+  uint32_t mRowsPerBatch;
+  double mBatchInterval;
+  iface::cellml_services::LinearSolverType mLinearSolver;
+};
 
-  bool checkPauseOrCancellation();
+// Receives result rows from an integration. Solvers write each row straight
+// into the sink's current batch (beginRow, then commitRow), and the batch is
+// sent on once it holds rowsPerBatch rows or batchInterval seconds have passed
+// since it was started.
+class ResultSink
+{
+public:
+  ResultSink(uint32_t aRowSize, uint32_t aRowsPerBatch, double aBatchInterval);
+  virtual ~ResultSink() {}
+
+  double* beginRow() { return mRows + mUsed; }
+  void commitRow();
+  void flush();
+  virtual bool stopRequested() = 0;
+
+protected:
+  // Sends the first aLength values of the current batch on, and returns the
+  // storage to use for the next batch.
+  virtual double* sendBatch(uint32_t aLength) = 0;
+
+  uint32_t mRowSize, mCapacity, mUsed;
+  double* mRows;
+  double mBatchInterval, mBatchStart;
+  uint32_t mRowsToClockCheck;
+};
+
+class ResultRingDelivery;
+class WakeSignal;
+class LaneFallback;
+
+// Passes batches of results to an IntegrationProgressObserver from a thread of
+// its own, so the solver carries on while the observer handles them. Batches
+// live in a ring of preallocated blocks, which are handed to the observer
+// without copying. The solver only waits if every block is still waiting to
+// be delivered. The destructor sends any remaining rows and waits for them to
+// be delivered.
+class ResultRing
+  : public ResultSink
+{
+  friend class ResultRingDelivery;
+public:
+  ResultRing(CDA_CellMLIntegrationRun* aRun,
+             iface::cellml_services::IntegrationProgressObserver* aObserver,
+             uint32_t aRowSize, uint32_t aRowsPerBatch, double aBatchInterval);
+  ~ResultRing();
+
+  bool stopRequested();
+
+protected:
+  double* sendBatch(uint32_t aLength);
+
+private:
+  void deliver();
+
+  CDA_CellMLIntegrationRun* mRun;
+  iface::cellml_services::IntegrationProgressObserver* mObserver;
+  ResultRingDelivery* mDelivery;
+  std::vector<double>* mBlocks;
+  // The solver fills block mHead % RING_BLOCKS; blocks mTail up to mHead have
+  // been filled and are waiting for delivery. Each is only written by one side.
+  volatile uint32_t mHead, mTail;
+  // These are only used when one side has to sleep.
+  CDAMutex mWaitMutex;
+  bool mFinished, mDeliveryWaiting, mSolverWaiting;
+  WakeSignal* mDataSignal, * mSpaceSignal, * mDrainedSignal;
 };
 
 class CDA_ODESolverRun
@@ -215,9 +333,152 @@ protected:
   void SolveODEProblemCVODE(CompiledModelFunctions* f, uint32_t constSize,
                        double* constants, uint32_t rateSize, double* rates,
                        double* states, uint32_t algSize, double* algebraic);
+  CVODEWorkspace* CreateCVODEWorkspace
+    (iface::cellml_services::ODEIntegrationStepType aStepType,
+     uint32_t rateSize, double* states);
+  void DestroyCVODEWorkspace(CVODEWorkspace* aWorkspace);
+  void IntegrateCVODE(CVODEWorkspace* ws, CompiledModelFunctions* f,
+                      double* constants, uint32_t rateSize, double* rates,
+                      double* states, uint32_t algSize, double* algebraic,
+                      ResultSink* sink, struct fail_info& failInfo);
+  void AttachCVODELinearSolver(CVODEWorkspace* ws, uint32_t rateSize);
   void runthread();
 };
 
+class CDA_ODEEnsembleRun
+  : public CDA_ODESolverRun,
+    public iface::cellml_services::ODEEnsembleRun
+{
+  friend class EnsembleWorker;
+  friend class EnsembleResultSink;
+public:
+  CDA_ODEEnsembleRun(CDA_ODESolverModel* m);
+  ~CDA_ODEEnsembleRun();
+
+  CDA_IMPL_QI1(cellml_services::ODEEnsembleRun);
+
+  // These are declared by both CellMLIntegrationRun and ODEEnsembleRun, so
+  // need an overrider here.
+  iface::cellml_services::ODEIntegrationStepType stepType()
+    throw (std::exception&)
+  {
+    return CDA_CellMLIntegrationRun::stepType();
+  }
+
+  void stepType(iface::cellml_services::ODEIntegrationStepType ist)
+    throw (std::exception&)
+  {
+    CDA_CellMLIntegrationRun::stepType(ist);
+  }
+
+  void setStepSizeControl(double epsAbs, double epsRel, double scalVar,
+                          double scalRate, double maxStep) throw (std::exception&)
+  {
+    CDA_CellMLIntegrationRun::setStepSizeControl(epsAbs, epsRel, scalVar,
+                                                 scalRate, maxStep);
+  }
+
+  void setTabulationStepControl(double tabulationStepSize, bool strictTabulation)
+    throw (std::exception&)
+  {
+    CDA_CellMLIntegrationRun::setTabulationStepControl(tabulationStepSize,
+                                                       strictTabulation);
+  }
+
+  void setResultRange(double startBvar, double stopBvar, double incrementBvar)
+    throw (std::exception&)
+  {
+    CDA_CellMLIntegrationRun::setResultRange(startBvar, stopBvar, incrementBvar);
+  }
+
+  void setOverride(iface::cellml_services::VariableEvaluationType aType,
+                   uint32_t variableIndex, double newValue)
+    throw (std::exception&)
+  {
+    CDA_CellMLIntegrationRun::setOverride(aType, variableIndex, newValue);
+  }
+
+  void setResultBatching(uint32_t aRowsPerBatch, double aBatchInterval)
+    throw (std::exception&)
+  {
+    CDA_CellMLIntegrationRun::setResultBatching(aRowsPerBatch, aBatchInterval);
+  }
+
+  iface::cellml_services::LinearSolverType linearSolver()
+    throw (std::exception&)
+  {
+    return CDA_CellMLIntegrationRun::linearSolver();
+  }
+
+  void linearSolver(iface::cellml_services::LinearSolverType aLinearSolver)
+    throw (std::exception&)
+  {
+    CDA_CellMLIntegrationRun::linearSolver(aLinearSolver);
+  }
+
+  void setEnsemble(uint32_t aMemberCount, const std::vector<double>& aConstants,
+                   const std::vector<double>& aInitialConditions)
+    throw (std::exception&);
+  uint32_t workerCount() throw (std::exception&);
+  void workerCount(uint32_t aWorkerCount) throw (std::exception&);
+  void setProgressObserver(iface::cellml_services::EnsembleProgressObserver* aEpo)
+    throw (std::exception&);
+  void start() throw (std::exception&);
+  void stop() throw (std::exception&);
+  void pause() throw (std::exception&);
+  void resume() throw (std::exception&);
+
+protected:
+  // The number of members each worker takes from the queue at a time.
+  virtual uint32_t blockSize() { return 1; }
+  virtual void runWorker();
+  bool nextMembers(uint32_t& aFirst, uint32_t& aCount);
+  void finishWorker();
+  // Waits while the run is paused, then returns true if it was stopped.
+  bool isCancelled();
+  void waitWhilePaused();
+  bool setupMember(uint32_t aMember, double* constants, double* buffer,
+                   bool* isOverriden, struct fail_info& failInfo);
+  void reportMemberFinished(uint32_t aMember, struct fail_info& failInfo);
+  void integrateMember(uint32_t aMember, CVODEWorkspace* ws,
+                       double* constants, double* buffer, bool* isOverriden,
+                       std::vector<double>& block);
+
+  uint32_t mMemberCount, mWorkerCount, mNextMember, mRunningWorkers;
+  std::vector<double> mMemberConstants, mMemberInitialConditions;
+  iface::cellml_services::EnsembleProgressObserver* mEnsembleObserver;
+  // Protects mNextMember, mRunningWorkers, mCancelIntegration and
+  // mPauseIntegration.
+  CDAMutex mQueueMutex;
+  // Signalled when a paused run is resumed or stopped.
+  CDACondition mResumeCondition;
+  // Serialises calls to mEnsembleObserver.
+  CDAMutex mObserverMutex;
+};
+
+class CDA_LockStepEnsembleRun
+  : public CDA_ODEEnsembleRun
+{
+public:
+  CDA_LockStepEnsembleRun(CDA_VectorisedODESolverModel* m);
+
+  void start() throw (std::exception&);
+
+protected:
+  uint32_t blockSize() { return mVectorisedModel->mLaneCount; }
+  void runWorker();
+  void IntegrateLockStepRK4(VectorisedModelFunctions* f, uint32_t lanes,
+                            double* constants, uint32_t rateSize,
+                            double* rates, double* states, uint32_t algSize,
+                            double* algebraic, ResultSink** sinks,
+                            struct fail_info* failInfos);
+  bool RetireFailedLanes(LaneFallback& aFallback, uint32_t lanes,
+                         double* constants, double* states, double* algebraic,
+                         ResultSink** sinks, struct fail_info* failInfos);
+
+  ObjRef<CDA_VectorisedODESolverModel> mVectorisedModel;
+};
+
 class CDA_DAESolverRun
   : public CDA_CellMLIntegrationRun
 {
@@ -242,12 +503,7 @@ class CDA_CellMLIntegrationService
 #endif
 {
 public:
-  CDA_CellMLIntegrationService()
-#ifdef ENABLE_CONTEXT
-    : mUnload(NULL)
-#endif
-  {
-  }
+  CDA_CellMLIntegrationService();
 
   ~CDA_CellMLIntegrationService()
   {
@@ -264,9 +520,7 @@ public:
 #endif
 
   void setupCodeEnvironment(iface::cellml_services::CodeInformation* cci,
-                            std::string& dirname,
-                            std::string& sourcename,
-                            std::ofstream& ss);
+                            std::ostream& ss);
 
   already_AddRefd<iface::cellml_services::ODESolverCompiledModel>
   compileModelODE(iface::cellml_api::Model* aModel)
@@ -287,12 +541,40 @@ public:
   already_AddRefd<iface::cellml_services::DAESolverRun>
   createDAEIntegrationRun(iface::cellml_services::DAESolverCompiledModel* aModel)
     throw(std::exception&);
+  already_AddRefd<iface::cellml_services::ODEEnsembleRun>
+  createODEEnsembleRun(iface::cellml_services::ODESolverCompiledModel* aModel)
+    throw(std::exception&);
+  already_AddRefd<iface::cellml_services::VectorisedODESolverCompiledModel>
+  compileVectorisedModelODE(iface::cellml_api::Model* aModel,
+                            uint32_t aLaneCount)
+    throw(std::exception&);
+  already_AddRefd<iface::cellml_services::ODEEnsembleRun>
+  createLockStepEnsembleRun
+  (iface::cellml_services::VectorisedODESolverCompiledModel* aModel)
+    throw(std::exception&);
   
   std::wstring lastError() throw(std::exception&)
   {
     return mLastError;
   }
 
+  iface::cellml_services::CompilerBackend compilerBackend()
+    throw(std::exception&);
+  void compilerBackend(iface::cellml_services::CompilerBackend aBackend)
+    throw(std::exception&);
+  bool jitAvailable() throw(std::exception&);
+
+  std::wstring compiledModelCacheDirectory() throw(std::exception&)
+  {
+    return mCacheDirectory;
+  }
+
+  void compiledModelCacheDirectory(const std::wstring& aDirectory)
+    throw(std::exception&)
+  {
+    mCacheDirectory = aDirectory;
+  }
+
 #ifdef ENABLE_CONTEXT
   iface::cellml_context::CellMLModule::ModuleTypes moduleType()
     throw(std::exception&)
@@ -340,10 +622,26 @@ private:
   compileModelDAEInternal(iface::cellml_api::Model* aModel, bool aIsDebug)
     throw(std::exception&);
 
-  CompiledModule* CompileSource(std::string& destDir, std::string& sourceFile,
+  already_AddRefd<iface::cellml_services::CodeInformation>
+  GenerateODECode(iface::cellml_services::CodeGenerator* cg,
+                  iface::cellml_api::Model* aModel)
+    throw(std::exception&);
+  void WriteODEFunctions(iface::cellml_services::CodeInformation* cci,
+                         std::ostream& ss);
+
+  CompiledModule* CompileSource(const std::string& aSource,
+                                std::string& destDir,
                                 std::wstring& lastError);
+  CompiledModule* CompileSourceJIT(const std::string& aSource,
+                                   std::wstring& lastError);
+  CompiledModule* CompileSourceExternal(const std::string& aSource,
+                                        std::string& destDir,
+                                        std::wstring& lastError);
   void SetupCodeGenStrings(iface::cellml_services::CodeGenerator* aCGS, bool aIsDebug);
+  void SetupVectorisedCodeGenStrings(iface::cellml_services::CodeGenerator* aCGS);
   std::wstring mLastError;
+  iface::cellml_services::CompilerBackend mCompilerBackend;
+  std::wstring mCacheDirectory;
 #ifdef ENABLE_CONTEXT
   void (*mUnload)();
 #endif
@@ -0,0 +1,319 @@
+#define MODULE_CONTAINS_CIS
+#include "Utilities.hxx"
+#include <string>
+#ifndef WIN32
+#include <unistd.h>
+#include <time.h>
+#include <sys/time.h>
+#endif
+#include "CISImplementation.hxx"
+
+// Don't batch more than 2MB of variables (assuming 8 bytes per variable). This
+// leaves a little bit of room in the 2MB for CORBA overhead.
+#define VARIABLE_STORAGE_LIMIT 262016
+// The number of batches which can be waiting for delivery at once, plus one.
+#define RING_BLOCKS 4
+// The number of rows between checks of the clock for the batch interval.
+#define ROWS_PER_CLOCK_CHECK 64
+
+#ifdef WIN32
+#define memory_barrier() MemoryBarrier()
+#else
+#define memory_barrier() __sync_synchronize()
+#endif
+
+static double
+monotonicSeconds()
+{
+#ifdef WIN32
+  return GetTickCount() / 1000.0;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1E-9;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1E-6;
+#endif
+}
+
+ResultSink::ResultSink
+(
+ uint32_t aRowSize, uint32_t aRowsPerBatch, double aBatchInterval
+)
+  : mRowSize(aRowSize), mUsed(0), mRows(NULL),
+    mBatchInterval(aBatchInterval), mBatchStart(monotonicSeconds()),
+    mRowsToClockCheck(ROWS_PER_CLOCK_CHECK)
+{
+  if (aRowsPerBatch == 0)
+    aRowsPerBatch = VARIABLE_STORAGE_LIMIT / aRowSize;
+  if (aRowsPerBatch == 0)
+    aRowsPerBatch = 1;
+  mCapacity = aRowsPerBatch * aRowSize;
+}
+
+void
+ResultSink::commitRow()
+{
+  mUsed += mRowSize;
+  if (mUsed == mCapacity)
+  {
+    flush();
+    return;
+  }
+
+  // Reading the clock costs more than a row of a small model, so it is only
+  // done every so often.
+  if (mBatchInterval > 0.0 && --mRowsToClockCheck == 0)
+  {
+    mRowsToClockCheck = ROWS_PER_CLOCK_CHECK;
+    if (monotonicSeconds() - mBatchStart >= mBatchInterval)
+      flush();
+  }
+}
+
+void
+ResultSink::flush()
+{
+  if (mUsed != 0)
+    mRows = sendBatch(mUsed);
+  mUsed = 0;
+  mBatchStart = monotonicSeconds();
+  mRowsToClockCheck = ROWS_PER_CLOCK_CHECK;
+}
+
+// A counting wake-up, built on the same primitives as the pause / resume
+// pipe of CDA_CellMLIntegrationRun.
+class WakeSignal
+{
+public:
+  WakeSignal()
+  {
+#ifdef WIN32
+    mSemaphore = CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+#else
+    pipe(mPipe);
+#endif
+  }
+
+  ~WakeSignal()
+  {
+#ifdef WIN32
+    CloseHandle(mSemaphore);
+#else
+    close(mPipe[0]);
+    close(mPipe[1]);
+#endif
+  }
+
+  void post()
+  {
+#ifdef WIN32
+    ReleaseSemaphore(mSemaphore, 1, NULL);
+#else
+    char c = 0;
+    write(mPipe[1], &c, 1);
+#endif
+  }
+
+  void wait()
+  {
+#ifdef WIN32
+    WaitForSingleObject(mSemaphore, INFINITE);
+#else
+    char c;
+    read(mPipe[0], &c, 1);
+#endif
+  }
+
+private:
+#ifdef WIN32
+  HANDLE mSemaphore;
+#else
+  int mPipe[2];
+#endif
+};
+
+class ResultRingDelivery
+  : public CDAThread
+{
+public:
+  ResultRingDelivery(ResultRing* aRing)
+    : mRing(aRing)
+  {
+  }
+
+protected:
+  void runthread()
+  {
+    mRing->deliver();
+  }
+
+private:
+  ResultRing* mRing;
+};
+
+ResultRing::ResultRing
+(
+ CDA_CellMLIntegrationRun* aRun,
+ iface::cellml_services::IntegrationProgressObserver* aObserver,
+ uint32_t aRowSize, uint32_t aRowsPerBatch, double aBatchInterval
+)
+  : ResultSink(aRowSize, aRowsPerBatch, aBatchInterval), mRun(aRun),
+    mObserver(aObserver), mHead(0), mTail(0), mFinished(false),
+    mDeliveryWaiting(false), mSolverWaiting(false)
+{
+  mBlocks = new std::vector<double>[RING_BLOCKS];
+  mBlocks[0].resize(mCapacity);
+  mRows = &mBlocks[0][0];
+
+  mDataSignal = new WakeSignal();
+  mSpaceSignal = new WakeSignal();
+  mDrainedSignal = new WakeSignal();
+
+  // The delivery thread is not needed if nobody is listening.
+  if (mObserver != NULL)
+  {
+    mDelivery = new ResultRingDelivery(this);
+    // Without a thread, batches are delivered by the solver itself.
+    if (!mDelivery->startthread())
+    {
+      delete mDelivery;
+      mDelivery = NULL;
+    }
+  }
+  else
+    mDelivery = NULL;
+}
+
+ResultRing::~ResultRing()
+{
+  flush();
+
+  if (mDelivery != NULL)
+  {
+    {
+      CDALock lock(mWaitMutex);
+      mFinished = true;
+      if (mDeliveryWaiting)
+      {
+        mDeliveryWaiting = false;
+        mDataSignal->post();
+      }
+    }
+    mDrainedSignal->wait();
+    delete mDelivery;
+  }
+
+  delete mDrainedSignal;
+  delete mSpaceSignal;
+  delete mDataSignal;
+  delete [] mBlocks;
+}
+
+bool
+ResultRing::stopRequested()
+{
+  return mRun->checkPauseOrCancellation();
+}
+
+double*
+ResultRing::sendBatch(uint32_t aLength)
+{
+  if (mDelivery == NULL)
+  {
+    if (mObserver != NULL)
+    {
+      std::vector<double>& block = mBlocks[0];
+      block.resize(aLength);
+      try
+      {
+        mObserver->results(block);
+      }
+      catch (...)
+      {
+      }
+      // Growing back within the capacity doesn't reallocate either.
+      block.resize(mCapacity);
+    }
+    return mRows;
+  }
+
+  std::vector<double>& block = mBlocks[mHead % RING_BLOCKS];
+  // Shrinking never reallocates, so this doesn't copy the rows.
+  block.resize(aLength);
+
+  // Make sure the rows are visible before the block is.
+  memory_barrier();
+  mHead++;
+
+  {
+    CDALock lock(mWaitMutex);
+    if (mDeliveryWaiting)
+    {
+      mDeliveryWaiting = false;
+      mDataSignal->post();
+    }
+  }
+
+  // Wait for the next block to come back from the observer, if need be.
+  while (mHead - mTail >= RING_BLOCKS)
+  {
+    CDALock lock(mWaitMutex);
+    if (mHead - mTail < RING_BLOCKS)
+      break;
+    mSolverWaiting = true;
+    mWaitMutex.Unlock();
+    mSpaceSignal->wait();
+    mWaitMutex.Lock();
+  }
+  memory_barrier();
+
+  std::vector<double>& next = mBlocks[mHead % RING_BLOCKS];
+  if (next.size() != mCapacity)
+    next.resize(mCapacity);
+  return &next[0];
+}
+
+void
+ResultRing::deliver()
+{
+  while (true)
+  {
+    {
+      CDALock lock(mWaitMutex);
+      if (mTail == mHead)
+      {
+        if (mFinished)
+          break;
+        mDeliveryWaiting = true;
+        mWaitMutex.Unlock();
+        mDataSignal->wait();
+        mWaitMutex.Lock();
+        continue;
+      }
+    }
+    memory_barrier();
+
+    try
+    {
+      mObserver->results(mBlocks[mTail % RING_BLOCKS]);
+    }
+    catch (...)
+    {
+    }
+
+    memory_barrier();
+    mTail++;
+
+    CDALock lock(mWaitMutex);
+    if (mSolverWaiting)
+    {
+      mSolverWaiting = false;
+      mSpaceSignal->post();
+    }
+  }
+
+  mDrainedSignal->post();
+}
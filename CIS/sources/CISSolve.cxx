@@ -2,6 +2,7 @@
 #define GSL_DLL
 #include <exception>
 #include "cda_compiler_support.h"
+#include <algorithm>
 #include <limits>
 #include <sstream>
 #include "Utilities.hxx"
@@ -26,7 +27,8 @@
 #undef M
 #include <cvode/cvode.h>
 #include <ida/ida.h>
-// #include <ida/ida_spgmr.h>
+#include <ida/ida_spgmr.h>
+#include <ida/ida_spbcgs.h>
 #include <ida/ida_dense.h>
 // #include <ida/ida_sptfqmr.h>
 
@@ -34,7 +36,10 @@
 #include <sundials/sundials_nvector.h>
 #include <sundials/sundials_types.h>
 #include <cvode/cvode_dense.h>
-#include <cvode/cvode_dense.h>
+#include <cvode/cvode_band.h>
+#include <cvode/cvode_bandpre.h>
+#include <cvode/cvode_spgmr.h>
+#include <cvode/cvode_spbcgs.h>
 
 #include <kinsol/kinsol.h>
 #include <kinsol/kinsol_spgmr.h>
@@ -69,11 +74,16 @@ void failAddCause(struct fail_info* aFail, const char* aCause)
   aFail->failmsg = aCause + (", caused by " + aFail->failmsg);
 }
 
+class JacobianColouring;
+
 struct EvaluationInformation
 {
   double* constants, * rates, * algebraic, * states;
   uint32_t rateSizeBytes, rateSize;
   struct fail_info* failInfo;
+  // Only used by the CVODE Jacobian function.
+  void* cvodeMem;
+  JacobianColouring* colouring;
   void (*ComputeRates)(double VOI, double* CONSTANTS, double* RATES,
                        double* STATES, double* ALGEBRAIC, struct fail_info*);
   void (*ComputeVariables)(double VOI, double* CONSTANTS, double* RATES,
@@ -178,13 +188,12 @@ EvaluateRatesCVODE(double bound, N_Vector varsV, N_Vector ratesV, void* params)
 {
   EvaluationInformation* ei = reinterpret_cast<EvaluationInformation*>(params);
   
-  // Update variables that change based on bound/other vars...
-  ei->ComputeRates(bound, ei->constants, ei->rates, N_VGetArrayPointer_Serial(varsV),
-                   ei->algebraic, ei->failInfo);
-
-  double* rates = N_VGetArrayPointer_Serial(ratesV);
-  if (rates != ei->rates)
-    memcpy(rates, ei->rates, ei->rateSizeBytes);
+  // Update variables that change based on bound/other vars. The rates are
+  // written straight into CVODE's vector; they are recomputed into ei->rates
+  // whenever a result row is needed.
+  ei->ComputeRates(bound, ei->constants, N_VGetArrayPointer_Serial(ratesV),
+                   N_VGetArrayPointer_Serial(varsV), ei->algebraic,
+                   ei->failInfo);
 
   for (int i = 0; i < NV_LENGTH_S(ratesV); i++)
   {
@@ -200,12 +209,6 @@ EvaluateRatesCVODE(double bound, N_Vector varsV, N_Vector ratesV, void* params)
   return ei->failInfo->failtype;
 }
 
-// Don't cache more than 2MB of variables (assuming 8 bytes per variable). This
-// leaves a little bit of room in the 2MB for CORBA overhead.
-#define VARIABLE_STORAGE_LIMIT 262016
-// Don't cache for more than 1 second...
-#define VARIABLE_TIME_LIMIT 1
-
 bool
 CDA_CellMLIntegrationRun::checkPauseOrCancellation()
 {
@@ -341,10 +344,8 @@ CDA_ODESolverRun::SolveODEProblemGSL
   double stepSize = 1E-6;
 
   uint32_t recsize = rateSize * 2 + algSize + 1;
-  uint32_t storageCapacity = (VARIABLE_STORAGE_LIMIT / recsize) * recsize;
-  double* storage = new double[storageCapacity];
-  uint32_t storageExpiry = time(0) + VARIABLE_TIME_LIMIT;
-  uint32_t storageSize = 0;
+  ResultRing* ring = new ResultRing(this, mObserver, recsize, mRowsPerBatch,
+                                    mBatchInterval);
 
   double lastVOI = 0.0 /* initialised only to avoid extraneous warning. */;
   bool isFirst = true;
@@ -390,35 +391,20 @@ CDA_ODESolverRun::SolveODEProblemGSL
     // purposes...
     f->ComputeVariables(voi, constants, rates, states, algebraic);
 
-    // Add to storage...
-    storage[storageSize] = voi;
-    memcpy(storage + storageSize + 1, states, rateSize * sizeof(double));
-    memcpy(storage + storageSize + 1 + rateSize, rates,
-           rateSize * sizeof(double));
-    memcpy(storage + storageSize + 1 + rateSize * 2, algebraic,
-           algSize * sizeof(double));
+    double* row = ring->beginRow();
+    row[0] = voi;
+    memcpy(row + 1, states, rateSize * sizeof(double));
+    memcpy(row + 1 + rateSize, rates, rateSize * sizeof(double));
+    memcpy(row + 1 + rateSize * 2, algebraic, algSize * sizeof(double));
+    ring->commitRow();
+  }
 
-    storageSize += recsize;
+  // Sends the remaining rows, and waits for the observer to get them all.
+  delete ring;
 
-    // Are we ready to send?
-    uint32_t timeNow = time(0);
-    if (timeNow >= storageExpiry || storageSize == storageCapacity)
-    {
-      if (mObserver != NULL)
-        mObserver->results(storageSize, storage);
-      storageExpiry = timeNow + VARIABLE_TIME_LIMIT;
-      storageSize = 0;
-    }
-  }
-  if (storageSize != 0 && mObserver != NULL)
-  {
-    mObserver->results(storageSize, storage);
-  }
   if (mObserver != NULL)
     mObserver->done();
 
-  delete [] storage;
-
   // Free gsl structures...
   gsl_odeiv_evolve_free(e);
   gsl_odeiv_control_free(c);
@@ -441,6 +427,286 @@ cda_ida_error_handler(int error_code, const char* module,
   setFailure(reinterpret_cast<struct fail_info*>(eh_data), msg, -1);
 }
 
+// How many Jacobian estimates go by between the ones made a column at a time,
+// to check that the columns grouped together really share no rows.
+#define JACOBIAN_CHECK_INTERVAL 50
+
+/*
+ * The CCGS doesn't generate an analytic Jacobian, so the stiff solvers fall
+ * back to estimating it by difference quotients. This splits the columns of
+ * the Jacobian into groups in which no two columns have an entry in the same
+ * row, so that all the columns in a group can be estimated from a single extra
+ * evaluation, rather than one evaluation per column.
+ *
+ * For CVODE, the rows come from the rate dependencies reported by the CCGS.
+ * The CCGS doesn't describe the sparsity of the residuals, so for IDA they are
+ * taken from the first estimate, made a column at a time. Every so often, and
+ * always the first time, the estimate is made a column at a time anyway, and
+ * if it has an entry outside the rows expected, the grouping is abandoned in
+ * favour of estimating every column on its own.
+ */
+class JacobianColouring
+{
+public:
+  JacobianColouring(iface::cellml_services::CodeInformation* aCCI,
+                    uint32_t aSize)
+    : mColumnRows(aSize), mIncrements(aSize), mSavedStates(aSize),
+      mSavedRates(aSize), mKnown(true), mUsable(true), mEstimates(0)
+  {
+    for (uint32_t i = 0; i < aSize; i++)
+    {
+      uint32_t n = aCCI->rateDependencyCount(i);
+      for (uint32_t j = 0; j < n; j++)
+        mColumnRows[aCCI->rateDependency(i, j)].push_back(i);
+    }
+    Colour();
+  }
+
+  JacobianColouring(uint32_t aSize)
+    : mColumnRows(aSize), mIncrements(aSize), mSavedStates(aSize),
+      mSavedRates(aSize), mKnown(false), mUsable(true), mEstimates(0)
+  {
+  }
+
+  // Whether the next estimate has to be made a column at a time.
+  bool NeedsFullEstimate()
+  {
+    return !mUsable || !mKnown || mEstimates % JACOBIAN_CHECK_INTERVAL == 0;
+  }
+
+  // The columns in group aGroup, which is a single column when the estimate
+  // is made a column at a time.
+  const std::vector<uint32_t>& Group(bool aFull, uint32_t aGroup)
+  {
+    if (!aFull)
+      return mGroups[aGroup];
+    mSingle.assign(1, aGroup);
+    return mSingle;
+  }
+
+  // Called once an estimate has been made successfully. A full estimate gives
+  // the rows if they aren't known, and otherwise checks them.
+  void Estimated(bool aFull, DlsMat aJac)
+  {
+    mEstimates++;
+    if (!aFull || !mUsable)
+      return;
+
+    uint32_t n = mColumnRows.size();
+    for (uint32_t j = 0; j < n; j++)
+    {
+      const double* col = DENSE_COL(aJac, j);
+      for (uint32_t i = 0; i < n; i++)
+      {
+        if (col[i] == 0.0)
+          continue;
+        if (!mKnown)
+          mColumnRows[j].push_back(i);
+        else if (!std::binary_search(mColumnRows[j].begin(),
+                                     mColumnRows[j].end(), i))
+        {
+          mUsable = false;
+          return;
+        }
+      }
+    }
+
+    if (!mKnown)
+    {
+      mKnown = true;
+      Colour();
+      // If no two columns can share an evaluation, grouping would only add
+      // the periodic checks.
+      if (mGroups.size() == n)
+        mUsable = false;
+    }
+  }
+
+  // The rows with a (possibly) non-zero entry, for each column, in order.
+  std::vector<std::vector<uint32_t> > mColumnRows;
+  // The columns in each group.
+  std::vector<std::vector<uint32_t> > mGroups;
+  // Scratch space for the increment applied to each variable, and the values
+  // it is applied to.
+  std::vector<double> mIncrements, mSavedStates, mSavedRates;
+  // Whether mColumnRows is known yet, and whether the groups can be used.
+  bool mKnown, mUsable;
+  uint32_t mEstimates;
+
+private:
+  // Greedily puts each column in the first group it doesn't clash with.
+  void Colour()
+  {
+    uint32_t n = mColumnRows.size();
+    std::vector<std::vector<bool> > groupRows;
+    mGroups.clear();
+    for (uint32_t j = 0; j < n; j++)
+    {
+      const std::vector<uint32_t>& rows = mColumnRows[j];
+      uint32_t g;
+      for (g = 0; g < mGroups.size(); g++)
+      {
+        std::vector<uint32_t>::const_iterator r;
+        for (r = rows.begin(); r != rows.end(); r++)
+          if (groupRows[g][*r])
+            break;
+        if (r == rows.end())
+          break;
+      }
+      if (g == mGroups.size())
+      {
+        mGroups.push_back(std::vector<uint32_t>());
+        groupRows.push_back(std::vector<bool>(n, false));
+      }
+      mGroups[g].push_back(j);
+      for (std::vector<uint32_t>::const_iterator r = rows.begin();
+           r != rows.end(); r++)
+        groupRows[g][*r] = true;
+    }
+  }
+
+  std::vector<uint32_t> mSingle;
+};
+
+// The difference quotient fallback for the CVODE dense Jacobian. The
+// increments follow CVODE's own choice, so a column at a time this gives the
+// same estimate as CVODE's built-in routine.
+static int
+EstimateJacobianCVODE
+(
+ long int N, realtype t, N_Vector y, N_Vector fy, DlsMat Jac, void* params,
+ N_Vector tmp1, N_Vector tmp2, N_Vector tmp3
+)
+{
+  EvaluationInformation* ei = reinterpret_cast<EvaluationInformation*>(params);
+  JacobianColouring* jc = ei->colouring;
+  double* ydata = N_VGetArrayPointer_Serial(y);
+  double* fydata = N_VGetArrayPointer_Serial(fy);
+  double* ftemp = N_VGetArrayPointer_Serial(tmp1);
+  double* ewt = N_VGetArrayPointer_Serial(tmp2);
+
+  double h;
+  CVodeGetCurrentStep(ei->cvodeMem, &h);
+  CVodeGetErrWeights(ei->cvodeMem, tmp2);
+
+  double srur = sqrt(UNIT_ROUNDOFF);
+  double fnorm = N_VWrmsNorm(fy, tmp2);
+  double minInc = (fnorm != 0.0) ?
+    (1000.0 * fabs(h) * UNIT_ROUNDOFF * N * fnorm) : 1.0;
+
+  SetToZero(Jac);
+
+  bool full = jc->NeedsFullEstimate();
+  uint32_t groupCount = full ? N : jc->mGroups.size();
+  for (uint32_t g = 0; g < groupCount; g++)
+  {
+    const std::vector<uint32_t>& group = jc->Group(full, g);
+    std::vector<uint32_t>::const_iterator j;
+    for (j = group.begin(); j != group.end(); j++)
+    {
+      double inc = srur * fabs(ydata[*j]);
+      if (inc < minInc / ewt[*j])
+        inc = minInc / ewt[*j];
+      // Use the increment actually represented, to reduce rounding error.
+      jc->mSavedStates[*j] = ydata[*j];
+      ydata[*j] += inc;
+      jc->mIncrements[*j] = ydata[*j] - jc->mSavedStates[*j];
+    }
+
+    ei->ComputeRates(t, ei->constants, ftemp, ydata, ei->algebraic,
+                     ei->failInfo);
+
+    for (j = group.begin(); j != group.end(); j++)
+    {
+      ydata[*j] = jc->mSavedStates[*j];
+      double invInc = 1.0 / jc->mIncrements[*j];
+      double* col = DENSE_COL(Jac, *j);
+      if (full)
+      {
+        for (long int i = 0; i < N; i++)
+          col[i] = (ftemp[i] - fydata[i]) * invInc;
+        continue;
+      }
+      const std::vector<uint32_t>& rows = jc->mColumnRows[*j];
+      for (std::vector<uint32_t>::const_iterator i = rows.begin();
+           i != rows.end(); i++)
+        col[*i] = (ftemp[*i] - fydata[*i]) * invInc;
+    }
+
+    // A recoverable failure, so CVODE retries with a smaller step. The
+    // failure has to be forgotten, or every later rates evaluation would
+    // report it again.
+    if (ei->failInfo->failtype)
+    {
+      clearFailure(ei->failInfo);
+      return 1;
+    }
+  }
+
+  jc->Estimated(full, Jac);
+  return 0;
+}
+
+// CVODE memory for the integrations done on one thread. The solver is set up
+// on first use, and only reinitialised for each later parameter set, so an
+// ensemble worker pays for the allocation once.
+class CVODEWorkspace
+{
+public:
+  CVODEWorkspace(iface::cellml_services::ODEIntegrationStepType aStepType,
+                 uint32_t aRateSize, double* aStates)
+    : mSolver(NULL), mY(NULL), mInitialised(false), mStepType(aStepType),
+      mColouring(NULL)
+  {
+    if (aRateSize != 0)
+    {
+      mY = N_VMake_Serial(aRateSize, aStates);
+      switch (aStepType)
+      {
+      case iface::cellml_services::ADAMS_MOULTON_1_12:
+        mSolver = CVodeCreate(CV_ADAMS, CV_FUNCTIONAL);
+        break;
+      case iface::cellml_services::BDF_IMPLICIT_1_5_SOLVE:
+      default:
+        mSolver = CVodeCreate(CV_BDF, CV_NEWTON);
+        break;
+      }
+    }
+  }
+
+  ~CVODEWorkspace()
+  {
+    if (mSolver != NULL)
+      CVodeFree(&mSolver);
+    if (mY != NULL)
+      N_VDestroy(mY);
+    delete mColouring;
+  }
+
+  void* mSolver;
+  N_Vector mY;
+  bool mInitialised;
+  iface::cellml_services::ODEIntegrationStepType mStepType;
+  EvaluationInformation mEI;
+  JacobianColouring* mColouring;
+};
+
+CVODEWorkspace*
+CDA_ODESolverRun::CreateCVODEWorkspace
+(
+ iface::cellml_services::ODEIntegrationStepType aStepType,
+ uint32_t rateSize, double* states
+)
+{
+  return new CVODEWorkspace(aStepType, rateSize, states);
+}
+
+void
+CDA_ODESolverRun::DestroyCVODEWorkspace(CVODEWorkspace* aWorkspace)
+{
+  delete aWorkspace;
+}
+
 void
 CDA_ODESolverRun::SolveODEProblemCVODE
 (
@@ -449,40 +715,134 @@ CDA_ODESolverRun::SolveODEProblemCVODE
  double* states, uint32_t algSize, double* algebraic
 )
 {
-  N_Vector y = NULL;
-  if (rateSize != 0)
-    y = N_VMake_Serial(rateSize, states);
-  void* solver = NULL;
   struct fail_info failInfo;
+  {
+    CVODEWorkspace ws(mStepType, rateSize, states);
+    // The ring sends the remaining rows, and waits for the observer to get
+    // them all, as it goes out of scope.
+    ResultRing ring(this, mObserver, rateSize * 2 + algSize + 1,
+                    mRowsPerBatch, mBatchInterval);
+    IntegrateCVODE(&ws, f, constants, rateSize, rates, states, algSize,
+                   algebraic, &ring, failInfo);
+  }
 
-  if (rateSize != 0)
+  if (mObserver != NULL)
   {
-    switch (mStepType)
+    if (failInfo.failtype)
+      mObserver->failed(failInfo.failmsg);
+    else
+      mObserver->done();
+  }
+}
+
+// Models with more states than this don't get a dense Jacobian by default.
+#define DENSE_JACOBIAN_STATE_LIMIT 100
+// The most diagonals either side of the main one kept in the preconditioner
+// for the iterative solvers.
+#define PRECONDITIONER_HALF_BANDWIDTH 5
+
+// Works out the bandwidth of the Jacobian from the states each rate depends
+// on, as reported by the CCGS.
+static void
+JacobianBandwidth
+(
+ iface::cellml_services::CodeInformation* aCCI, uint32_t rateSize,
+ uint32_t& aUpper, uint32_t& aLower
+)
+{
+  aUpper = 0;
+  aLower = 0;
+  for (uint32_t i = 0; i < rateSize; i++)
+  {
+    uint32_t n = aCCI->rateDependencyCount(i);
+    if (n == 0)
+      continue;
+
+    // Dependencies are sorted, so only the first and last matter.
+    uint32_t first = aCCI->rateDependency(i, 0);
+    uint32_t last = aCCI->rateDependency(i, n - 1);
+    if (first < i && i - first > aLower)
+      aLower = i - first;
+    if (last > i && last - i > aUpper)
+      aUpper = last - i;
+  }
+}
+
+void
+CDA_ODESolverRun::AttachCVODELinearSolver(CVODEWorkspace* ws,
+                                          uint32_t rateSize)
+{
+  void* solver = ws->mSolver;
+  iface::cellml_services::LinearSolverType type = mLinearSolver;
+  if (type == iface::cellml_services::LINEAR_SOLVER_DENSE ||
+      (type == iface::cellml_services::LINEAR_SOLVER_AUTOMATIC &&
+       rateSize <= DENSE_JACOBIAN_STATE_LIMIT))
+  {
+    CVDense(solver, rateSize);
+
+    // Only worth it if the columns actually share evaluations.
+    ws->mColouring = new JacobianColouring(mModel->mCCI, rateSize);
+    if (ws->mColouring->mGroups.size() < rateSize)
+      CVDlsSetDenseJacFn(solver, EstimateJacobianCVODE);
+    else
     {
-    case iface::cellml_services::ADAMS_MOULTON_1_12:
-      solver = CVodeCreate(CV_ADAMS, CV_FUNCTIONAL);
-      break;
-    case iface::cellml_services::BDF_IMPLICIT_1_5_SOLVE:
-    default:
-      solver = CVodeCreate(CV_BDF, CV_NEWTON);
-      break;
+      delete ws->mColouring;
+      ws->mColouring = NULL;
     }
-
-    CVodeSetErrHandlerFn(solver, cda_cvode_error_handler, &failInfo);
+    return;
   }
 
-  EvaluationInformation ei;
-  ei.failInfo = &failInfo;
+  uint32_t upper, lower;
+  JacobianBandwidth(mModel->mCCI, rateSize, upper, lower);
 
-  if (rateSize != 0)
+  if (type == iface::cellml_services::LINEAR_SOLVER_AUTOMATIC)
   {
-    CVodeInit(solver, EvaluateRatesCVODE, mStartBvar, y);
-    CVodeSStolerances(solver, mEpsRel, mEpsAbs);
-    if (mStepType == iface::cellml_services::BDF_IMPLICIT_1_5_SOLVE)
-      CVDense(solver, rateSize);
-    CVodeSetUserData(solver, &ei);
+    // A band solve costs about rateSize * (upper + lower + 1)^2, so it is
+    // only worth it if the band is a small part of the matrix.
+    if ((upper + lower + 1) * 4 <= rateSize)
+      type = iface::cellml_services::LINEAR_SOLVER_BANDED;
+    else
+      type = iface::cellml_services::LINEAR_SOLVER_GMRES;
+  }
+
+  switch (type)
+  {
+  case iface::cellml_services::LINEAR_SOLVER_BANDED:
+    CVBand(solver, rateSize, upper, lower);
+    break;
+  case iface::cellml_services::LINEAR_SOLVER_GMRES:
+  case iface::cellml_services::LINEAR_SOLVER_BICGSTAB:
+    if (type == iface::cellml_services::LINEAR_SOLVER_GMRES)
+      CVSpgmr(solver, PREC_LEFT, 0);
+    else
+      CVSpbcg(solver, PREC_LEFT, 0);
+    // The preconditioner approximates the Jacobian by its central band,
+    // computed by difference quotients.
+    if (upper > PRECONDITIONER_HALF_BANDWIDTH)
+      upper = PRECONDITIONER_HALF_BANDWIDTH;
+    if (lower > PRECONDITIONER_HALF_BANDWIDTH)
+      lower = PRECONDITIONER_HALF_BANDWIDTH;
+    CVBandPrecInit(solver, rateSize, upper, lower);
+    break;
+  default:
+    CVDense(solver, rateSize);
+    break;
   }
+}
 
+void
+CDA_ODESolverRun::IntegrateCVODE
+(
+ CVODEWorkspace* ws, CompiledModelFunctions* f,
+ double* constants, uint32_t rateSize, double* rates,
+ double* states, uint32_t algSize, double* algebraic,
+ ResultSink* sink, struct fail_info& failInfo
+)
+{
+  void* solver = ws->mSolver;
+  N_Vector y = ws->mY;
+  EvaluationInformation& ei = ws->mEI;
+  ei.failInfo = &failInfo;
   ei.constants = constants;
   ei.states = states;
   ei.rates = rates;
@@ -491,12 +851,24 @@ CDA_ODESolverRun::SolveODEProblemCVODE
   ei.rateSizeBytes = rateSize * sizeof(double);
   ei.ComputeRates = f->ComputeRates;
   ei.ComputeVariables = f->ComputeVariables;
-  
-  uint32_t recsize = rateSize * 2 + algSize + 1;
-  uint32_t storageCapacity = (VARIABLE_STORAGE_LIMIT / recsize) * recsize;
-  double* storage = new double[storageCapacity];
-  uint32_t storageExpiry = time(0) + VARIABLE_TIME_LIMIT;
-  uint32_t storageSize = 0;
+  ei.cvodeMem = solver;
+
+  if (rateSize != 0)
+  {
+    CVodeSetErrHandlerFn(solver, cda_cvode_error_handler, &failInfo);
+    if (!ws->mInitialised)
+    {
+      CVodeInit(solver, EvaluateRatesCVODE, mStartBvar, y);
+      if (ws->mStepType != iface::cellml_services::ADAMS_MOULTON_1_12)
+        AttachCVODELinearSolver(ws, rateSize);
+      ei.colouring = ws->mColouring;
+      CVodeSetUserData(solver, &ei);
+      ws->mInitialised = true;
+    }
+    else
+      CVodeReInit(solver, mStartBvar, y);
+    CVodeSStolerances(solver, mEpsRel, mEpsAbs);
+  }
 
   double voi = mStartBvar;
   double lastVOI = 0.0 /* initialised only to avoid extraneous warning. */;
@@ -527,7 +899,7 @@ CDA_ODESolverRun::SolveODEProblemCVODE
         break;
       }
       
-      if (checkPauseOrCancellation())
+      if (sink->stopRequested())
         break;
       
       if (isFirst)
@@ -546,50 +918,290 @@ CDA_ODESolverRun::SolveODEProblemCVODE
       f->    ComputeRates(voi, constants, rates, states, algebraic, &failInfo);
       f->ComputeVariables(voi, constants, rates, states, algebraic, &failInfo);
 
-      // Add to storage...
-      storage[storageSize] = voi;
-      memcpy(storage + storageSize + 1, states, rateSize * sizeof(double));
-      memcpy(storage + storageSize + 1 + rateSize, rates,
-             rateSize * sizeof(double));
-      memcpy(storage + storageSize + 1 + rateSize * 2, algebraic,
-             algSize * sizeof(double));
+      double* row = sink->beginRow();
+      row[0] = voi;
+      memcpy(row + 1, states, rateSize * sizeof(double));
+      memcpy(row + 1 + rateSize, rates, rateSize * sizeof(double));
+      memcpy(row + 1 + rateSize * 2, algebraic, algSize * sizeof(double));
+      sink->commitRow();
+    }
+  }
+  sink->flush();
+}
 
-      storageSize += recsize;
+// Repeats work for one lane of a lock-step group with the single-instance
+// code. The kernels only report that some lane failed, so this is how the
+// failure is pinned on the lanes that caused it.
+class LaneFallback
+{
+public:
+  LaneFallback(CompiledModelFunctions* aF, uint32_t aLanes,
+               uint32_t aConstSize, uint32_t aRateSize, uint32_t aAlgSize)
+    : mF(aF), mLanes(aLanes), mConstSize(aConstSize), mRateSize(aRateSize),
+      mAlgSize(aAlgSize)
+  {
+    // One spare value each, so that empty arrays still have an address.
+    mConstants = new double[aConstSize + 1];
+    mY0 = new double[aRateSize + 1];
+    mStates = new double[aRateSize + 1];
+    mRates = new double[aRateSize + 1];
+    mAcc = new double[aRateSize + 1];
+    mAlgebraic = new double[aAlgSize + 1];
+  }
 
-      // Are we ready to send?
-      uint32_t timeNow = time(0);
-      if (timeNow >= storageExpiry || storageSize == storageCapacity)
-      {
-        if (mObserver != NULL)
-        {
-          std::vector<double> resultsVector(storage, storage + storageSize);
-          mObserver->results(resultsVector);
-        }
-        storageExpiry = timeNow + VARIABLE_TIME_LIMIT;
-        storageSize = 0;
-      }
+  ~LaneFallback()
+  {
+    delete [] mAlgebraic;
+    delete [] mAcc;
+    delete [] mRates;
+    delete [] mStates;
+    delete [] mY0;
+    delete [] mConstants;
+  }
+
+  // Takes the RK4 step of size aH from aVOI for lane aLane, starting from the
+  // lane's states in aY0, and stores the new states in aStates. Returns false
+  // if the lane fails.
+  bool step(uint32_t aLane, double aVOI, double aH, double* aConstants,
+            double* aY0, double* aStates, double* aAlgebraic,
+            struct fail_info& aFail)
+  {
+    gather(aConstants, mConstants, mConstSize, aLane);
+    gather(aY0, mY0, mRateSize, aLane);
+    gather(aAlgebraic, mAlgebraic, mAlgSize, aLane);
+    memcpy(mStates, mY0, mRateSize * sizeof(double));
+
+    uint32_t i;
+    mF->ComputeRates(aVOI, mConstants, mRates, mStates, mAlgebraic, &aFail);
+    for (i = 0; i < mRateSize; i++)
+    {
+      mAcc[i] = mRates[i];
+      mStates[i] = mY0[i] + 0.5 * aH * mRates[i];
     }
+    mF->ComputeRates(aVOI + 0.5 * aH, mConstants, mRates, mStates, mAlgebraic,
+                     &aFail);
+    for (i = 0; i < mRateSize; i++)
+    {
+      mAcc[i] += 2.0 * mRates[i];
+      mStates[i] = mY0[i] + 0.5 * aH * mRates[i];
+    }
+    mF->ComputeRates(aVOI + 0.5 * aH, mConstants, mRates, mStates, mAlgebraic,
+                     &aFail);
+    for (i = 0; i < mRateSize; i++)
+    {
+      mAcc[i] += 2.0 * mRates[i];
+      mStates[i] = mY0[i] + aH * mRates[i];
+    }
+    mF->ComputeRates(aVOI + aH, mConstants, mRates, mStates, mAlgebraic,
+                     &aFail);
+    for (i = 0; i < mRateSize; i++)
+      mStates[i] = mY0[i] + (aH / 6.0) * (mAcc[i] + mRates[i]);
+
+    if (aFail.failtype)
+      return false;
+    scatter(mStates, aStates, mRateSize, aLane);
+    scatter(mAlgebraic, aAlgebraic, mAlgSize, aLane);
+    return true;
+  }
+
+  // Computes the rates and variables of lane aLane at aVOI. Returns false if
+  // the lane fails.
+  bool evaluate(uint32_t aLane, double aVOI, double* aConstants,
+                double* aStates, double* aRates, double* aAlgebraic,
+                struct fail_info& aFail)
+  {
+    gather(aConstants, mConstants, mConstSize, aLane);
+    gather(aStates, mStates, mRateSize, aLane);
+    gather(aAlgebraic, mAlgebraic, mAlgSize, aLane);
+    mF->    ComputeRates(aVOI, mConstants, mRates, mStates, mAlgebraic, &aFail);
+    mF->ComputeVariables(aVOI, mConstants, mRates, mStates, mAlgebraic, &aFail);
+    if (aFail.failtype)
+      return false;
+    scatter(mRates, aRates, mRateSize, aLane);
+    scatter(mAlgebraic, aAlgebraic, mAlgSize, aLane);
+    return true;
   }
-  if (storageSize != 0 && mObserver != NULL)
+
+  // Makes lane aTo repeat lane aFrom, so that a lane which has failed can't
+  // make the kernels fail again.
+  void follow(uint32_t aTo, uint32_t aFrom, double* aConstants,
+              double* aStates, double* aAlgebraic)
   {
-    std::vector<double> resultsVector(storage, storage + storageSize);
-    mObserver->results(resultsVector);
+    copyLane(aConstants, mConstSize, aFrom, aTo);
+    copyLane(aStates, mRateSize, aFrom, aTo);
+    copyLane(aAlgebraic, mAlgSize, aFrom, aTo);
   }
-  if (mObserver != NULL)
+
+private:
+  void gather(const double* aFrom, double* aTo, uint32_t aSize, uint32_t aLane)
   {
-    if (failInfo.failtype)
-      mObserver->failed(failInfo.failmsg);
-    else
-      mObserver->done();
+    for (uint32_t i = 0; i < aSize; i++)
+      aTo[i] = aFrom[i * mLanes + aLane];
   }
 
-  delete [] storage;
+  void scatter(const double* aFrom, double* aTo, uint32_t aSize, uint32_t aLane)
+  {
+    for (uint32_t i = 0; i < aSize; i++)
+      aTo[i * mLanes + aLane] = aFrom[i];
+  }
 
-  if (rateSize != 0)
+  void copyLane(double* aArray, uint32_t aSize, uint32_t aFrom, uint32_t aTo)
+  {
+    for (uint32_t i = 0; i < aSize; i++)
+      aArray[i * mLanes + aTo] = aArray[i * mLanes + aFrom];
+  }
+
+  CompiledModelFunctions* mF;
+  uint32_t mLanes, mConstSize, mRateSize, mAlgSize;
+  double* mConstants, * mY0, * mStates, * mRates, * mAcc, * mAlgebraic;
+};
+
+void
+CDA_LockStepEnsembleRun::IntegrateLockStepRK4
+(
+ VectorisedModelFunctions* f, uint32_t lanes,
+ double* constants, uint32_t rateSize, double* rates, double* states,
+ uint32_t algSize, double* algebraic, ResultSink** sinks,
+ struct fail_info* failInfos
+)
+{
+  uint32_t n = rateSize * lanes;
+  double* y0 = new double[n];
+  double* acc = new double[n];
+  LaneFallback fallback(mModel->mCMF, lanes,
+                        mModel->mCCI->constantIndexCount(), rateSize, algSize);
+  struct fail_info failInfo;
+
+  double voi = mStartBvar;
+  uint32_t tabStepNumber = 1;
+  double nextStopPoint = mStopBvar;
+  if (mTabulationStepSize != 0.0)
+    nextStopPoint = mStartBvar + mTabulationStepSize;
+
+  uint32_t i, lane;
+  while (voi < mStopBvar && !isCancelled())
   {
-    CVodeFree(&solver);
-    N_VDestroy(y);
+    if (nextStopPoint > mStopBvar)
+      nextStopPoint = mStopBvar;
+    double h = mStepSizeMax;
+    bool atStopPoint = (voi + h >= nextStopPoint);
+    if (atStopPoint)
+      h = nextStopPoint - voi;
+    double stepStart = voi;
+
+    memcpy(y0, states, n * sizeof(double));
+
+    f->ComputeRates(voi, constants, rates, states, algebraic, &failInfo);
+    for (i = 0; i < n; i++)
+    {
+      acc[i] = rates[i];
+      states[i] = y0[i] + 0.5 * h * rates[i];
+    }
+    f->ComputeRates(voi + 0.5 * h, constants, rates, states, algebraic,
+                    &failInfo);
+    for (i = 0; i < n; i++)
+    {
+      acc[i] += 2.0 * rates[i];
+      states[i] = y0[i] + 0.5 * h * rates[i];
+    }
+    f->ComputeRates(voi + 0.5 * h, constants, rates, states, algebraic,
+                    &failInfo);
+    for (i = 0; i < n; i++)
+    {
+      acc[i] += 2.0 * rates[i];
+      states[i] = y0[i] + h * rates[i];
+    }
+    f->ComputeRates(voi + h, constants, rates, states, algebraic, &failInfo);
+    for (i = 0; i < n; i++)
+      states[i] = y0[i] + (h / 6.0) * (acc[i] + rates[i]);
+
+    if (failInfo.failtype)
+    {
+      clearFailure(&failInfo);
+      for (lane = 0; lane < lanes; lane++)
+        if (sinks[lane] != NULL && !failInfos[lane].failtype)
+          fallback.step(lane, stepStart, h, constants, y0, states, algebraic,
+                        failInfos[lane]);
+      if (!RetireFailedLanes(fallback, lanes, constants, states, algebraic,
+                             sinks, failInfos))
+        break;
+    }
+
+    if (atStopPoint)
+    {
+      voi = nextStopPoint;
+      if (mTabulationStepSize != 0.0)
+        nextStopPoint = (mTabulationStepSize * ++tabStepNumber) + mStartBvar;
+    }
+    else
+      voi += h;
+
+    if (mTabulationStepSize != 0.0 && !atStopPoint)
+      continue;
+
+    f->    ComputeRates(voi, constants, rates, states, algebraic, &failInfo);
+    f->ComputeVariables(voi, constants, rates, states, algebraic, &failInfo);
+    if (failInfo.failtype)
+    {
+      clearFailure(&failInfo);
+      for (lane = 0; lane < lanes; lane++)
+        if (sinks[lane] != NULL && !failInfos[lane].failtype)
+          fallback.evaluate(lane, voi, constants, states, rates, algebraic,
+                            failInfos[lane]);
+      if (!RetireFailedLanes(fallback, lanes, constants, states, algebraic,
+                             sinks, failInfos))
+        break;
+    }
+
+    // Gather each lane's row out of the structure-of-arrays storage.
+    for (lane = 0; lane < lanes; lane++)
+    {
+      if (sinks[lane] == NULL || failInfos[lane].failtype)
+        continue;
+      double* row = sinks[lane]->beginRow();
+      row[0] = voi;
+      for (i = 0; i < rateSize; i++)
+      {
+        row[1 + i] = states[i * lanes + lane];
+        row[1 + rateSize + i] = rates[i * lanes + lane];
+      }
+      for (i = 0; i < algSize; i++)
+        row[1 + 2 * rateSize + i] = algebraic[i * lanes + lane];
+      sinks[lane]->commitRow();
+    }
   }
+
+  for (lane = 0; lane < lanes; lane++)
+    if (sinks[lane] != NULL)
+      sinks[lane]->flush();
+
+  delete [] acc;
+  delete [] y0;
+}
+
+// Makes every failed lane repeat a lane that is still going, and returns
+// false if there are none left.
+bool
+CDA_LockStepEnsembleRun::RetireFailedLanes
+(
+ LaneFallback& aFallback, uint32_t lanes, double* constants, double* states,
+ double* algebraic, ResultSink** sinks, struct fail_info* failInfos
+)
+{
+  uint32_t lane, going = lanes;
+  for (lane = 0; lane < lanes; lane++)
+    if (sinks[lane] != NULL && !failInfos[lane].failtype)
+    {
+      going = lane;
+      break;
+    }
+  if (going == lanes)
+    return false;
+
+  for (lane = 0; lane < lanes; lane++)
+    if (sinks[lane] == NULL || failInfos[lane].failtype)
+      aFallback.follow(lane, going, constants, states, algebraic);
+  return true;
 }
 
 #ifdef DEBUG_MODE
@@ -1013,6 +1625,9 @@ struct DAEEvaluationInformation
                             double* STATES, double* ALGEBRAIC, double* CONDVAR,
                             struct fail_info* failInfo);
   struct fail_info* failInfo;
+  // Only used by the IDA Jacobian function.
+  void* idaMem;
+  JacobianColouring* colouring;
 
   ~DAEEvaluationInformation()
   {
@@ -1045,6 +1660,86 @@ ida_resfn(double t, N_Vector yy, N_Vector yp, N_Vector resval, void* userdata)
   return d->failInfo->failtype;
 }
 
+// The difference quotient fallback for the IDA dense Jacobian,
+// dF/dy + c_j dF/dy'. The increments follow IDA's own choice, so a column at a
+// time this gives the same estimate as IDA's built-in routine.
+static int
+EstimateJacobianIDA
+(
+ long int N, realtype t, realtype c_j, N_Vector yy, N_Vector yp, N_Vector rr,
+ DlsMat Jac, void* userdata, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3
+)
+{
+  DAEEvaluationInformation* d =
+    reinterpret_cast<DAEEvaluationInformation*>(userdata);
+  JacobianColouring* jc = d->colouring;
+  double* ydata = N_VGetArrayPointer(yy);
+  double* ypdata = N_VGetArrayPointer(yp);
+  double* rdata = N_VGetArrayPointer(rr);
+  double* rtemp = N_VGetArrayPointer(tmp1);
+  double* ewt = N_VGetArrayPointer(tmp2);
+
+  double h;
+  IDAGetCurrentStep(d->idaMem, &h);
+  IDAGetErrWeights(d->idaMem, tmp2);
+  double srur = sqrt(UNIT_ROUNDOFF);
+
+  SetToZero(Jac);
+
+  bool full = jc->NeedsFullEstimate();
+  uint32_t groupCount = full ? N : jc->mGroups.size();
+  for (uint32_t g = 0; g < groupCount; g++)
+  {
+    const std::vector<uint32_t>& group = jc->Group(full, g);
+    std::vector<uint32_t>::const_iterator j;
+    for (j = group.begin(); j != group.end(); j++)
+    {
+      double yj = ydata[*j], ypj = ypdata[*j];
+      double inc = std::max(srur * std::max(fabs(yj), fabs(h * ypj)),
+                            1.0 / ewt[*j]);
+      if (h * ypj < 0.0)
+        inc = -inc;
+      // Use the increment actually represented, to reduce rounding error.
+      inc = (yj + inc) - yj;
+      jc->mSavedStates[*j] = yj;
+      jc->mSavedRates[*j] = ypj;
+      jc->mIncrements[*j] = inc;
+      ydata[*j] += inc;
+      ypdata[*j] += c_j * inc;
+    }
+
+    int ret = ida_resfn(t, yy, yp, tmp1, userdata);
+
+    for (j = group.begin(); j != group.end(); j++)
+    {
+      ydata[*j] = jc->mSavedStates[*j];
+      ypdata[*j] = jc->mSavedRates[*j];
+      double invInc = 1.0 / jc->mIncrements[*j];
+      double* col = DENSE_COL(Jac, *j);
+      if (full)
+      {
+        for (long int i = 0; i < N; i++)
+          col[i] = (rtemp[i] - rdata[i]) * invInc;
+        continue;
+      }
+      const std::vector<uint32_t>& rows = jc->mColumnRows[*j];
+      for (std::vector<uint32_t>::const_iterator i = rows.begin();
+           i != rows.end(); i++)
+        col[*i] = (rtemp[*i] - rdata[*i]) * invInc;
+    }
+
+    // As for CVODE, a recoverable failure that mustn't be left behind.
+    if (ret != 0)
+    {
+      clearFailure(d->failInfo);
+      return 1;
+    }
+  }
+
+  jc->Estimated(full, Jac);
+  return 0;
+}
+
 static int
 ida_rootfn(double t, N_Vector y, N_Vector yp, double *gout, void *userdata)
 {
@@ -1214,10 +1909,8 @@ CDA_DAESolverRun::SolveDAEProblem
   double voi = mStartBvar;
 
   uint32_t recsize = rateSize * 2 + algSize + 1;
-  uint32_t storageCapacity = (VARIABLE_STORAGE_LIMIT / recsize) * recsize;
-  double* storage = new double[storageCapacity];
-  uint32_t storageExpiry = time(0) + VARIABLE_TIME_LIMIT;
-  uint32_t storageSize = 0;
+  ResultRing* ring = new ResultRing(this, mObserver, recsize, mRowsPerBatch,
+                                    mBatchInterval);
   N_Vector y0 = NULL, dy0 = NULL;
 
   if (rateSize != 0)
@@ -1241,6 +1934,8 @@ CDA_DAESolverRun::SolveDAEProblem
   ei.oldrates = new double[rateSize];
   ei.oldstates = new double[stateSize];
   ei.condVarSize = condVarSize;
+  ei.idaMem = idamem;
+  ei.colouring = NULL;
   memcpy(ei.oldrates, rates, rateSize * sizeof(double));
   memcpy(ei.oldstates, states, stateSize * sizeof(double));
 
@@ -1360,9 +2055,24 @@ CDA_DAESolverRun::SolveDAEProblem
       IDASetMaxConvFails(idamem, 100);
       IDARootInit(idamem, condVarSize, ida_rootfn);
       IDASStolerances(idamem, mEpsRel, mEpsAbs);
-      // IDASpgmr(idamem, 0);
-      // IDASptfqmr(idamem, 0);
-      IDADense(idamem, stateSize);
+      switch (mLinearSolver)
+      {
+      case iface::cellml_services::LINEAR_SOLVER_GMRES:
+        IDASpgmr(idamem, 0);
+        break;
+      case iface::cellml_services::LINEAR_SOLVER_BICGSTAB:
+        IDASpbcg(idamem, 0);
+        break;
+      default:
+        // The CCGS doesn't describe the sparsity of the residuals, so there
+        // is no bandwidth to use. The estimate learns which columns can share
+        // evaluations instead, and keeps what it learnt across restarts.
+        IDADense(idamem, stateSize);
+        if (ei.colouring == NULL)
+          ei.colouring = new JacobianColouring(stateSize);
+        IDADlsSetDenseJacFn(idamem, EstimateJacobianIDA);
+        break;
+      }
       IDASetErrHandlerFn(idamem, cda_ida_error_handler, &failInfo);
       IDASetUserData(idamem, &ei);
 
@@ -1376,13 +2086,12 @@ CDA_DAESolverRun::SolveDAEProblem
              voi >= nextStopPoint || voi >= mStopBvar))
         {
           f->EvaluateVariables(voi, constants, rates, states, algebraic, condvars, &failInfo);
-          storage[storageSize] = voi;
-          memcpy(storage + storageSize + 1, states, rateSize * sizeof(double));
-          memcpy(storage + storageSize + 1 + rateSize, rates,
-                 rateSize * sizeof(double));
-          memcpy(storage + storageSize + 1 + rateSize * 2, algebraic,
-                 algSize * sizeof(double));
-          storageSize += recsize;
+          double* row = ring->beginRow();
+          row[0] = voi;
+          memcpy(row + 1, states, rateSize * sizeof(double));
+          memcpy(row + 1 + rateSize, rates, rateSize * sizeof(double));
+          memcpy(row + 1 + rateSize * 2, algebraic, algSize * sizeof(double));
+          ring->commitRow();
           
           nextStopPoint = mTabulationStepSize == 0.0 ? mStopBvar :
             (mTabulationStepSize * ++tabStepNumber) + mStartBvar;
@@ -1439,27 +2148,12 @@ CDA_DAESolverRun::SolveDAEProblem
       
         if (!restart)
         {
-          // Add to storage...
-          storage[storageSize] = voi;
-          memcpy(storage + storageSize + 1, states, rateSize * sizeof(double));
-          memcpy(storage + storageSize + 1 + rateSize, rates,
-                 rateSize * sizeof(double));
-          memcpy(storage + storageSize + 1 + rateSize * 2, algebraic,
-                 algSize * sizeof(double));
-          storageSize += recsize;
-        }
-      
-        // Are we ready to send?
-        uint32_t timeNow = time(0);
-        if (timeNow >= storageExpiry || storageSize == storageCapacity)
-        {
-          if (mObserver != NULL)
-          {
-            std::vector<double> resultsVector(storage, storage + storageSize);
-            mObserver->results(resultsVector);
-          }
-          storageExpiry = timeNow + VARIABLE_TIME_LIMIT;
-          storageSize = 0;
+          double* row = ring->beginRow();
+          row[0] = voi;
+          memcpy(row + 1, states, rateSize * sizeof(double));
+          memcpy(row + 1 + rateSize, rates, rateSize * sizeof(double));
+          memcpy(row + 1 + rateSize * 2, algebraic, algSize * sizeof(double));
+          ring->commitRow();
         }
       }
     }
@@ -1467,6 +2161,7 @@ CDA_DAESolverRun::SolveDAEProblem
 
   delete [] ei.oldstates;
   delete [] ei.oldrates;
+  delete ei.colouring;
   delete [] hx;
   delete [] icinfo;
   delete [] ivf.hxtmp;
@@ -1475,13 +2170,8 @@ CDA_DAESolverRun::SolveDAEProblem
   N_VDestroy(ones);
   N_VDestroy(params);
 
-  if (storageSize != 0 && mObserver != NULL)
-  {
-    std::vector<double> resultsVector(storage, storage + storageSize);
-    mObserver->results(resultsVector);
-  }
-
-  delete [] storage;
+  // Sends the remaining rows, and waits for the observer to get them all.
+  delete ring;
 
   if (rateSize != 0)
   {
@@ -3178,6 +3868,11 @@ static int
 adaptNonlinearsolve(N_Vector p, N_Vector hx, void* adata)
 {
   struct Adapt_NLS_Data* adapt = reinterpret_cast<struct Adapt_NLS_Data*>(adata);
+  // Torn assignments in the objective function return early once a failure
+  // is recorded, so a failure left over from an earlier evaluation must not
+  // stop this one, and a residual that wasn't filled in counts as a failure.
+  clearFailure(adapt->failInfo);
+  N_VConst(strtod("NAN", NULL), hx);
   adapt->f(NV_DATA_S(p), NV_DATA_S(hx), adapt->adata);
   for (int i = 0; i < adapt->n; i++)
     if (!cdamath::isfinite(NV_Ith_S(hx, i)))
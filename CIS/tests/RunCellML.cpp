@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <cstring>
+#include <cmath>
 #include <wchar.h>
 #ifndef WIN32
 #include <sys/time.h>
@@ -30,8 +31,10 @@ double gStart = 0.0, gStop = 10.0, gDensity = 1000.0;
 double gTabStep = 0.0;
 bool gTStrict = false;
 bool gDebugSim = false;
+const char* gCompiler = NULL;
 double gRealTimeFactor = 0.0;
 uint32_t gSleepTime = 0;
+uint32_t gEnsembleMembers = 0, gLockStepLanes = 0;
 
 
 #ifdef WIN32
@@ -58,6 +61,95 @@ static int gettimeofday(struct timeval* tv, struct timezone* tz)
 }
 #endif
 
+static void
+PrintHeader(iface::cellml_services::CodeInformation* aCI)
+{
+  ObjRef<iface::cellml_services::ComputationTargetIterator> cti =
+    aCI->iterateTargets();
+  bool first = true;
+
+  while (true)
+  {
+    ObjRef<iface::cellml_services::ComputationTarget> ct = cti->nextComputationTarget();
+    if (ct == NULL)
+      break;
+    if ((ct->type() == iface::cellml_services::STATE_VARIABLE ||
+         ct->type() == iface::cellml_services::PSEUDOSTATE_VARIABLE ||
+         ct->type() == iface::cellml_services::ALGEBRAIC ||
+         ct->type() == iface::cellml_services::VARIABLE_OF_INTEGRATION) &&
+        ct->degree() == 0)
+    {
+      ObjRef<iface::cellml_api::CellMLVariable> source = ct->variable();
+      std::wstring n = source->name();
+      printf(first ? "\"%S\"" : ",\"%S\"", n.c_str());
+      first = false;
+    }
+  }
+  printf("\n");
+}
+
+static void
+PrintComputedConstants(iface::cellml_services::CodeInformation* aCI,
+                       const std::vector<double>& values)
+{
+  ObjRef<iface::cellml_services::ComputationTargetIterator> cti =
+    aCI->iterateTargets();
+  while (true)
+  {
+    ObjRef<iface::cellml_services::ComputationTarget> ct = cti->nextComputationTarget();
+    if (ct == NULL)
+      break;
+    if (ct->type() == iface::cellml_services::CONSTANT &&
+        ct->degree() == 0)
+    {
+      ObjRef<iface::cellml_api::CellMLVariable> source = ct->variable();
+      std::wstring n = source->name();
+      printf("# Computed constant: %S = %e\n", n.c_str(), values[ct->assignedIndex()]);
+    }
+  }
+}
+
+static void
+PrintRow(iface::cellml_services::CodeInformation* aCI, const double* aRow)
+{
+  uint32_t ric = aCI->rateIndexCount();
+  bool first = true;
+  ObjRef<iface::cellml_services::ComputationTargetIterator> cti =
+    aCI->iterateTargets();
+  while (true)
+  {
+    ObjRef<iface::cellml_services::ComputationTarget> ct = cti->nextComputationTarget();
+    if (ct == NULL)
+      break;
+
+    if (ct->degree() != 0)
+      continue;
+
+    iface::cellml_services::VariableEvaluationType et = ct->type();
+    uint32_t varOff = 0;
+
+    switch (et)
+    {
+    case iface::cellml_services::STATE_VARIABLE:
+    case iface::cellml_services::PSEUDOSTATE_VARIABLE:
+      varOff = 1 + ct->assignedIndex();
+      break;
+    case iface::cellml_services::VARIABLE_OF_INTEGRATION:
+      varOff = 0;
+      break;
+    case iface::cellml_services::ALGEBRAIC:
+      varOff = 1 + 2 * ric + ct->assignedIndex();
+      break;
+    default:
+      continue;
+    }
+
+    printf(first ? "\"%g\"" : ",\"%g\"", aRow[varOff]);
+    first = false;
+  }
+  puts("");
+}
+
 class TestProgressObserver
   : public iface::cellml_services::IntegrationProgressObserver
 {
@@ -68,29 +160,7 @@ public:
   {
     mCCM = aCCM;
     mCI = mCCM->codeInformation();
-
-    ObjRef<iface::cellml_services::ComputationTargetIterator> cti =
-      mCI->iterateTargets();
-    bool first = true;
-
-    while (true)
-    {
-      ObjRef<iface::cellml_services::ComputationTarget> ct = cti->nextComputationTarget();
-      if (ct == NULL)
-        break;
-      if ((ct->type() == iface::cellml_services::STATE_VARIABLE ||
-           ct->type() == iface::cellml_services::PSEUDOSTATE_VARIABLE ||
-           ct->type() == iface::cellml_services::ALGEBRAIC ||
-           ct->type() == iface::cellml_services::VARIABLE_OF_INTEGRATION) &&
-          ct->degree() == 0)
-      {
-        ObjRef<iface::cellml_api::CellMLVariable> source = ct->variable();
-	std::wstring n = source->name();
-        printf(first ? "\"%S\"" : ",\"%S\"", n.c_str());
-        first = false;
-      }
-    }
-    printf("\n");
+    PrintHeader(mCI);
   }
 
   ~TestProgressObserver()
@@ -159,21 +229,7 @@ public:
   void computedConstants(const std::vector<double>& values)
     throw (std::exception&)
   {
-    ObjRef<iface::cellml_services::ComputationTargetIterator> cti =
-      mCI->iterateTargets();
-    while (true)
-    {
-      ObjRef<iface::cellml_services::ComputationTarget> ct = cti->nextComputationTarget();
-      if (ct == NULL)
-        break;
-      if (ct->type() == iface::cellml_services::CONSTANT &&
-          ct->degree() == 0)
-      {
-        ObjRef<iface::cellml_api::CellMLVariable> source = ct->variable();
-	std::wstring n = source->name();
-        printf("# Computed constant: %S = %e\n", n.c_str(), values[ct->assignedIndex()]);
-      }
-    }
+    PrintComputedConstants(mCI, values);
   }
 
   void results(const std::vector<double>& values)
@@ -216,43 +272,7 @@ public:
         }
       }
 
-      bool first = true;
-      ObjRef<iface::cellml_services::ComputationTargetIterator> cti =
-        mCI->iterateTargets();
-      while (true)
-      {
-        ObjRef<iface::cellml_services::ComputationTarget> ct = cti->nextComputationTarget();
-        if (ct == NULL)
-          break;
-
-        if (ct->degree() != 0)
-          continue;
-
-        iface::cellml_services::VariableEvaluationType et = ct->type();
-        uint32_t varOff = 0;
-        
-        switch (et)
-        {
-        case iface::cellml_services::STATE_VARIABLE:
-        case iface::cellml_services::PSEUDOSTATE_VARIABLE:
-          varOff = 1 + ct->assignedIndex();
-          break;
-        case iface::cellml_services::VARIABLE_OF_INTEGRATION:
-          varOff = 0;
-          break;
-        case iface::cellml_services::ALGEBRAIC:
-          varOff = 1 + 2 * ric + ct->assignedIndex();
-          break;
-        default:
-          continue;
-        }
-
-        printf(first ? "\"%g\"" : ",\"%g\"", values[i + varOff]);
-        // if (et == iface::cellml_services::STATE_VARIABLE)
-        //   printf("(\"%g\")", values[i + varOff + ric]);
-        first = false;
-      }
-      puts("");
+      PrintRow(mCI, &values[i]);
     }
   }
 
@@ -280,6 +300,152 @@ private:
   iface::cellml_services::CellMLIntegrationRun* mRun;
 };
 
+// Prints the results of member 0 of an ensemble, in the same format as
+// TestProgressObserver, and checks that every other member (all of which are
+// given the same parameters) produced the same results.
+class TestEnsembleObserver
+  : public iface::cellml_services::EnsembleProgressObserver
+{
+public:
+  TestEnsembleObserver(iface::cellml_services::CellMLCompiledModel* aCCM,
+                       uint32_t aMemberCount)
+    : mRefcount(1), mConstants(aMemberCount), mRows(aMemberCount),
+      mFinished(aMemberCount, false)
+  {
+    mCI = aCCM->codeInformation();
+    PrintHeader(mCI);
+  }
+
+  void add_ref()
+    throw(std::exception&)
+  {
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+    __sync_fetch_and_add(&mRefcount, 1);
+#elif defined(WIN32)
+    InterlockedIncrement((volatile long int*)&mRefcount);
+#else
+    mRefcount++;
+#endif
+  }
+
+  void release_ref()
+    throw(std::exception&)
+  {
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+    if (__sync_sub_and_fetch(&mRefcount, 1) == 0)
+      delete this;
+#elif defined(WIN32)
+    if (InterlockedDecrement((volatile long int*)&mRefcount) == 0)
+      delete this;
+#else
+    mRefcount--;
+    if (mRefcount == 0)
+      delete this;
+#endif
+  }
+
+  std::string objid()
+    throw (std::exception&)
+  {
+    return "singletonTestEnsembleObserver";
+  }
+
+  void* query_interface(const std::string& iface)
+    throw (std::exception&)
+  {
+    add_ref();
+    if (iface == "XPCOM::IObject")
+      return static_cast< ::iface::XPCOM::IObject* >(this);
+    else if (iface == "cellml_services::EnsembleProgressObserver")
+      return
+        static_cast< ::iface::cellml_services::EnsembleProgressObserver*>
+        (this);
+    release_ref();
+    return NULL;
+  }
+
+  std::vector<std::string> supported_interfaces() throw()
+  {
+    std::vector<std::string> ret;
+    ret.push_back("XPCOM::IObject");
+    ret.push_back("cellml_services::EnsembleProgressObserver");
+    return ret;
+  }
+
+  // Observer calls are serialised by the run, so no locking is needed here.
+  void computedConstants(uint32_t member, const std::vector<double>& values)
+    throw (std::exception&)
+  {
+    if (member == 0)
+      PrintComputedConstants(mCI, values);
+    mConstants[member] = values;
+  }
+
+  void results(uint32_t member, const std::vector<double>& values)
+    throw (std::exception&)
+  {
+    uint32_t recsize = 2 * mCI->rateIndexCount() + mCI->algebraicIndexCount() + 1;
+    if (recsize == 1)
+      return;
+
+    if (member == 0)
+      for (uint32_t i = 0; i < values.size(); i += recsize)
+        PrintRow(mCI, &values[i]);
+    mRows[member].insert(mRows[member].end(), values.begin(), values.end());
+  }
+
+  void memberDone(uint32_t member)
+    throw (std::exception&)
+  {
+    mFinished[member] = true;
+  }
+
+  void memberFailed(uint32_t member, const std::string& errmsg)
+    throw (std::exception&)
+  {
+    mFinished[member] = true;
+    if (member == 0)
+      printf("# Integration failed (%s)\n", errmsg.c_str());
+    else
+      printf("# Member %u failed (%s)\n", member, errmsg.c_str());
+  }
+
+  void done()
+    throw (std::exception&)
+  {
+    for (uint32_t m = 1; m < mRows.size(); m++)
+    {
+      if (!mFinished[m])
+        printf("# Member %u never finished\n", m);
+      else if (!SameValues(mConstants[m], mConstants[0]) ||
+               !SameValues(mRows[m], mRows[0]))
+        printf("# Member %u differs from member 0\n", m);
+    }
+
+    printf("# Run completed.\n");
+    CDALock l(gFinishedMutex);
+    gFinished = true;
+  }
+
+private:
+  static bool SameValues(const std::vector<double>& a,
+                         const std::vector<double>& b)
+  {
+    if (a.size() != b.size())
+      return false;
+    for (uint32_t i = 0; i < a.size(); i++)
+      if (fabs(a[i] - b[i]) > 1E-9 * (fabs(a[i]) + fabs(b[i])) &&
+          !(a[i] != a[i] && b[i] != b[i]))
+        return false;
+    return true;
+  }
+
+  uint32_t mRefcount;
+  ObjRef<iface::cellml_services::CodeInformation> mCI;
+  std::vector<std::vector<double> > mConstants, mRows;
+  std::vector<bool> mFinished;
+};
+
 void ProcessInitialKeywords(int argc, char** argv)
 {
   // Scoped locale change.
@@ -303,12 +469,41 @@ void ProcessInitialKeywords(int argc, char** argv)
       else
         printf("# Warning: debug command given unrecognised value - true and false accepted.\n");
     }
+    else if (!strcasecmp(command, "compiler"))
+    {
+      if (!strcasecmp(value, "external") || !strcasecmp(value, "jit"))
+        gCompiler = value;
+      else
+        printf("# Warning: compiler command given unrecognised value - external and jit accepted.\n");
+    }
+    else if (!strcasecmp(command, "ensemble"))
+      gEnsembleMembers = strtoul(value, NULL, 10);
+    else if (!strcasecmp(command, "lock_step"))
+      gLockStepLanes = strtoul(value, NULL, 10);
   }
 }
 
-void
-ProcessKeywords(int argc, char** argv,
-                iface::cellml_services::CellMLIntegrationRun* run)
+static void
+SetStepType(iface::cellml_services::CellMLIntegrationRun* run,
+            iface::cellml_services::ODEIntegrationStepType ist)
+{
+  DECLARE_QUERY_INTERFACE_OBJREF(osr, run, cellml_services::ODESolverRun);
+  if (osr == NULL)
+    printf("Warning: step_type not IDA on IDA SolverRun. Probably multiple step_types set.\n");
+  else
+    osr->stepType(ist);
+}
+
+static void
+SetStepType(iface::cellml_services::ODEEnsembleRun* run,
+            iface::cellml_services::ODEIntegrationStepType ist)
+{
+  run->stepType(ist);
+}
+
+// Applies the options to a CellMLIntegrationRun or an ODEEnsembleRun.
+template<class Run> void
+ProcessKeywords(int argc, char** argv, Run* run)
 {
   // Scoped locale change.
   CNumericLocale locobj;
@@ -360,11 +555,7 @@ ProcessKeywords(int argc, char** argv,
         continue;
       }
 
-      DECLARE_QUERY_INTERFACE_OBJREF(osr, run, cellml_services::ODESolverRun);
-      if (osr == NULL)
-        printf("Warning: step_type not IDA on IDA SolverRun. Probably multiple step_types set.\n");
-      else
-        osr->stepType(ist);
+      SetStepType(run, ist);
     }
     else if (!strcasecmp(command, "step_size_control"))
     {
@@ -462,6 +653,40 @@ ProcessKeywords(int argc, char** argv,
       gTabStep = tabstepsize;
       gTStrict = tstrict;
     }
+    else if (!strcasecmp(command, "linear_solver"))
+    {
+      iface::cellml_services::LinearSolverType lst;
+      if (!strcasecmp(value, "automatic"))
+        lst = iface::cellml_services::LINEAR_SOLVER_AUTOMATIC;
+      else if (!strcasecmp(value, "dense"))
+        lst = iface::cellml_services::LINEAR_SOLVER_DENSE;
+      else if (!strcasecmp(value, "banded"))
+        lst = iface::cellml_services::LINEAR_SOLVER_BANDED;
+      else if (!strcasecmp(value, "gmres"))
+        lst = iface::cellml_services::LINEAR_SOLVER_GMRES;
+      else if (!strcasecmp(value, "bicgstab"))
+        lst = iface::cellml_services::LINEAR_SOLVER_BICGSTAB;
+      else
+      {
+        printf("# Warning: Unsupported linear_solver value %s (ignored)\n",
+               value);
+        continue;
+      }
+      run->linearSolver(lst);
+    }
+    else if (!strcasecmp(command, "result_batching"))
+    {
+      uint32_t rowsPerBatch = strtoul(value, &value, 10);
+      if (*value != ',')
+      {
+        printf("# Warning: Expected ',' after rows per batch. "
+               "result_batching ignored.\n");
+        continue;
+      }
+      value++;
+      double batchInterval = strtod(value, &value);
+      run->setResultBatching(rowsPerBatch, batchInterval);
+    }
     // A special undocumented debugging command...
     else if (!strcasecmp(command, "sleep_time"))
     {
@@ -471,7 +696,9 @@ ProcessKeywords(int argc, char** argv,
     {
       gRealTimeFactor = strtod(value, NULL);
     }
-    else if (!strcasecmp(command, "debug"))
+    else if (!strcasecmp(command, "debug") || !strcasecmp(command, "compiler") ||
+             !strcasecmp(command, "ensemble") ||
+             !strcasecmp(command, "lock_step"))
       ; // ProcessInitialKeywords
     else
       printf("# Warning: Unrecognised command %s. Ignored.\n",
@@ -521,7 +748,7 @@ IDAMain(iface::cellml_services::CellMLIntegrationService* cis,
   ObjRef<TestProgressObserver> tpo = already_AddRefd<TestProgressObserver>(new TestProgressObserver(ccm, cir));
   cir->setProgressObserver(tpo);
 
-  ProcessKeywords(argc, argv, cir);
+  ProcessKeywords(argc, argv, cir.getPointer());
 
 #ifdef ENABLE_FIND_NUMERIC_ERRORS
   feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW | FE_UNDERFLOW);
@@ -573,7 +800,7 @@ ODEMain(iface::cellml_services::CellMLIntegrationService* cis,
   ObjRef<TestProgressObserver> tpo = already_AddRefd<TestProgressObserver>(new TestProgressObserver(ccm, cir));
   cir->setProgressObserver(tpo);
 
-  ProcessKeywords(argc, argv, cir);
+  ProcessKeywords(argc, argv, cir.getPointer());
 
 #ifdef ENABLE_FIND_NUMERIC_ERRORS
   feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW | FE_UNDERFLOW);
@@ -596,6 +823,70 @@ ODEMain(iface::cellml_services::CellMLIntegrationService* cis,
   return 0;
 }
 
+int
+EnsembleMain(iface::cellml_services::CellMLIntegrationService* cis,
+             iface::cellml_api::Model* mod, int argc, char** argv)
+{
+  ObjRef<iface::cellml_services::CellMLCompiledModel> ccm;
+  ObjRef<iface::cellml_services::ODEEnsembleRun> cer;
+  try
+  {
+    printf("# Compiling model...\n");
+    if (gLockStepLanes != 0)
+    {
+      ObjRef<iface::cellml_services::VectorisedODESolverCompiledModel> vccm =
+        cis->compileVectorisedModelODE(mod, gLockStepLanes);
+      ccm = vccm;
+      printf("# Creating run...\n");
+      cer = cis->createLockStepEnsembleRun(vccm);
+    }
+    else
+    {
+      ObjRef<iface::cellml_services::ODESolverCompiledModel> occm =
+        gDebugSim ? cis->compileDebugModelODE(mod) : cis->compileModelODE(mod);
+      ccm = occm;
+      printf("# Creating run...\n");
+      cer = cis->createODEEnsembleRun(occm);
+    }
+  }
+  catch (iface::cellml_api::CellMLException& ce)
+  {
+    std::wstring err = cis->lastError();
+    printf("Caught a CellMLException while compiling model: %S\n", err.c_str());
+    return -1;
+  }
+
+  ObjRef<TestEnsembleObserver> teo =
+    already_AddRefd<TestEnsembleObserver>
+    (new TestEnsembleObserver(ccm, gEnsembleMembers));
+  cer->setProgressObserver(teo);
+
+  ProcessKeywords(argc, argv, cer.getPointer());
+
+  // Every member has the model's own parameters.
+  std::vector<double> none;
+  cer->setEnsemble(gEnsembleMembers, none, none);
+  // Share the members between threads even on a single processor.
+  cer->workerCount(2);
+
+  cer->start();
+  // Pausing must not lose or reorder any results.
+  cer->pause();
+  usleep(100000);
+  cer->resume();
+
+  while (1)
+  {
+    {
+      CDALock l(gFinishedMutex);
+      if (gFinished) break;
+    }
+    sleep(1);
+  }
+
+  return 0;
+}
+
 int
 main(int argc, char** argv)
 {
@@ -636,11 +927,26 @@ main(int argc, char** argv)
            "    => Sets the interval in the bound variable for guaranteed values in other variables,\n"
            "       and whether to only tabulate values at points that are thus guaranteed.\n"
            "       step_size: A floating point tabulation step size.\n"
+           "  linear_solver automatic|dense|banded|gmres|bicgstab\n"
+           "    => Sets the linear solver used by BDF15SIMP and IDA.\n"
+           "  result_batching rows,interval\n"
+           "    => Sends results to the observer in batches of at most rows rows\n"
+           "       (0 for as many as fit in 2MB), held back for at most interval\n"
+           "       seconds (0 for no limit).\n"
            "  real_time_factor number\n"
            "    => Slows the simulation so that number real seconds elapse for \n"
            "       each unit of time in the simulation.\n" 
            "  debug true|false\n"
            "    => Specifies whether or not to use debug mode.\n"
+           "  ensemble members\n"
+           "    => Integrates an ensemble of this many identical members, prints\n"
+           "       the results of the first, and checks the others match it.\n"
+           "  lock_step lanes\n"
+           "    => Integrates the ensemble in lock-step, this many members at a\n"
+           "       time. Needs step_type RK4; the fixed step is max_step.\n"
+           "  compiler external|jit\n"
+           "    => Compile the model with an external C compiler, or in-process.\n"
+           "       The default is jit when this build supports it.\n"
           );
     return -1;
   }
@@ -681,10 +987,27 @@ main(int argc, char** argv)
   ObjRef<iface::cellml_services::CellMLIntegrationService> cis =
     CreateIntegrationService();
 
+  if (gCompiler != NULL)
+  {
+    try
+    {
+      cis->compilerBackend(!strcasecmp(gCompiler, "jit") ?
+                           iface::cellml_services::COMPILER_JIT :
+                           iface::cellml_services::COMPILER_EXTERNAL);
+    }
+    catch (iface::cellml_api::CellMLException&)
+    {
+      printf("# Warning: compiler %s is not available in this build (ignored).\n",
+             gCompiler);
+    }
+  }
+
   int ret;
 
   if (PeekForIDA(argc, argv))
     ret = IDAMain(cis, mod, argc, argv);
+  else if (gEnsembleMembers != 0)
+    ret = EnsembleMain(cis, mod, argc, argv);
   else
     ret = ODEMain(cis, mod, argc, argv);
 
@@ -288,11 +288,7 @@ CDA_CodeExporter::getCodeSection(const std::wstring& name)
       // If text contains solver parameters that need to be replaced
       if (params == L"true" || params == L"1")
       {
-        replaceParameter(nodeContents, L"<RANGESTART>", mRangeStart);
-        replaceParameter(nodeContents, L"<RANGEEND>", mRangeEnd);
-        replaceParameter(nodeContents, L"<ABSTOL>", mAbsTol);
-        replaceParameter(nodeContents, L"<RELTOL>", mRelTol);
-        replaceParameter(nodeContents, L"<MAXSTEP>", mMaxStep);
+        replaceSolverParameters(nodeContents);
       }
 
       return nodeContents;
@@ -333,16 +329,42 @@ CDA_CodeExporter::getAlgebraic(const std::wstring& ratesCalc, const std::wstring
 }
 
 void
-CDA_CodeExporter::replaceParameter(std::wstring &code, const std::wstring& parameter, double value)
+CDA_CodeExporter::replaceSolverParameters(std::wstring &code)
   throw(std::exception&)
 {
-  std::wstring param(parameter);
-  size_t pos = code.find(parameter);
-  while (pos != std::wstring::npos)
+  static const wchar_t* names[] =
+    { L"<RANGESTART>", L"<RANGEEND>", L"<ABSTOL>", L"<RELTOL>", L"<MAXSTEP>" };
+  const int count = sizeof(names) / sizeof(names[0]);
+  std::wstring values[count] =
+    { toStr(mRangeStart), toStr(mRangeEnd), toStr(mAbsTol), toStr(mRelTol),
+      toStr(mMaxStep) };
+
+  // Build the result up a piece at a time, rather than replacing in place and
+  // shifting the rest of the string each time...
+  std::wstring result;
+  size_t start = 0, pos = 0;
+  while ((pos = code.find(L'<', pos)) != std::wstring::npos)
   {
-    code.replace(pos, param.length(), toStr(value));
-    pos = code.find(parameter);
+    int i;
+    for (i = 0; i < count; i++)
+      if (!code.compare(pos, wcslen(names[i]), names[i]))
+        break;
+    if (i == count)
+    {
+      pos++;
+      continue;
+    }
+
+    result.append(code, start, pos - start);
+    result += values[i];
+    pos += wcslen(names[i]);
+    start = pos;
   }
+
+  if (start == 0)
+    return;
+  result.append(code, start, std::wstring::npos);
+  code.swap(result);
 }
 
 std::wstring
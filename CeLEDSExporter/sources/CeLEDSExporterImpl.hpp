@@ -50,8 +50,9 @@ private:
   std::wstring getAlgebraic(const std::wstring& ratesCalc, const std::wstring& algebraicNamePattern)
     throw(std::exception&);
 
-  // replace a parameter in a string with it's value, eg replace <MAXSTEP> with 0.1
-  void replaceParameter(std::wstring &code, const std::wstring& parameter, double value)
+  // replace the solver parameters in a string with their values, eg replace
+  // <MAXSTEP> with 0.1, in one pass over the string
+  void replaceSolverParameters(std::wstring &code)
     throw(std::exception&);
 
   // return definitions of extra functions required
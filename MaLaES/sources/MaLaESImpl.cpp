@@ -922,6 +922,9 @@ CDAMaLaESResult::getDiffDegree(iface::cellml_api::CellMLVariable* aVar)
 CDAMaLaESTransform::CDAMaLaESTransform(const std::wstring& aSpec)
   : mVariablesFromSource(true)
 {
+  // Set this up now, while only one thread can see us...
+  EnsureDefaultOperator();
+
   stringpairlist tags;
   GetTagsForSpec(aSpec, tags);
 
@@ -1905,11 +1908,78 @@ CDAMaLaESBootstrap::~CDAMaLaESBootstrap()
 {
 }
 
+// The most compiled transforms kept for reuse. Callers almost always use one
+// of a few built-in specifications, so this is only reached if something is
+// compiling transforms from generated specifications.
+#define MAX_CACHED_TRANSFORMS 32
+
+// Transforms compiled so far, most recently used first. A transform never
+// changes once it has been compiled, so everyone asking for the same
+// specification, on any thread, can share one.
+typedef std::list<std::pair<std::wstring, CDAMaLaESTransform*> >
+  CachedTransformList;
+static CachedTransformList* sTransformUsage;
+// Finds each specification's place in sTransformUsage.
+static std::map<std::wstring, CachedTransformList::iterator>* sTransformCache;
+static CDAMutex* sTransformCacheMutex;
+
+static void
+EnsureTransformCache()
+{
+  if (sTransformCache != NULL)
+    return;
+  sTransformUsage = new CachedTransformList();
+  sTransformCache = new std::map<std::wstring, CachedTransformList::iterator>();
+  sTransformCacheMutex = new CDAMutex();
+}
+
+// Sets up the cache while the library is loaded, before other threads can be
+// compiling transforms.
+class TransformCacheInitialiser
+{
+public:
+  TransformCacheInitialiser()
+  {
+    EnsureTransformCache();
+  }
+};
+static TransformCacheInitialiser sTransformCacheInitialiser;
+
 already_AddRefd<iface::cellml_services::MaLaESTransform>
 CDAMaLaESBootstrap::compileTransformer(const std::wstring& aSpec)
   throw(std::exception&)
 {
-  return new CDAMaLaESTransform(aSpec);
+  EnsureTransformCache();
+  CDALock l(*sTransformCacheMutex);
+
+  std::map<std::wstring, CachedTransformList::iterator>::iterator i =
+    sTransformCache->find(aSpec);
+  if (i != sTransformCache->end())
+  {
+    sTransformUsage->splice(sTransformUsage->begin(), *sTransformUsage,
+                            (*i).second);
+    CDAMaLaESTransform* t = (*(*i).second).second;
+    t->add_ref();
+    return t;
+  }
+
+  if (sTransformCache->size() >= MAX_CACHED_TRANSFORMS)
+  {
+    // Forget the least recently used; anyone still using it keeps their own
+    // reference...
+    sTransformCache->erase(sTransformUsage->back().first);
+    sTransformUsage->back().second->release_ref();
+    sTransformUsage->pop_back();
+  }
+
+  CDAMaLaESTransform* t = new CDAMaLaESTransform(aSpec);
+  sTransformUsage->push_front
+    (std::pair<std::wstring, CDAMaLaESTransform*>(aSpec, t));
+  sTransformCache->insert
+    (std::pair<std::wstring, CachedTransformList::iterator>
+     (aSpec, sTransformUsage->begin()));
+  t->add_ref();
+  return t;
 }
 
 static std::wstring
@@ -670,7 +670,9 @@ SEDMLMathEvaluator::evalPiecewise(iface::mathml_dom::MathMLPiecewiseElement* mpe
 
     RETURN_INTO_OBJREF(cc, iface::mathml_dom::MathMLContentElement, mc->caseCondition());
     RETURN_INTO_OBJREF(cv, iface::mathml_dom::MathMLContentElement, mc->caseValue());
-    if (eval(cc) != 0.0)
+    // When exploring, every case is still evaluated, but the first case that
+    // holds gives the result, as it does otherwise.
+    if (!gotResult && eval(cc) != 0.0)
     {
       gotResult = true;
       result = eval(cv);
@@ -678,7 +680,10 @@ SEDMLMathEvaluator::evalPiecewise(iface::mathml_dom::MathMLPiecewiseElement* mpe
         return result;
     }
     else if (mExploreEverything)
+    {
+      eval(cc);
       eval(cv);
+    }
   }
 
   RETURN_INTO_OBJREF(ow, iface::mathml_dom::MathMLContentElement, mpe->otherwise());
@@ -769,3 +774,501 @@ SEDMLMathEvaluatorWithAggregate::evalAggregate
 
   return (*ag)(vals);
 }
+
+// The number of points SEDMLCompiledMath evaluates at once; small enough that
+// the registers stay in cache.
+#define COMPILED_MATH_BLOCK_SIZE 256
+
+static double compiledAbs(double x) { return std::abs(x); }
+static double compiledArccos(double x) { return std::acos(x); }
+static double compiledArccot(double x) { return std::atan(1.0 / x); }
+static double compiledArccsc(double x) { return std::asin(1.0 / x); }
+static double compiledArcsec(double x) { return std::acos(1.0 / x); }
+static double compiledArcsin(double x) { return std::asin(x); }
+static double compiledArctan(double x) { return std::atan(x); }
+#ifndef _MSC_VER
+static double compiledArccosh(double x) { return acosh(x); }
+static double compiledArccoth(double x) { return atanh(1.0 / x); }
+static double compiledArccsch(double x) { return asinh(1.0 / x); }
+static double compiledArcsech(double x) { return acosh(1.0 / x); }
+static double compiledArcsinh(double x) { return asinh(x); }
+static double compiledArctanh(double x) { return atanh(x); }
+#endif
+static double compiledCeiling(double x) { return std::ceil(x); }
+static double compiledCos(double x) { return std::cos(x); }
+static double compiledCosh(double x) { return std::cosh(x); }
+static double compiledCot(double x) { return 1.0 / std::tan(x); }
+static double compiledCoth(double x) { return 1.0 / std::tanh(x); }
+static double compiledCsc(double x) { return 1.0 / std::sin(x); }
+static double compiledCsch(double x) { return 1.0 / std::sinh(x); }
+static double compiledExp(double x) { return std::exp(x); }
+static double compiledFloor(double x) { return std::floor(x); }
+static double compiledLn(double x) { return std::log(x); }
+static double compiledLog10(double x) { return std::log10(x); }
+static double compiledNot(double x) { return (x == 0.0) ? 1.0 : 0.0; }
+static double compiledSec(double x) { return 1.0 / std::cos(x); }
+static double compiledSech(double x) { return 1.0 / std::cosh(x); }
+static double compiledSin(double x) { return std::sin(x); }
+static double compiledSinh(double x) { return std::sinh(x); }
+static double compiledSqrt(double x) { return std::sqrt(x); }
+static double compiledTan(double x) { return std::tan(x); }
+static double compiledTanh(double x) { return std::tanh(x); }
+
+static double
+compiledFactorial(double x)
+{
+  double v = 1.0;
+  for (double m = x; m > 0; m -= 1.0)
+    v *= m;
+  return v;
+}
+
+static double compiledEq(double x, double y) { return (x == y) ? 1.0 : 0.0; }
+static double compiledNeq(double x, double y) { return (x != y) ? 1.0 : 0.0; }
+static double compiledGeq(double x, double y) { return (x >= y) ? 1.0 : 0.0; }
+static double compiledGt(double x, double y) { return (x > y) ? 1.0 : 0.0; }
+static double compiledLeq(double x, double y) { return (x <= y) ? 1.0 : 0.0; }
+static double compiledLt(double x, double y) { return (x < y) ? 1.0 : 0.0; }
+static double compiledPower(double x, double y) { return std::pow(x, y); }
+static double compiledLogBase(double x, double y) { return std::log(x) / std::log(y); }
+static double compiledRoot(double x, double y) { return std::pow(x, 1.0 / y); }
+
+static double
+compiledXor(double x, double y)
+{
+  return ((x == 0) != (y == 0)) ? 1.0 : 0.0;
+}
+
+struct CompiledUnaryOperator
+{
+  const wchar_t* mName;
+  double (*mFunction)(double);
+};
+
+static const CompiledUnaryOperator sCompiledUnaryOperators[] =
+{
+  {L"abs", compiledAbs},
+  {L"arccos", compiledArccos},
+  {L"arccot", compiledArccot},
+  {L"arccsc", compiledArccsc},
+  {L"arcsec", compiledArcsec},
+  {L"arcsin", compiledArcsin},
+  {L"arctan", compiledArctan},
+#ifndef _MSC_VER
+  {L"arccosh", compiledArccosh},
+  {L"arccoth", compiledArccoth},
+  {L"arccsch", compiledArccsch},
+  {L"arcsech", compiledArcsech},
+  {L"arcsinh", compiledArcsinh},
+  {L"arctanh", compiledArctanh},
+#endif
+  {L"ceiling", compiledCeiling},
+  {L"cos", compiledCos},
+  {L"cosh", compiledCosh},
+  {L"cot", compiledCot},
+  {L"coth", compiledCoth},
+  {L"csc", compiledCsc},
+  {L"csch", compiledCsch},
+  {L"exp", compiledExp},
+  {L"factorial", compiledFactorial},
+  {L"floor", compiledFloor},
+  {L"ln", compiledLn},
+  {L"not", compiledNot},
+  {L"sec", compiledSec},
+  {L"sech", compiledSech},
+  {L"sin", compiledSin},
+  {L"sinh", compiledSinh},
+  {L"tan", compiledTan},
+  {L"tanh", compiledTanh},
+  {NULL, NULL}
+};
+
+struct CompiledBinaryOperator
+{
+  const wchar_t* mName;
+  double (*mFunction)(double, double);
+};
+
+static const CompiledBinaryOperator sCompiledBinaryOperators[] =
+{
+  {L"eq", compiledEq},
+  {L"geq", compiledGeq},
+  {L"gt", compiledGt},
+  {L"leq", compiledLeq},
+  {L"lt", compiledLt},
+  {L"neq", compiledNeq},
+  {L"power", compiledPower},
+  {L"xor", compiledXor},
+  {NULL, NULL}
+};
+
+// Finds the first argument of a qualifier (such as logbase) of an apply, if it
+// has one.
+static already_AddRefd<iface::mathml_dom::MathMLElement>
+findQualifierArgument(iface::mathml_dom::MathMLApplyElement* mae,
+                      const wchar_t* aQualifier)
+{
+  RETURN_INTO_OBJREF(nl, iface::dom::NodeList, mae->childNodes());
+  for (uint32_t i = 0, l = nl->length(); i < l; i++)
+  {
+    RETURN_INTO_OBJREF(n, iface::dom::Node, nl->item(i));
+    DECLARE_QUERY_INTERFACE_OBJREF(el, n, mathml_dom::MathMLContentContainer);
+    if (el == NULL)
+      continue;
+    RETURN_INTO_WSTRING(ln, el->localName());
+    if (ln == aQualifier)
+    {
+      if (el->nArguments() < 1)
+        throw iface::SRuS::SRuSException(L"Found a " + ln + L" with the wrong number of arguments.");
+      return el->getArgument(1);
+    }
+  }
+
+  return NULL;
+}
+
+SEDMLCompiledMath::SEDMLCompiledMath
+(
+ iface::mathml_dom::MathMLElement* aME,
+ const std::map<std::wstring, uint32_t>& aSlots,
+ const std::map<std::wstring, double>& aParameters
+)
+  : mSlots(aSlots), mParameters(aParameters)
+{
+  mResult = compile(aME);
+}
+
+void
+SEDMLCompiledMath::evalBlock(uint32_t aN, const double* const* aInputs,
+                             const uint32_t* aStrides, double* aOut)
+{
+  for (uint32_t offset = 0; offset < aN; offset += COMPILED_MATH_BLOCK_SIZE)
+  {
+    uint32_t n = std::min<uint32_t>(aN - offset, COMPILED_MATH_BLOCK_SIZE);
+    for (uint32_t i = 0, l = mProgram.size(); i < l; i++)
+      execute(i, n, aInputs, aStrides, offset);
+
+    const double* r = &mRegisters[mResult * COMPILED_MATH_BLOCK_SIZE];
+    std::copy(r, r + n, aOut + offset);
+  }
+}
+
+uint32_t
+SEDMLCompiledMath::compile(iface::mathml_dom::MathMLElement* aME)
+{
+  DECLARE_QUERY_INTERFACE_OBJREF(mae, aME, mathml_dom::MathMLApplyElement);
+  if (mae != NULL)
+    return compileApply(mae);
+
+  DECLARE_QUERY_INTERFACE_OBJREF(mcne, aME, mathml_dom::MathMLCnElement);
+  if (mcne != NULL)
+    return emitConstant(mConstantEvaluator.evalConstant(mcne));
+
+  DECLARE_QUERY_INTERFACE_OBJREF(mcie, aME, mathml_dom::MathMLCiElement);
+  if (mcie != NULL)
+    return compileVariable(mcie);
+
+  DECLARE_QUERY_INTERFACE_OBJREF(mpw, aME, mathml_dom::MathMLPiecewiseElement);
+  if (mpw != NULL)
+    return compilePiecewise(mpw);
+
+  DECLARE_QUERY_INTERFACE_OBJREF(mpds, aME, mathml_dom::MathMLPredefinedSymbol);
+  if (mpds != NULL)
+    return emitConstant(mConstantEvaluator.evalPredefined(mpds));
+
+  DECLARE_QUERY_INTERFACE_OBJREF(mme, aME, mathml_dom::MathMLMathElement);
+  if (mme != NULL)
+  {
+    if (mme->nArguments() != 1)
+      throw iface::SRuS::SRuSException(L"Found a MathML math element with the wrong number of children (i.e. not exactly one)");
+    RETURN_INTO_OBJREF(me, iface::mathml_dom::MathMLElement, mme->getArgument(1));
+    return compile(me);
+  }
+
+  throw iface::SRuS::SRuSException(L"Unhandled type of MathML element");
+}
+
+uint32_t
+SEDMLCompiledMath::compileApply(iface::mathml_dom::MathMLApplyElement* mae)
+{
+  RETURN_INTO_OBJREF(op, iface::mathml_dom::MathMLElement, mae->_cxx_operator());
+  DECLARE_QUERY_INTERFACE_OBJREF(cse, op, mathml_dom::MathMLCsymbolElement);
+  if (cse != NULL)
+    throw NeedsAggregate();
+
+  RETURN_INTO_WSTRING(opns, op->namespaceURI());
+  if (opns != L"http://www.w3.org/1998/Math/MathML")
+    throw iface::SRuS::SRuSException(L"Found a math operator not in the MathML namespace");
+
+  Instruction ins(OP_PLUS);
+  for (uint32_t i = 2, l = mae->nArguments(); i <= l; i++)
+  {
+    RETURN_INTO_OBJREF(arg, iface::mathml_dom::MathMLElement, mae->getArgument(i));
+    ins.mOperands.push_back(compile(arg));
+  }
+  size_t nargs = ins.mOperands.size();
+
+  RETURN_INTO_WSTRING(opln, op->localName());
+  if (opln == L"plus")
+    return emit(ins);
+  else if (opln == L"times")
+    ins.mOp = OP_TIMES;
+  else if (opln == L"and")
+    ins.mOp = OP_AND;
+  else if (opln == L"or")
+    ins.mOp = OP_OR;
+  else if (opln == L"minus")
+  {
+    if (nargs == 1)
+      ins.mOp = OP_NEGATE;
+    else if (nargs == 2)
+      ins.mOp = OP_SUBTRACT;
+    else
+      throw iface::SRuS::SRuSException(L"Found a minus with the wrong number of arguments.");
+  }
+  else if (opln == L"divide")
+  {
+    if (nargs != 2)
+      throw iface::SRuS::SRuSException(L"Found a divide with the wrong number of arguments.");
+    ins.mOp = OP_DIVIDE;
+  }
+  else if (opln == L"log" || opln == L"root")
+  {
+    if (nargs != 1)
+      throw iface::SRuS::SRuSException(L"Found a " + opln + L" with the wrong number of arguments.");
+    bool isLog = (opln == L"log");
+    RETURN_INTO_OBJREF(q, iface::mathml_dom::MathMLElement,
+                       findQualifierArgument(mae, isLog ? L"logbase" : L"degree"));
+    if (q != NULL)
+    {
+      ins.mOp = OP_BINARY;
+      ins.mBinary = isLog ? compiledLogBase : compiledRoot;
+      ins.mOperands.push_back(compile(q));
+    }
+    else
+    {
+      ins.mOp = OP_UNARY;
+      ins.mUnary = isLog ? compiledLog10 : compiledSqrt;
+    }
+  }
+  else
+  {
+    for (const CompiledUnaryOperator* u = sCompiledUnaryOperators;
+         u->mName != NULL; u++)
+      if (opln == u->mName)
+      {
+        if (nargs != 1)
+          throw iface::SRuS::SRuSException(L"Found a " + opln + L" with the wrong number of arguments.");
+        ins.mOp = OP_UNARY;
+        ins.mUnary = u->mFunction;
+        return emit(ins);
+      }
+
+    for (const CompiledBinaryOperator* b = sCompiledBinaryOperators;
+         b->mName != NULL; b++)
+      if (opln == b->mName)
+      {
+        if (nargs != 2)
+          throw iface::SRuS::SRuSException(L"Found a " + opln + L" with the wrong number of arguments.");
+        ins.mOp = OP_BINARY;
+        ins.mBinary = b->mFunction;
+        return emit(ins);
+      }
+
+    throw iface::SRuS::SRuSException(L"Unknown operator.");
+  }
+
+  return emit(ins);
+}
+
+uint32_t
+SEDMLCompiledMath::compileVariable(iface::mathml_dom::MathMLCiElement* mcie)
+{
+  std::wstring name(stringValueOf(mcie));
+
+  std::map<std::wstring, uint32_t>::iterator si = mSlots.find(name);
+  if (si != mSlots.end())
+  {
+    Instruction ins(OP_VARIABLE);
+    ins.mSlot = (*si).second;
+    return emit(ins);
+  }
+
+  std::map<std::wstring, double>::iterator pi = mParameters.find(name);
+  if (pi != mParameters.end())
+    return emitConstant((*pi).second);
+
+  throw iface::SRuS::SRuSException(L"Reference to variable that couldn't be found.");
+}
+
+uint32_t
+SEDMLCompiledMath::compilePiecewise(iface::mathml_dom::MathMLPiecewiseElement* mpe)
+{
+  std::vector<std::pair<uint32_t, uint32_t> > cases;
+  RETURN_INTO_OBJREF(mp, iface::mathml_dom::MathMLNodeList, mpe->pieces());
+  for (uint32_t i = 0, l = mp->length(); i < l; i++)
+  {
+    RETURN_INTO_OBJREF(dc, iface::dom::Node, mp->item(i));
+    DECLARE_QUERY_INTERFACE_OBJREF(mc, dc, mathml_dom::MathMLCaseElement);
+    if (mc == NULL)
+      continue;
+
+    RETURN_INTO_OBJREF(cc, iface::mathml_dom::MathMLContentElement, mc->caseCondition());
+    RETURN_INTO_OBJREF(cv, iface::mathml_dom::MathMLContentElement, mc->caseValue());
+    uint32_t condition = compile(cc);
+    cases.push_back(std::pair<uint32_t, uint32_t>(condition, compile(cv)));
+  }
+
+  RETURN_INTO_OBJREF(ow, iface::mathml_dom::MathMLContentElement, mpe->otherwise());
+  uint32_t result = (ow == NULL) ?
+    emitConstant(std::numeric_limits<double>::quiet_NaN()) : compile(ow);
+
+  // Work back from the otherwise, so the first case that holds wins, as in
+  // SEDMLMathEvaluator. (Before data generators were compiled, the first
+  // block of results was evaluated exploring everything, which took the last
+  // case that held.)
+  for (std::vector<std::pair<uint32_t, uint32_t> >::reverse_iterator i =
+         cases.rbegin(); i != cases.rend(); i++)
+  {
+    Instruction ins(OP_SELECT);
+    ins.mOperands.push_back((*i).first);
+    ins.mOperands.push_back((*i).second);
+    ins.mOperands.push_back(result);
+    result = emit(ins);
+  }
+
+  return result;
+}
+
+uint32_t
+SEDMLCompiledMath::emitConstant(double aValue)
+{
+  Instruction ins(OP_CONSTANT);
+  ins.mConstant = aValue;
+  return emit(ins);
+}
+
+uint32_t
+SEDMLCompiledMath::emit(const Instruction& aInstruction)
+{
+  uint32_t idx = mProgram.size();
+  mProgram.push_back(aInstruction);
+  mRegisters.resize(mProgram.size() * COMPILED_MATH_BLOCK_SIZE);
+
+  // Anything that only depends on constants (such as parameters) is worked
+  // out now, once, rather than at every point.
+  Instruction& ins = mProgram.back();
+  if (ins.mOp != OP_CONSTANT && ins.mOp != OP_VARIABLE)
+  {
+    bool allConstant = true;
+    for (std::vector<uint32_t>::iterator i = ins.mOperands.begin();
+         i != ins.mOperands.end(); i++)
+      if (mProgram[*i].mOp != OP_CONSTANT)
+      {
+        allConstant = false;
+        break;
+      }
+
+    if (allConstant)
+    {
+      execute(idx, 1, NULL, NULL, 0);
+      double v = mRegisters[idx * COMPILED_MATH_BLOCK_SIZE];
+      ins = Instruction(OP_CONSTANT);
+      ins.mConstant = v;
+    }
+  }
+
+  // Constant registers never change, so they are only filled in once.
+  if (ins.mOp == OP_CONSTANT)
+  {
+    double* r = &mRegisters[idx * COMPILED_MATH_BLOCK_SIZE];
+    std::fill(r, r + COMPILED_MATH_BLOCK_SIZE, ins.mConstant);
+  }
+
+  return idx;
+}
+
+void
+SEDMLCompiledMath::execute(uint32_t aInstruction, uint32_t aN,
+                           const double* const* aInputs,
+                           const uint32_t* aStrides, uint32_t aOffset)
+{
+  const Instruction& ins = mProgram[aInstruction];
+  double* r = &mRegisters[aInstruction * COMPILED_MATH_BLOCK_SIZE];
+  const double* a = ins.mOperands.empty() ? NULL :
+    &mRegisters[ins.mOperands[0] * COMPILED_MATH_BLOCK_SIZE];
+  const double* b = ins.mOperands.size() < 2 ? NULL :
+    &mRegisters[ins.mOperands[1] * COMPILED_MATH_BLOCK_SIZE];
+
+  switch (ins.mOp)
+  {
+  case OP_CONSTANT:
+    break;
+
+  case OP_VARIABLE:
+    {
+      uint32_t stride = aStrides[ins.mSlot];
+      const double* in = aInputs[ins.mSlot] + aOffset * stride;
+      for (uint32_t j = 0; j < aN; j++)
+        r[j] = in[j * stride];
+    }
+    break;
+
+  case OP_UNARY:
+    for (uint32_t j = 0; j < aN; j++)
+      r[j] = ins.mUnary(a[j]);
+    break;
+
+  case OP_BINARY:
+    for (uint32_t j = 0; j < aN; j++)
+      r[j] = ins.mBinary(a[j], b[j]);
+    break;
+
+  case OP_NEGATE:
+    for (uint32_t j = 0; j < aN; j++)
+      r[j] = -a[j];
+    break;
+
+  case OP_SUBTRACT:
+    for (uint32_t j = 0; j < aN; j++)
+      r[j] = a[j] - b[j];
+    break;
+
+  case OP_DIVIDE:
+    for (uint32_t j = 0; j < aN; j++)
+      r[j] = a[j] / b[j];
+    break;
+
+  case OP_PLUS:
+  case OP_TIMES:
+  case OP_AND:
+  case OP_OR:
+    std::fill(r, r + aN, (ins.mOp == OP_PLUS || ins.mOp == OP_OR) ? 0.0 : 1.0);
+    for (std::vector<uint32_t>::const_iterator i = ins.mOperands.begin();
+         i != ins.mOperands.end(); i++)
+    {
+      const double* x = &mRegisters[(*i) * COMPILED_MATH_BLOCK_SIZE];
+      if (ins.mOp == OP_PLUS)
+        for (uint32_t j = 0; j < aN; j++)
+          r[j] += x[j];
+      else if (ins.mOp == OP_TIMES)
+        for (uint32_t j = 0; j < aN; j++)
+          r[j] *= x[j];
+      else if (ins.mOp == OP_AND)
+        for (uint32_t j = 0; j < aN; j++)
+          r[j] = (x[j] != 0.0) ? r[j] : 0.0;
+      else
+        for (uint32_t j = 0; j < aN; j++)
+          r[j] = (x[j] != 0.0) ? 1.0 : r[j];
+    }
+    break;
+
+  case OP_SELECT:
+    {
+      const double* c = &mRegisters[ins.mOperands[2] * COMPILED_MATH_BLOCK_SIZE];
+      for (uint32_t j = 0; j < aN; j++)
+        r[j] = (a[j] != 0.0) ? b[j] : c[j];
+    }
+    break;
+  }
+}
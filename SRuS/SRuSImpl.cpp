@@ -1,6 +1,9 @@
 #define MODULE_CONTAINS_SRuS
 
 #include "SRuSImpl.hxx"
+#ifndef WIN32
+#include <unistd.h>
+#endif
 
 // Find the CellMLElement corresponding to a given DOM node.
 static already_AddRefd<iface::cellml_api::CellMLElement>
@@ -87,6 +90,20 @@ CDA_SRuSProcessor::supportsModellingLanguage(const std::wstring& aLang)
   return false;
 }
 
+uint32_t
+CDA_SRuSProcessor::maximumConcurrentIterations()
+  throw()
+{
+  return mMaximumConcurrentIterations;
+}
+
+void
+CDA_SRuSProcessor::maximumConcurrentIterations(uint32_t aMax)
+  throw()
+{
+  mMaximumConcurrentIterations = aMax;
+}
+
 CDA_SRuSTransformedModel::CDA_SRuSTransformedModel(iface::dom::Document* aDoc, iface::SProS::Model* aModel)
   : mDocument(aDoc), mSEDMLModel(aModel) {}
 
@@ -452,8 +469,10 @@ CDA_SRuSSimulationState::resetToInitial()
   for (std::map<std::wstring, CDA_SRuSModelSimulationState>::iterator it
          = mPerModelState.begin(); it != mPerModelState.end(); it++)
   {
+    it->second.mCurrentBvar = it->second.mInitialBvar;
     it->second.mCurrentData = it->second.mInitialData;
     it->second.mOverrideConstants.clear();
+    it->second.mOverrideData.clear();
   }
 }
 
@@ -461,6 +480,76 @@ CDA_SRuSSimulationStep::CDA_SRuSSimulationStep
 (CDA_SRuSSimulationState* aState, CDA_SRuSSimulationStep* aSuccessor)
   : mState(aState), mSuccessor(aSuccessor) {}
 
+/*
+ * Compiles a data generator's math, with its variables in slots in the order
+ * they appear in aVarInfo, and its parameters as constants. Throws
+ * NeedsAggregate if the math uses an aggregate.
+ */
+static SEDMLCompiledMath*
+CompileDataGenerator(iface::SProS::DataGenerator* aDG,
+                     const std::list<std::pair<std::wstring, int32_t> >& aVarInfo)
+{
+  std::map<std::wstring, uint32_t> slots;
+  uint32_t slot = 0;
+  for (std::list<std::pair<std::wstring, int32_t> >::const_iterator li = aVarInfo.begin();
+       li != aVarInfo.end(); li++)
+    slots[(*li).first] = slot++;
+
+  std::map<std::wstring, double> parameters;
+  RETURN_INTO_OBJREF(ps, iface::SProS::ParameterSet, aDG->parameters());
+  RETURN_INTO_OBJREF(pi, iface::SProS::ParameterIterator, ps->iterateParameters());
+  while (true)
+  {
+    RETURN_INTO_OBJREF(p, iface::SProS::Parameter, pi->nextParameter());
+    if (p == NULL)
+      break;
+
+    RETURN_INTO_WSTRING(pid, p->id());
+    parameters[pid] = p->value();
+  }
+
+  RETURN_INTO_OBJREF(m, iface::mathml_dom::MathMLMathElement, aDG->math());
+  return new SEDMLCompiledMath(m, slots, parameters);
+}
+
+/*
+ * Appends the value of a compiled data generator at each of the aN records (of
+ * aRecSize values each) in aState to aAppendTo.
+ */
+static void
+EvalDataGeneratorBlock(SEDMLCompiledMath* aMath,
+                       const std::list<std::pair<std::wstring, int32_t> >& aVarInfo,
+                       const std::vector<double>& aState, uint32_t aN,
+                       uint32_t aRecSize, const std::vector<double>& aConstants,
+                       std::vector<double>& aAppendTo)
+{
+  if (aN == 0)
+    return;
+
+  std::vector<const double*> inputs;
+  std::vector<uint32_t> strides;
+  for (std::list<std::pair<std::wstring, int32_t> >::const_iterator li = aVarInfo.begin();
+       li != aVarInfo.end(); li++)
+  {
+    int32_t idx = (*li).second;
+    if (idx < 0)
+    {
+      inputs.push_back(&aConstants[-1 - idx]);
+      strides.push_back(0);
+    }
+    else
+    {
+      inputs.push_back(&aState[idx]);
+      strides.push_back(aRecSize);
+    }
+  }
+
+  size_t start = aAppendTo.size();
+  aAppendTo.resize(start + aN);
+  aMath->evalBlock(aN, inputs.empty() ? NULL : &inputs[0],
+                   strides.empty() ? NULL : &strides[0], &aAppendTo[start]);
+}
+
 CDA_SRuSRawResultProcessor::CDA_SRuSRawResultProcessor
 (
  iface::SRuS::GeneratedDataMonitor* aMonitor,
@@ -472,7 +561,9 @@ CDA_SRuSRawResultProcessor::CDA_SRuSRawResultProcessor
     mAggregateMode(0), mVarInfoByDataGeneratorId(aVarInfoByDataGeneratorId),
     mDataGeneratorsById(aDataGeneratorsById),
     mDataGeneratorsByIdRAII(mDataGeneratorsById,
-                            new container_destructor<std::map<std::wstring, iface::SProS::DataGenerator*> >(new pair_both_destructor<const std::wstring, iface::SProS::DataGenerator*>(new void_destructor<const std::wstring>, new objref_destructor<iface::SProS::DataGenerator>()))), mTotalN(0)
+                            new container_destructor<std::map<std::wstring, iface::SProS::DataGenerator*> >(new pair_both_destructor<const std::wstring, iface::SProS::DataGenerator*>(new void_destructor<const std::wstring>, new objref_destructor<iface::SProS::DataGenerator>()))),
+    mCompiledMathRAII(mCompiledMath,
+                      new container_destructor<std::map<std::wstring, SEDMLCompiledMath*> >(new pair_both_destructor<const std::wstring, SEDMLCompiledMath*>(new void_destructor<const std::wstring>, new cxxptr_destructor<SEDMLCompiledMath>()))), mTotalN(0)
 {
   for (std::map<std::wstring, iface::SProS::DataGenerator*>::iterator i =
          mDataGeneratorsById.begin(); i != mDataGeneratorsById.end(); i++)
@@ -563,6 +654,26 @@ CDA_SRuSRawResultProcessor::results(const std::vector<double>& state)
 {
   uint32_t n = state.size() / mRecSize;
   mTotalN += n;
+
+  if (mAggregateMode == 0)
+  {
+    try
+    {
+      for (std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator i =
+             mVarInfoByDataGeneratorId.begin(); i != mVarInfoByDataGeneratorId.end(); i++)
+      {
+        SEDMLCompiledMath*& cm = mCompiledMath[(*i).first];
+        if (cm == NULL)
+          cm = CompileDataGenerator(mDataGeneratorsById[(*i).first], (*i).second);
+      }
+      mAggregateMode = -1;
+    }
+    catch (NeedsAggregate&)
+    {
+      mAggregateMode = 1;
+    }
+  }
+
   if (mAggregateMode == 1)
   {
     for (std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator i =
@@ -578,72 +689,39 @@ CDA_SRuSRawResultProcessor::results(const std::vector<double>& state)
     return;
   }
 
-  SEDMLMathEvaluator sme;
-  if (mAggregateMode == 0)
-    sme.setExploreEverything(true);
-  
   RETURN_INTO_OBJREF(gds, CDA_SRuSGeneratedDataSet, new CDA_SRuSGeneratedDataSet());
-  
+
   for (std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator i =
          mVarInfoByDataGeneratorId.begin(); i != mVarInfoByDataGeneratorId.end(); i++)
   {
     iface::SProS::DataGenerator* dg = mDataGeneratorsById[(*i).first];
-    // Set parameters too...
-    RETURN_INTO_OBJREF(ps, iface::SProS::ParameterSet, dg->parameters());
-    RETURN_INTO_OBJREF(pi, iface::SProS::ParameterIterator, ps->iterateParameters());
-    while (true)
-    {
-      RETURN_INTO_OBJREF(p, iface::SProS::Parameter, pi->nextParameter());
-      if (p == NULL)
-        break;
-      
-      RETURN_INTO_WSTRING(pid, p->id());
-      sme.setVariable(pid, p->value());
-    }
-    
     RETURN_INTO_OBJREF(gd, CDA_SRuSGeneratedData, new CDA_SRuSGeneratedData(dg));
-    
-    for (uint32_t j = 0; j < n; j++)
-    {
-      for (std::list<std::pair<std::wstring, int32_t> >::iterator li = (*i).second.begin();
-           li != (*i).second.end(); li++)
-        sme.setVariable((*li).first, (*li).second < 0 ?
-                        mConstants[-1 - (*li).second] :
-                        state[j * mRecSize + (*li).second]);
-      
-      try
-      {
-        RETURN_INTO_OBJREF(m, iface::mathml_dom::MathMLMathElement, dg->math());
-        double v = sme.eval(m);
-        gd->mData.push_back(v);
-      }
-      catch (NeedsAggregate&)
-      {
-        mAggregateMode = 1;
-        results(state);
-        return;
-      }
-    }
-    
+    EvalDataGeneratorBlock(mCompiledMath[(*i).first], (*i).second, state, n,
+                           mRecSize, mConstants, gd->mData);
     gd->add_ref();
     gds->mData.push_back(gd);
   }
-  
+
   mMonitor->progress(gds);
 }
 
 already_AddRefd<CDA_SRuSSimulationStep>
-CDA_SRuSSimulationStep::cloneChangingLastSuccessor(CDA_SRuSSimulationStep* aNewEnd)
+CDA_SRuSSimulationStep::cloneChangingLastSuccessor(CDA_SRuSSimulationStep* aNewEnd,
+                                                   CDA_SRuSSimulationState* aNewState)
 {
   CDA_SRuSSimulationStep* cur = this;
   ObjRef<CDA_SRuSSimulationStep> firstNewStep(cur->shallowClone());
   CDA_SRuSSimulationStep* newStep = firstNewStep;
+  if (aNewState != NULL)
+    newStep->mState = aNewState;
 
   while (newStep->mSuccessor)
   {
     cur = cur->mSuccessor;
     newStep->mSuccessor = cur->shallowClone();
     newStep = newStep->mSuccessor;
+    if (aNewState != NULL)
+      newStep->mState = aNewState;
   }
   newStep->mSuccessor = aNewEnd;
 
@@ -930,6 +1008,391 @@ static int countPointsInRange(iface::SProS::Range* aRange)
   return -1;
 }
 
+// The most iterations of a loop to run at once: aLimit if it is set, otherwise
+// one per processor.
+static int
+CountParallelIterations(uint32_t aLimit)
+{
+  if (aLimit != 0)
+    return aLimit;
+#ifdef WIN32
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  long nprocs = si.dwNumberOfProcessors;
+#else
+  long nprocs = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+  return nprocs > 0 ? nprocs : 1;
+}
+
+class CDA_SRuSLoopIterations;
+
+/*
+ * Keeps everything one iteration of a loop sends to its results while it runs
+ * alongside other iterations, so it can be passed on in iteration order.
+ */
+class CDA_SRuSIterationResults
+  : public CDA_SRuSResultReceiver
+{
+public:
+  CDA_IMPL_REFCOUNT;
+  CDA_IMPL_ID;
+  CDA_IMPL_QI1(cellml_services::IntegrationProgressObserver);
+
+  CDA_SRuSIterationResults(CDA_SRuSLoopIterations* aIterations, int aIndex)
+    : mIterations(aIterations), mIndex(aIndex)
+  {
+  }
+
+  void setActiveCodeInformation(iface::cellml_services::CodeInformation* aCodeInfo)
+    throw()
+  {
+    Event e(SET_CODE_INFORMATION);
+    e.mCodeInfo = aCodeInfo;
+    mEvents.push_back(e);
+  }
+
+  void computedConstants(const std::vector<double>& aValues)
+    throw()
+  {
+    Event e(COMPUTED_CONSTANTS);
+    e.mValues = aValues;
+    mEvents.push_back(e);
+  }
+
+  void results(const std::vector<double>& aValues)
+    throw(std::exception&)
+  {
+    Event e(RESULTS);
+    e.mValues = aValues;
+    mEvents.push_back(e);
+  }
+
+  void done()
+    throw(std::exception&)
+  {
+    mEvents.push_back(Event(DONE));
+  }
+
+  void failed(const std::string& aErrorMessage)
+    throw(std::exception&);
+
+  /*
+   * Passes everything received on to aTo, in the order it arrived. Returns
+   * false if the iteration failed.
+   */
+  bool replay(CDA_SRuSResultReceiver* aTo);
+
+private:
+  enum EventType
+  {
+    SET_CODE_INFORMATION,
+    COMPUTED_CONSTANTS,
+    RESULTS,
+    DONE,
+    FAILED
+  };
+
+  struct Event
+  {
+    Event(EventType aType) : mType(aType) {}
+
+    EventType mType;
+    ObjRef<iface::cellml_services::CodeInformation> mCodeInfo;
+    std::vector<double> mValues;
+    std::string mMessage;
+  };
+
+  // Not a reference; the steps of the iteration, which are the only callers
+  // of failed, keep the CDA_SRuSLoopIterations alive.
+  CDA_SRuSLoopIterations* mIterations;
+  int mIndex;
+  std::list<Event> mEvents;
+};
+
+/*
+ * Runs the iterations of a loop whose iterations are independent at the same
+ * time, each on its own copy of the loop's state, starting from the initial
+ * state. No more than CountParallelIterations() run at once; a new one starts
+ * as each finishes. Results are passed on to the loop's results in iteration
+ * order, and once all the iterations are done, the loop's successor is
+ * performed. Results are kept until they can be passed on, so iterations are
+ * only started a bounded distance ahead of the first unreported one.
+ */
+class CDA_SRuSLoopIterations
+  : public iface::XPCOM::IObject
+{
+public:
+  CDA_IMPL_REFCOUNT;
+  CDA_IMPL_ID;
+  CDA_IMPL_QI0;
+
+  CDA_SRuSLoopIterations(CDA_SRuSSimulationStepLoop* aLoop)
+    : mLoop(aLoop), mResults(aLoop->mNumPoints),
+      mFinished(aLoop->mNumPoints, false), mMaxRunning(1), mRunning(0),
+      mNextToStart(0), mNextToReport(0), mReporting(false), mFailed(false)
+  {
+  }
+
+  void start();
+
+  /*
+   * Called when an iteration has finished or failed, on whichever thread that
+   * happened on.
+   */
+  void iterationFinished(int aIndex);
+
+private:
+  already_AddRefd<CDA_SRuSSimulationStep> prepareIteration(int aIndex);
+
+  /*
+   * Prepares every iteration that may start now, adding them to aToStart.
+   * Call with mMutex held, and perform them once it is released.
+   */
+  void takeStartable(std::list<CDA_SRuSSimulationStep*>& aToStart);
+
+  /*
+   * Passes on the results of finished iterations, in order, until it gets to
+   * one that hasn't finished. Only one thread does this at a time.
+   */
+  void reportFinished();
+
+  CDAMutex mMutex;
+  ObjRef<CDA_SRuSSimulationStepLoop> mLoop;
+  std::vector<ObjRef<CDA_SRuSIterationResults> > mResults;
+  std::vector<bool> mFinished;
+  ObjRef<CDA_SRuSSimulationState> mLastState;
+  int mMaxRunning, mRunning, mNextToStart, mNextToReport;
+  // Set while a thread is in reportFinished.
+  bool mReporting, mFailed;
+};
+
+/*
+ * The last step in the chain for one iteration run by CDA_SRuSLoopIterations.
+ */
+class CDA_SRuSSimulationStepFinishIteration
+  : public CDA_SRuSSimulationStep
+{
+public:
+  CDA_IMPL_REFCOUNT;
+  CDA_IMPL_ID;
+  CDA_IMPL_QI0;
+
+  CDA_SRuSSimulationStepFinishIteration(CDA_SRuSSimulationState* aState,
+                                        CDA_SRuSLoopIterations* aIterations,
+                                        int aIndex)
+    : CDA_SRuSSimulationStep(aState, NULL), mIterations(aIterations),
+      mIndex(aIndex)
+  {
+  }
+
+  void perform()
+  {
+    mIterations->iterationFinished(mIndex);
+  }
+
+  already_AddRefd<CDA_SRuSSimulationStep> shallowClone()
+  {
+    return new CDA_SRuSSimulationStepFinishIteration(mState, mIterations, mIndex);
+  }
+
+private:
+  ObjRef<CDA_SRuSLoopIterations> mIterations;
+  int mIndex;
+};
+
+void
+CDA_SRuSIterationResults::failed(const std::string& aErrorMessage)
+  throw(std::exception&)
+{
+  Event e(FAILED);
+  e.mMessage = aErrorMessage;
+  mEvents.push_back(e);
+
+  // Nothing more will come from this iteration.
+  mIterations->iterationFinished(mIndex);
+}
+
+bool
+CDA_SRuSIterationResults::replay(CDA_SRuSResultReceiver* aTo)
+{
+  for (std::list<Event>::iterator i = mEvents.begin(); i != mEvents.end(); i++)
+    switch ((*i).mType)
+    {
+    case SET_CODE_INFORMATION:
+      aTo->setActiveCodeInformation((*i).mCodeInfo);
+      break;
+    case COMPUTED_CONSTANTS:
+      aTo->computedConstants((*i).mValues);
+      break;
+    case RESULTS:
+      aTo->results((*i).mValues);
+      break;
+    case DONE:
+      aTo->done();
+      break;
+    case FAILED:
+      aTo->failed((*i).mMessage);
+      return false;
+    }
+
+  return true;
+}
+
+void
+CDA_SRuSLoopIterations::start()
+{
+  std::list<CDA_SRuSSimulationStep*> toStart;
+  scoped_destroy<std::list<CDA_SRuSSimulationStep*> > toStartRAII
+    (toStart, new container_destructor<std::list<CDA_SRuSSimulationStep*> >
+     (new objref_destructor<CDA_SRuSSimulationStep>()));
+  {
+    CDALock lock(mMutex);
+    mMaxRunning =
+      CountParallelIterations(mLoop->mState->mMaximumConcurrentIterations);
+    takeStartable(toStart);
+  }
+
+  // Started without the lock held, as a step that finishes straight away
+  // calls back into iterationFinished.
+  for (std::list<CDA_SRuSSimulationStep*>::iterator i = toStart.begin();
+       i != toStart.end(); i++)
+    (*i)->perform();
+}
+
+void
+CDA_SRuSLoopIterations::takeStartable
+(
+ std::list<CDA_SRuSSimulationStep*>& aToStart
+)
+{
+  // Every iteration started but not yet reported keeps all its results, so
+  // a slow iteration mustn't let the others run arbitrarily far ahead of it.
+  int maxAhead = 2 * mMaxRunning;
+  while (mNextToStart < mLoop->mNumPoints && mRunning < mMaxRunning &&
+         mNextToStart - mNextToReport < maxAhead)
+  {
+    aToStart.push_back(prepareIteration(mNextToStart++));
+    mRunning++;
+  }
+}
+
+void
+CDA_SRuSLoopIterations::iterationFinished(int aIndex)
+{
+  std::list<CDA_SRuSSimulationStep*> toStart;
+  scoped_destroy<std::list<CDA_SRuSSimulationStep*> > toStartRAII
+    (toStart, new container_destructor<std::list<CDA_SRuSSimulationStep*> >
+     (new objref_destructor<CDA_SRuSSimulationStep>()));
+  bool report = false;
+  {
+    CDALock lock(mMutex);
+    if (mFailed)
+      return;
+
+    mFinished[aIndex] = true;
+    mRunning--;
+    takeStartable(toStart);
+
+    // Whichever thread is already reporting will get to this iteration.
+    if (!mReporting)
+      mReporting = report = true;
+  }
+
+  for (std::list<CDA_SRuSSimulationStep*>::iterator i = toStart.begin();
+       i != toStart.end(); i++)
+    (*i)->perform();
+
+  if (report)
+    reportFinished();
+}
+
+void
+CDA_SRuSLoopIterations::reportFinished()
+{
+  while (true)
+  {
+    ObjRef<CDA_SRuSIterationResults> results;
+    std::list<CDA_SRuSSimulationStep*> toStart;
+    scoped_destroy<std::list<CDA_SRuSSimulationStep*> > toStartRAII
+      (toStart, new container_destructor<std::list<CDA_SRuSSimulationStep*> >
+       (new objref_destructor<CDA_SRuSSimulationStep>()));
+    {
+      CDALock lock(mMutex);
+      if (mNextToReport == mLoop->mNumPoints)
+      {
+        mReporting = false;
+        break;
+      }
+      if (!mFinished[mNextToReport])
+      {
+        // Its thread will see mReporting is clear when it finishes.
+        mReporting = false;
+        return;
+      }
+      results = mResults[mNextToReport];
+      mResults[mNextToReport] = NULL;
+      mNextToReport++;
+      // That may let iterations which were held back start.
+      takeStartable(toStart);
+    }
+
+    for (std::list<CDA_SRuSSimulationStep*>::iterator i = toStart.begin();
+         i != toStart.end(); i++)
+      (*i)->perform();
+
+    // Replayed without the lock held, so the receiver can take as long as it
+    // likes without holding up the iterations still running.
+    if (!results->replay(mLoop->mState->mResultsTo))
+    {
+      // As when the iterations run one at a time, nothing after a failure is
+      // reported.
+      CDALock lock(mMutex);
+      mFailed = true;
+      mReporting = false;
+      mResults.clear();
+      mLastState = NULL;
+      return;
+    }
+  }
+
+  // Every iteration is done, so carry on from where the last one left the
+  // model, as if they had run one after another.
+  mLoop->mState->mPerModelState = mLastState->mPerModelState;
+  mLastState = NULL;
+  mLoop->performNext();
+}
+
+already_AddRefd<CDA_SRuSSimulationStep>
+CDA_SRuSLoopIterations::prepareIteration(int aIndex)
+{
+  RETURN_INTO_OBJREF(state, CDA_SRuSSimulationState, new CDA_SRuSSimulationState());
+  state->mTMS = mLoop->mState->mTMS;
+  state->mMaximumConcurrentIterations = mLoop->mState->mMaximumConcurrentIterations;
+  state->mPerModelState = mLoop->mState->mPerModelState;
+  state->resetToInitial();
+
+  RETURN_INTO_OBJREF(results, CDA_SRuSIterationResults,
+                     new CDA_SRuSIterationResults(this, aIndex));
+  state->mResultsTo = results;
+  mResults[aIndex] = results;
+  if (aIndex == mLoop->mNumPoints - 1)
+    mLastState = state;
+
+  // A copy of the loop working on the new state works out the range values and
+  // applies the set values for this iteration...
+  RETURN_INTO_OBJREF(loop, CDA_SRuSSimulationStepLoop,
+                     new CDA_SRuSSimulationStepLoop(state, NULL, mLoop->mNumPoints,
+                                                    aIndex, mLoop->mRanges,
+                                                    mLoop->mSetValues,
+                                                    mLoop->mLoopChain, true));
+  loop->setUpIteration();
+
+  RETURN_INTO_OBJREF(finish, CDA_SRuSSimulationStepFinishIteration,
+                     new CDA_SRuSSimulationStepFinishIteration(state, this, aIndex));
+  return mLoop->mLoopChain->cloneChangingLastSuccessor(finish, state);
+}
+
 CDA_SRuSSimulationStepLoop::CDA_SRuSSimulationStepLoop
 (
  CDA_SRuSSimulationState* aState,
@@ -937,11 +1400,12 @@ CDA_SRuSSimulationStepLoop::CDA_SRuSSimulationStepLoop
  const std::wstring& aMasterRangeId,
  std::list<iface::SProS::Range*>& aRanges,
  iface::SProS::SetValueSet* aSetValues,
- CDA_SRuSSimulationStep* aLoopChain
+ CDA_SRuSSimulationStep* aLoopChain,
+ bool aResetModel
 )
   : 
   CDA_SRuSSimulationStep(aState, aSuccessor),
-  mCurrentIndex(0), mRanges(aRanges.begin(), aRanges.end()),
+  mCurrentIndex(0), mResetModel(aResetModel), mRanges(aRanges.begin(), aRanges.end()),
   mRangesRAII(mRanges, new container_destructor<std::list<iface::SProS::Range*> >
               (new objref_destructor<iface::SProS::Range>())),
   mSetValues(aSetValues), mLoopChain(aLoopChain)
@@ -1001,11 +1465,13 @@ CDA_SRuSSimulationStepLoop::CDA_SRuSSimulationStepLoop
  int aNumPoints, int aCurrentIndex,
  std::list<iface::SProS::Range*>& aRanges,
  iface::SProS::SetValueSet* aSetValues,
- CDA_SRuSSimulationStep* aLoopChain
+ CDA_SRuSSimulationStep* aLoopChain,
+ bool aResetModel
 )
  : CDA_SRuSSimulationStep(aState, aSuccessor),
    mNumPoints(aNumPoints),
-   mCurrentIndex(aCurrentIndex), mRanges(aRanges.begin(), aRanges.end()),
+   mCurrentIndex(aCurrentIndex), mResetModel(aResetModel),
+   mRanges(aRanges.begin(), aRanges.end()),
    mRangesRAII(mRanges, new container_destructor<std::list<iface::SProS::Range*> >
                (new objref_destructor<iface::SProS::Range>())),
    mSetValues(aSetValues), mLoopChain(aLoopChain)
@@ -1021,7 +1487,7 @@ already_AddRefd<CDA_SRuSSimulationStep>
 CDA_SRuSSimulationStepLoop::shallowClone()
 {
   return new CDA_SRuSSimulationStepLoop(mState, mSuccessor, mNumPoints, mCurrentIndex,
-                                        mRanges, mSetValues, mLoopChain);
+                                        mRanges, mSetValues, mLoopChain, mResetModel);
 }
 
 double
@@ -1062,66 +1528,21 @@ CDA_SRuSSimulationStepLoop::getRangeValueFor
 void
 CDA_SRuSSimulationStepLoop::perform()
 {
+  if (mCurrentIndex == 0 && iterationsAreIndependent())
+  {
+    RETURN_INTO_OBJREF(iterations, CDA_SRuSLoopIterations,
+                       new CDA_SRuSLoopIterations(this));
+    iterations->start();
+    return;
+  }
+
   if (mCurrentIndex == mNumPoints)
     performNext();
   else
   {
-    std::map<std::wstring, double> currentRangeValues;
-    for (std::list<iface::SProS::Range*>::iterator it = mRanges.begin();
-         it != mRanges.end();
-         it++)
-      currentRangeValues[(*it)->id()] = getRangeValueFor(*it, currentRangeValues);
-
-    ObjRef<iface::SProS::SetValueIterator> svi(mSetValues->iterateSetValues());
-    for (ObjRef<iface::SProS::SetValue> sv(svi->nextSetValue()); sv; sv = svi->nextSetValue())
-    {
-      SEDMLMathEvaluator eval;
-      std::wstring range(sv->rangeIdentifier());
-      if (range != L"")
-      {
-        std::map<std::wstring, double>::iterator it =
-          currentRangeValues.find(range);
-        if (it != currentRangeValues.end())
-          eval.setVariable(range, it->second);
-      }
-
-      // Now we set all variables that may be used on the evaluator...
-      ObjRef<iface::SProS::VariableSet> svvs(sv->variables());
-      ObjRef<iface::SProS::VariableIterator> svvi(svvs->iterateVariables());
-      for (ObjRef<iface::SProS::Variable> svv(svvi->nextVariable()); svv;
-           svv = svvi->nextVariable())
-        eval.setVariable(svv->id(), findVariable(svv));
-      
-      ObjRef<iface::mathml_dom::MathMLMathElement> mathel(sv->math());
-      double setToValue = eval.eval(mathel);
-
-      // Finally add the override:
-      iface::cellml_services::VariableEvaluationType type;
-      CDA_SRuSModelSimulationState* state;
-      int index = getIndexAndTypeAndModelForVariable(sv, type, &state);
-      switch (type)
-      {
-      case iface::cellml_services::VARIABLE_OF_INTEGRATION:
-        state->mCurrentBvar = setToValue;
-        break;
-      case iface::cellml_services::CONSTANT:
-        state->mOverrideConstants.insert(std::pair<int, double>(index, setToValue));
-        break;
-      case iface::cellml_services::STATE_VARIABLE:
-      case iface::cellml_services::PSEUDOSTATE_VARIABLE:
-        state->mOverrideData.insert(std::pair<int, double>(index + 1, setToValue));
-        break;
-      case iface::cellml_services::ALGEBRAIC:
-        state->mOverrideData.insert(std::pair<int, double>
-                                    (index + 1 + 
-                                     state->mCodeInfo->rateIndexCount() * 2,
-                                     setToValue)
-                                   );
-        break;
-      default:
-        throw iface::SRuS::SRuSException(L"Unkown type of computation target encountered.");
-      }
-    }
+    if (mResetModel)
+      mState->resetToInitial();
+    setUpIteration();
 
     // We now have all the range values.
     mCurrentIndex++;
@@ -1131,7 +1552,83 @@ CDA_SRuSSimulationStepLoop::perform()
     ObjRef<CDA_SRuSSimulationStep> realSuccessor
       (mLoopChain->cloneChangingLastSuccessor(mCurrentIndex == mNumPoints ?
                                               this->mSuccessor : this));
-    realSuccessor->performNext();
+    realSuccessor->perform();
+  }
+}
+
+bool
+CDA_SRuSSimulationStepLoop::iterationsAreIndependent()
+{
+  if (!mResetModel || mNumPoints < 2 ||
+      CountParallelIterations(mState->mMaximumConcurrentIterations) < 2)
+    return false;
+
+  // A nested loop keeps its own chain, which would still work on this loop's
+  // state, so loops containing one run an iteration at a time.
+  for (CDA_SRuSSimulationStep* step = mLoopChain; step != NULL;
+       step = step->mSuccessor)
+    if (dynamic_cast<CDA_SRuSSimulationStepLoop*>(step) != NULL)
+      return false;
+
+  return true;
+}
+
+void
+CDA_SRuSSimulationStepLoop::setUpIteration()
+{
+  std::map<std::wstring, double> currentRangeValues;
+  for (std::list<iface::SProS::Range*>::iterator it = mRanges.begin();
+       it != mRanges.end();
+       it++)
+    currentRangeValues[(*it)->id()] = getRangeValueFor(*it, currentRangeValues);
+
+  ObjRef<iface::SProS::SetValueIterator> svi(mSetValues->iterateSetValues());
+  for (ObjRef<iface::SProS::SetValue> sv(svi->nextSetValue()); sv; sv = svi->nextSetValue())
+  {
+    SEDMLMathEvaluator eval;
+    std::wstring range(sv->rangeIdentifier());
+    if (range != L"")
+    {
+      std::map<std::wstring, double>::iterator it =
+        currentRangeValues.find(range);
+      if (it != currentRangeValues.end())
+        eval.setVariable(range, it->second);
+    }
+
+    // Now we set all variables that may be used on the evaluator...
+    ObjRef<iface::SProS::VariableSet> svvs(sv->variables());
+    ObjRef<iface::SProS::VariableIterator> svvi(svvs->iterateVariables());
+    for (ObjRef<iface::SProS::Variable> svv(svvi->nextVariable()); svv;
+         svv = svvi->nextVariable())
+      eval.setVariable(svv->id(), findVariable(svv));
+    
+    ObjRef<iface::mathml_dom::MathMLMathElement> mathel(sv->math());
+    double setToValue = eval.eval(mathel);
+
+    // Finally add the override:
+    iface::cellml_services::VariableEvaluationType type;
+    CDA_SRuSModelSimulationState* state;
+    int index = getIndexAndTypeAndModelForVariable(sv, type, &state);
+    switch (type)
+    {
+    case iface::cellml_services::VARIABLE_OF_INTEGRATION:
+      state->mCurrentBvar = setToValue;
+      break;
+    // These replace the values the last step left behind.
+    case iface::cellml_services::CONSTANT:
+      state->mOverrideConstants[index] = setToValue;
+      break;
+    case iface::cellml_services::STATE_VARIABLE:
+    case iface::cellml_services::PSEUDOSTATE_VARIABLE:
+      state->mOverrideData[index + 1] = setToValue;
+      break;
+    case iface::cellml_services::ALGEBRAIC:
+      state->mOverrideData[index + 1 + state->mCodeInfo->rateIndexCount() * 2] =
+        setToValue;
+      break;
+    default:
+      throw iface::SRuS::SRuSException(L"Unkown type of computation target encountered.");
+    }
   }
 }
 
@@ -1481,7 +1978,9 @@ public:
       mAggregateMode(0), mVarInfoByDataGeneratorId(aVarInfoByDataGeneratorId),
       mDataGeneratorsById(aDataGeneratorsById),
       mDataGeneratorsByIdRAII(mDataGeneratorsById,
-                              new container_destructor<std::map<std::wstring, iface::SProS::DataGenerator*> >(new pair_both_destructor<const std::wstring, iface::SProS::DataGenerator*>(new void_destructor<const std::wstring>, new objref_destructor<iface::SProS::DataGenerator>()))), mTotalN(0)
+                              new container_destructor<std::map<std::wstring, iface::SProS::DataGenerator*> >(new pair_both_destructor<const std::wstring, iface::SProS::DataGenerator*>(new void_destructor<const std::wstring>, new objref_destructor<iface::SProS::DataGenerator>()))),
+      mCompiledMathRAII(mCompiledMath,
+                        new container_destructor<std::map<std::wstring, SEDMLCompiledMath*> >(new pair_both_destructor<const std::wstring, SEDMLCompiledMath*>(new void_destructor<const std::wstring>, new cxxptr_destructor<SEDMLCompiledMath>()))), mTotalN(0)
   {
     uint32_t aic = mCodeInfo->algebraicIndexCount();
     uint32_t ric = mCodeInfo->rateIndexCount();
@@ -1572,6 +2071,26 @@ public:
   {
     uint32_t n = state.size() / mRecSize;
     mTotalN += n;
+
+    if (mAggregateMode == 0)
+    {
+      try
+      {
+        for (std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator i =
+               mVarInfoByDataGeneratorId.begin(); i != mVarInfoByDataGeneratorId.end(); i++)
+        {
+          SEDMLCompiledMath*& cm = mCompiledMath[(*i).first];
+          if (cm == NULL)
+            cm = CompileDataGenerator(mDataGeneratorsById[(*i).first], (*i).second);
+        }
+        mAggregateMode = -1;
+      }
+      catch (NeedsAggregate&)
+      {
+        mAggregateMode = 1;
+      }
+    }
+
     if (mAggregateMode == 1)
     {
       for (std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator i =
@@ -1587,53 +2106,15 @@ public:
       return;
     }
 
-    SEDMLMathEvaluator sme;
-    if (mAggregateMode == 0)
-      sme.setExploreEverything(true);
-
     RETURN_INTO_OBJREF(gds, CDA_SRuSGeneratedDataSet, new CDA_SRuSGeneratedDataSet());
 
     for (std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator i =
            mVarInfoByDataGeneratorId.begin(); i != mVarInfoByDataGeneratorId.end(); i++)
     {
       iface::SProS::DataGenerator* dg = mDataGeneratorsById[(*i).first];
-      // Set parameters too...
-      RETURN_INTO_OBJREF(ps, iface::SProS::ParameterSet, dg->parameters());
-      RETURN_INTO_OBJREF(pi, iface::SProS::ParameterIterator, ps->iterateParameters());
-      while (true)
-      {
-        RETURN_INTO_OBJREF(p, iface::SProS::Parameter, pi->nextParameter());
-        if (p == NULL)
-          break;
-        
-          RETURN_INTO_WSTRING(pid, p->id());
-          sme.setVariable(pid, p->value());
-      }
-
       RETURN_INTO_OBJREF(gd, CDA_SRuSGeneratedData, new CDA_SRuSGeneratedData(dg));
-
-      for (uint32_t j = 0; j < n; j++)
-      {
-        for (std::list<std::pair<std::wstring, int32_t> >::iterator li = (*i).second.begin();
-             li != (*i).second.end(); li++)
-          sme.setVariable((*li).first, (*li).second < 0 ?
-                           mConstants[-1 - (*li).second] :
-                           state[j * mRecSize + (*li).second]);
-        
-        try
-        {
-          RETURN_INTO_OBJREF(m, iface::mathml_dom::MathMLMathElement, dg->math());
-          double v = sme.eval(m);
-          gd->mData.push_back(v);
-        }
-        catch (NeedsAggregate&)
-        {
-          mAggregateMode = 1;
-          results(state);
-          return;
-        }
-      }
-
+      EvalDataGeneratorBlock(mCompiledMath[(*i).first], (*i).second, state, n,
+                             mRecSize, mConstants, gd->mData);
       gd->add_ref();
       gds->mData.push_back(gd);
     }
@@ -1653,6 +2134,8 @@ private:
   std::map<std::wstring, std::map<std::wstring, std::vector<double> > > mAggregateData;
   std::map<std::wstring, iface::SProS::DataGenerator*> mDataGeneratorsById;
   scoped_destroy<std::map<std::wstring, iface::SProS::DataGenerator*> > mDataGeneratorsByIdRAII;
+  std::map<std::wstring, SEDMLCompiledMath*> mCompiledMath;
+  scoped_destroy<std::map<std::wstring, SEDMLCompiledMath*> > mCompiledMathRAII;
   uint32_t mRecSize, mTotalN;
 };
 
@@ -1860,8 +2343,112 @@ CDA_SRuSProcessor::generateData
     {
       ObjRef<iface::SProS::RepeatedTask> rt(QueryInterface(at));
       if (rt != NULL)
-        doRepeatedTask(modelsById, dataGeneratorIdsByTaskId, dataGeneratorsById, is,
-                       rt, aMonitor);
+        doRepeatedTask(aSet, modelsById, dataGeneratorIdsByTaskId, dataGeneratorsById,
+                       is, rt, aMonitor);
+    }
+  }
+}
+
+/*
+ * Finds where the variables of the data generators for taskId are in the
+ * results of the model m (with code information ci), and adds them to
+ * variableInfoIdxByDataGeneratorId by data generator.
+ */
+static void
+FindDataGeneratorVariables
+(
+ const std::wstring& taskId,
+ std::multimap<std::wstring, std::wstring>& dataGeneratorIdsByTaskId,
+ std::map<std::wstring, iface::SProS::DataGenerator*>& dataGeneratorsById,
+ iface::dom::Document* doc,
+ iface::cellml_api::Model* m,
+ iface::cellml_services::CodeInformation* ci,
+ std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >&
+   variableInfoIdxByDataGeneratorId
+)
+{
+  // For each DataGenerator...
+  for (std::multimap<std::wstring, std::wstring>::iterator dgi = dataGeneratorIdsByTaskId.find(taskId);
+       dgi != dataGeneratorIdsByTaskId.end() && (*dgi).first == taskId; dgi++)
+  {
+    std::wstring dgid = (*dgi).second;
+    iface::SProS::DataGenerator* dg = dataGeneratorsById[dgid];
+    RETURN_INTO_OBJREF(vs, iface::SProS::VariableSet, dg->variables());
+    RETURN_INTO_OBJREF(vi, iface::SProS::VariableIterator, vs->iterateVariables());
+    while (true)
+    {
+      RETURN_INTO_OBJREF(sv, iface::SProS::Variable, vi->nextVariable());
+      if (sv == NULL)
+        break;
+
+      RETURN_INTO_OBJREF(xe, iface::xpath::XPathEvaluator, CreateXPathEvaluator());
+      RETURN_INTO_OBJREF(de, iface::dom::Element, sv->domElement());
+      RETURN_INTO_OBJREF(resolver, iface::xpath::XPathNSResolver,
+                         xe->createNSResolver(de));
+      RETURN_INTO_WSTRING(expr, sv->target());
+      RETURN_INTO_OBJREF(xr, iface::xpath::XPathResult,
+                         xe->evaluate(expr, doc, resolver,
+                                      iface::xpath::XPathResult::FIRST_ORDERED_NODE_TYPE,
+                                      NULL));
+      RETURN_INTO_OBJREF(n, iface::dom::Node, xr->singleNodeValue());
+      if (n == NULL)
+        continue;
+
+      RETURN_INTO_OBJREF(el, iface::cellml_api::CellMLElement, xmlToCellML(m, n));
+      DECLARE_QUERY_INTERFACE_OBJREF(cv, el, cellml_api::CellMLVariable);
+      if (cv == NULL)
+        continue;
+
+      RETURN_INTO_OBJREF(cti, iface::cellml_services::ComputationTargetIterator, ci->iterateTargets());
+      while (true)
+      {
+        RETURN_INTO_OBJREF(ct, iface::cellml_services::ComputationTarget, cti->nextComputationTarget());
+        if (ct == NULL)
+          break;
+        if (ct->degree() != 0)
+          continue;
+        
+        RETURN_INTO_OBJREF(ctv, iface::cellml_api::CellMLVariable, ct->variable());
+        if (!CDA_objcmp(ctv, cv))
+        {
+          int32_t idx = ct->assignedIndex();
+          iface::cellml_services::VariableEvaluationType t(ct->type());
+          switch (t)
+          {
+          case iface::cellml_services::VARIABLE_OF_INTEGRATION:
+            idx = 0;
+            break;
+          case iface::cellml_services::CONSTANT:
+            idx = -1 - idx;
+            break;
+          case iface::cellml_services::STATE_VARIABLE:
+          case iface::cellml_services::PSEUDOSTATE_VARIABLE:
+            idx++;
+            break;
+          case iface::cellml_services::ALGEBRAIC:
+            idx += 1 + ci->rateIndexCount() * 2;
+            break;
+          default:
+            throw iface::SRuS::SRuSException(L"Found an unsupported type of computation target.");
+          }
+          RETURN_INTO_WSTRING(svid, sv->id());
+          
+          std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator
+            vi(variableInfoIdxByDataGeneratorId.find(dgid));
+          if (vi == variableInfoIdxByDataGeneratorId.end())
+          {
+            std::list<std::pair<std::wstring, int32_t> > l;
+            l.push_back(std::pair<std::wstring, int32_t>(svid, idx));
+            variableInfoIdxByDataGeneratorId.insert(
+              std::pair<std::wstring, std::list<std::pair<std::wstring, int32_t> > >
+              (dgid, l)
+                                                   );
+          }
+          else
+            (*vi).second.push_back(std::pair<std::wstring, uint32_t>(svid, idx));
+          break;
+        }
+      }
     }
   }
 }
@@ -1921,91 +2508,8 @@ CDA_SRuSProcessor::doBasicTask
     }
 
     std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > > variableInfoIdxByDataGeneratorId;
-    // For each DataGenerator...
-    for (std::multimap<std::wstring, std::wstring>::iterator dgi = dataGeneratorIdsByTaskId.find(taskId);
-         dgi != dataGeneratorIdsByTaskId.end() && (*dgi).first == taskId; dgi++)
-    {
-      std::wstring dgid = (*dgi).second;
-      iface::SProS::DataGenerator* dg = dataGeneratorsById[dgid];
-      RETURN_INTO_OBJREF(vs, iface::SProS::VariableSet, dg->variables());
-      RETURN_INTO_OBJREF(vi, iface::SProS::VariableIterator, vs->iterateVariables());
-      while (true)
-      {
-        RETURN_INTO_OBJREF(sv, iface::SProS::Variable, vi->nextVariable());
-        if (sv == NULL)
-          break;
-
-        RETURN_INTO_OBJREF(xe, iface::xpath::XPathEvaluator, CreateXPathEvaluator());
-        RETURN_INTO_OBJREF(de, iface::dom::Element, sv->domElement());
-        RETURN_INTO_OBJREF(resolver, iface::xpath::XPathNSResolver,
-                           xe->createNSResolver(de));
-        RETURN_INTO_WSTRING(expr, sv->target());
-        RETURN_INTO_OBJREF(xr, iface::xpath::XPathResult,
-                           xe->evaluate(expr, doc, resolver,
-                                        iface::xpath::XPathResult::FIRST_ORDERED_NODE_TYPE,
-                                        NULL));
-        RETURN_INTO_OBJREF(n, iface::dom::Node, xr->singleNodeValue());
-        if (n == NULL)
-          continue;
-
-        RETURN_INTO_OBJREF(el, iface::cellml_api::CellMLElement, xmlToCellML(m, n));
-        DECLARE_QUERY_INTERFACE_OBJREF(cv, el, cellml_api::CellMLVariable);
-        if (cv == NULL)
-          continue;
-
-        RETURN_INTO_OBJREF(cti, iface::cellml_services::ComputationTargetIterator, ci->iterateTargets());
-        while (true)
-        {
-          RETURN_INTO_OBJREF(ct, iface::cellml_services::ComputationTarget, cti->nextComputationTarget());
-          if (ct == NULL)
-            break;
-          if (ct->degree() != 0)
-            continue;
-          
-          RETURN_INTO_OBJREF(ctv, iface::cellml_api::CellMLVariable, ct->variable());
-          if (!CDA_objcmp(ctv, cv))
-          {
-            int32_t idx = ct->assignedIndex();
-            iface::cellml_services::VariableEvaluationType t(ct->type());
-            switch (t)
-            {
-            case iface::cellml_services::VARIABLE_OF_INTEGRATION:
-              idx = 0;
-              break;
-            case iface::cellml_services::CONSTANT:
-              idx = -1 - idx;
-              break;
-            case iface::cellml_services::STATE_VARIABLE:
-            case iface::cellml_services::PSEUDOSTATE_VARIABLE:
-              idx++;
-              break;
-            case iface::cellml_services::ALGEBRAIC:
-              idx += 1 + ci->rateIndexCount() * 2;
-              break;
-            default:
-              throw iface::SRuS::SRuSException(L"Found an unsupported type of computation target.");
-            }
-            RETURN_INTO_WSTRING(svid, sv->id());
-            
-            std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > >::iterator
-              vi(variableInfoIdxByDataGeneratorId.find(dgid));
-            if (vi == variableInfoIdxByDataGeneratorId.end())
-            {
-              std::list<std::pair<std::wstring, int32_t> > l;
-              l.push_back(std::pair<std::wstring, int32_t>(svid, idx));
-              variableInfoIdxByDataGeneratorId.insert(
-                std::pair<std::wstring, std::list<std::pair<std::wstring, int32_t> > >
-                (dgid, l)
-                                                     );
-            }
-            else
-              (*vi).second.push_back(std::pair<std::wstring, uint32_t>(svid, idx));
-            break;
-          }
-        }
-      }
-    }
-
+    FindDataGeneratorVariables(taskId, dataGeneratorIdsByTaskId, dataGeneratorsById,
+                               doc, m, ci, variableInfoIdxByDataGeneratorId);
     double it = utc->initialTime(), ost = utc->outputStartTime(), oet = utc->outputEndTime();
 
     uint32_t nSamples = 1;
@@ -2078,6 +2582,7 @@ CDA_SRuSProcessor::doBasicTask
 void
 CDA_SRuSProcessor::doRepeatedTask
 (
+ iface::SRuS::TransformedModelSet* aSet,
  std::map<std::wstring, iface::SRuS::TransformedModel*>& modelsById,
  std::multimap<std::wstring, std::wstring>& dataGeneratorIdsByTaskId,
  std::map<std::wstring, iface::SProS::DataGenerator*>& dataGeneratorsById,
@@ -2142,7 +2647,110 @@ CDA_SRuSProcessor::doRepeatedTask
     throw iface::SRuS::SRuSException(L"Found a functionalRange with an index that isn't a valid range name.");
   }
   
-  // TODO Set up repeated task to run using new data structures.
+  RETURN_INTO_OBJREF(state, CDA_SRuSSimulationState, new CDA_SRuSSimulationState());
+  state->mTMS = aSet;
+  state->mMaximumConcurrentIterations = mMaximumConcurrentIterations;
+
+  // Each subtask becomes a step to bring the model to the output start time,
+  // followed by one that sends on the results, in the order of the subtasks.
+  std::multimap<int32_t, ObjRef<iface::SProS::Task> > subTasksByOrder;
+  ObjRef<iface::SProS::SubTaskSet> subTasks(t->subTasks());
+  ObjRef<iface::SProS::SubTaskIterator> subTaskIt(subTasks->iterateSubTasks());
+  for (ObjRef<iface::SProS::SubTask> st(subTaskIt->nextSubTask()); st;
+       st = subTaskIt->nextSubTask())
+  {
+    ObjRef<iface::SProS::AbstractTask> at(st->taskReference());
+    if (at == NULL)
+      throw iface::SRuS::SRuSException(L"Could not find task referenced by subtask.");
+    ObjRef<iface::SProS::Task> subTask(QueryInterface(at));
+    // To do: repeated tasks inside repeated tasks.
+    if (subTask == NULL)
+      throw iface::SRuS::SRuSException(L"Found a subtask that is a repeated task, which is currently unsupported.");
+    subTasksByOrder.insert(std::pair<int32_t, ObjRef<iface::SProS::Task> >
+                           (st->order(), subTask));
+  }
+  if (subTasksByOrder.empty())
+    throw iface::SRuS::SRuSException(L"Repeated task has no subtasks.");
+
+  std::wstring modelId;
+  ObjRef<CDA_SRuSSimulationStep> chain;
+  for (std::multimap<int32_t, ObjRef<iface::SProS::Task> >::reverse_iterator
+         sti = subTasksByOrder.rbegin(); sti != subTasksByOrder.rend(); sti++)
+  {
+    iface::SProS::Task* subTask = (*sti).second;
+    RETURN_INTO_OBJREF(sm, iface::SProS::Model, subTask->modelReference());
+    if (sm == NULL)
+      throw iface::SRuS::SRuSException(L"Could not find model referenced by task.");
+    // To do: results from more than one model.
+    if (modelId != L"" && sm->id() != modelId)
+      throw iface::SRuS::SRuSException(L"Found a repeated task using more than one model, which is currently unsupported.");
+    modelId = sm->id();
+
+    RETURN_INTO_OBJREF(sim, iface::SProS::Simulation, subTask->simulationReference());
+    if (sim == NULL)
+      throw iface::SRuS::SRuSException(L"Could not find simulation referenced by task.");
+    DECLARE_QUERY_INTERFACE_OBJREF(utc, sim, SProS::UniformTimeCourse);
+    // To do: things other than uniform time course.
+    if (utc == NULL)
+      throw iface::SRuS::SRuSException(L"Found a simulation that isn't a UniformTimeCourse, which is currently unsupported.");
+
+    if (state->mPerModelState.find(modelId) == state->mPerModelState.end())
+    {
+      RETURN_INTO_OBJREF(mo, iface::XPCOM::IObject, modelsById[modelId]->modelDocument());
+      DECLARE_QUERY_INTERFACE_OBJREF(m, mo, cellml_api::Model);
+      if (m == NULL)
+        throw iface::SRuS::SRuSException(L"Found a model that wasn't a CellML model, which is currently unsupported.");
+
+      CDA_SRuSModelSimulationState& ms = state->mPerModelState[modelId];
+      ms.mODECompiledModel = already_AddRefd<iface::cellml_services::ODESolverCompiledModel>
+        (is->compileModelODE(m));
+      ms.mCodeInfo = already_AddRefd<iface::cellml_services::CodeInformation>
+        (ms.mODECompiledModel->codeInformation());
+      RETURN_INTO_WSTRING(ksid, sim->algorithmKisaoID());
+      if (ksid == L"KISAO:0000283" ||
+          ksid == L"https://computation.llnl.gov/casc/sundials/documentation/ida_guide/")
+      {
+        ms.mDAECompiledModel = already_AddRefd<iface::cellml_services::DAESolverCompiledModel>
+          (is->compileModelDAE(m));
+        ms.mCodeInfoDAE = already_AddRefd<iface::cellml_services::CodeInformation>
+          (ms.mDAECompiledModel->codeInformation());
+      }
+      // Variables read as zero until a run gives the model's own values, and
+      // every iteration that resets the model starts from the same state.
+      ms.mInitialBvar = ms.mCurrentBvar = utc->initialTime();
+      ms.mInitialData.resize(1 + ms.mCodeInfo->rateIndexCount() * 2 +
+                             ms.mCodeInfo->algebraicIndexCount(), 0.0);
+      ms.mCurrentData = ms.mInitialData;
+      ms.mCurrentConstants.resize(ms.mCodeInfo->constantIndexCount(), 0.0);
+    }
+
+    double ost = utc->outputStartTime(), oet = utc->outputEndTime();
+    chain = already_AddRefd<CDA_SRuSSimulationStep>
+      (new CDA_SRuSSimulationStepUniformTimeCourse
+       (sim, modelId, oet, (oet - ost) / utc->numberOfPoints(), false, state, chain));
+    chain = already_AddRefd<CDA_SRuSSimulationStep>
+      (new CDA_SRuSSimulationStepDropUntil(sim, modelId, ost, state, chain));
+  }
+
+  iface::SRuS::TransformedModel* tm = modelsById[modelId];
+  RETURN_INTO_OBJREF(mo, iface::XPCOM::IObject, tm->modelDocument());
+  DECLARE_QUERY_INTERFACE_OBJREF(m, mo, cellml_api::Model);
+  RETURN_INTO_OBJREF(doc, iface::dom::Document, tm->xmlDocument());
+  std::map<std::wstring, std::list<std::pair<std::wstring, int32_t> > > variableInfoIdxByDataGeneratorId;
+  FindDataGeneratorVariables(t->id(), dataGeneratorIdsByTaskId, dataGeneratorsById,
+                             doc, m, state->mPerModelState[modelId].mCodeInfo,
+                             variableInfoIdxByDataGeneratorId);
+  state->mResultsTo = already_AddRefd<CDA_SRuSResultReceiver>
+    (new CDA_SRuSRawResultProcessor(aMonitor, variableInfoIdxByDataGeneratorId,
+                                    dataGeneratorsById));
+
+  ObjRef<iface::SProS::SetValueSet> changes(t->changes());
+  RETURN_INTO_OBJREF(loop, CDA_SRuSSimulationStepLoop,
+                     new CDA_SRuSSimulationStepLoop(state, NULL, t->rangeIdentifier(),
+                                                    orderedRanges, changes, chain,
+                                                    t->resetModel()));
+  // The steps keep each other and the state alive while the integration runs.
+  loop->perform();
 }
 
 already_AddRefd<iface::SRuS::SEDMLProcessor>
@@ -21,7 +21,7 @@ class CDA_SRuSProcessor
 {
 public:
   CDA_SRuSProcessor()
-    : mRecursionDepth(0) {}
+    : mRecursionDepth(0), mMaximumConcurrentIterations(0) {}
 
   CDA_IMPL_ID;
   CDA_IMPL_QI1(SRuS::SEDMLProcessor);
@@ -35,9 +35,11 @@ public:
   void generateData(iface::SRuS::TransformedModelSet* aSet,
                     iface::SProS::SEDMLElement* aElement,
                     iface::SRuS::GeneratedDataMonitor* aMonitor) throw(std::exception&);
+  uint32_t maximumConcurrentIterations() throw();
+  void maximumConcurrentIterations(uint32_t aMax) throw();
 
 private:
-  uint32_t mRecursionDepth;
+  uint32_t mRecursionDepth, mMaximumConcurrentIterations;
 
   void doBasicTask(std::map<std::wstring, iface::SRuS::TransformedModel*>& modelsById,
                    std::multimap<std::wstring, std::wstring>& dataGeneratorIdsByTaskId,
@@ -45,7 +47,8 @@ private:
                    iface::cellml_services::CellMLIntegrationService* is,
                    iface::SProS::Task* t,
                    iface::SRuS::GeneratedDataMonitor* aMonitor);
-  void doRepeatedTask(std::map<std::wstring, iface::SRuS::TransformedModel*>& modelsById,
+  void doRepeatedTask(iface::SRuS::TransformedModelSet* aSet,
+                      std::map<std::wstring, iface::SRuS::TransformedModel*>& modelsById,
                       std::multimap<std::wstring, std::wstring>& dataGeneratorIdsByTaskId,
                       std::map<std::wstring, iface::SProS::DataGenerator*>& dataGeneratorsById,
                       iface::cellml_services::CellMLIntegrationService* is,
@@ -139,9 +142,21 @@ private:
  * at 'time' points that the SED-ML has requested, no intermediate steps),
  * and applies the data generators to that raw data to get the final results.
  */
-class CDA_SRuSRawResultProcessor
+class SEDMLCompiledMath;
+
+/*
+ * Receives the results of the steps of a simulation experiment.
+ */
+class CDA_SRuSResultReceiver
   : public iface::cellml_services::IntegrationProgressObserver
 {
+public:
+  virtual void setActiveCodeInformation(iface::cellml_services::CodeInformation* aCodeInfo) throw() = 0;
+};
+
+class CDA_SRuSRawResultProcessor
+  : public CDA_SRuSResultReceiver
+{
 public:
   CDA_IMPL_REFCOUNT;
   CDA_IMPL_ID;
@@ -174,6 +189,9 @@ private:
   std::map<std::wstring, std::map<std::wstring, std::vector<double> > > mAggregateData;
   std::map<std::wstring, iface::SProS::DataGenerator*> mDataGeneratorsById;
   scoped_destroy<std::map<std::wstring, iface::SProS::DataGenerator*> > mDataGeneratorsByIdRAII;
+  // Each data generator's math, compiled when the first results come in.
+  std::map<std::wstring, SEDMLCompiledMath*> mCompiledMath;
+  scoped_destroy<std::map<std::wstring, SEDMLCompiledMath*> > mCompiledMathRAII;
   uint32_t mRecSize, mTotalN;
 };
 
@@ -202,11 +220,16 @@ public:
   CDA_IMPL_REFCOUNT;
   CDA_IMPL_ID;
   CDA_IMPL_QI0;
+
+  CDA_SRuSSimulationState()
+    : mMaximumConcurrentIterations(0) {}
   
   void resetToInitial();
 
   ObjRef<iface::SRuS::TransformedModelSet> mTMS;
-  ObjRef<CDA_SRuSRawResultProcessor> mResultsTo;
+  ObjRef<CDA_SRuSResultReceiver> mResultsTo;
+  // The most loop iterations to run at once, or 0 for one per processor.
+  uint32_t mMaximumConcurrentIterations;
 
   std::map<std::wstring, CDA_SRuSModelSimulationState>
     mPerModelState;
@@ -239,9 +262,11 @@ public:
   /*
    * Makes another simulation step that is identical to this one except that a
    * deep clone is made of each part of the simulation and the argument is
-   * put in place of the last successor in the chain.
+   * put in place of the last successor in the chain. If aNewState is given,
+   * the clones use it instead of the state of the steps they were made from.
    */
-  already_AddRefd<CDA_SRuSSimulationStep> cloneChangingLastSuccessor(CDA_SRuSSimulationStep* aNewEnd);
+  already_AddRefd<CDA_SRuSSimulationStep> cloneChangingLastSuccessor(CDA_SRuSSimulationStep* aNewEnd,
+                                                                     CDA_SRuSSimulationState* aNewState = NULL);
 
   void performNext();
 
@@ -284,7 +309,8 @@ public:
                              const std::wstring& aMainRange,
                              std::list<iface::SProS::Range*>& aRanges,
                              iface::SProS::SetValueSet* aSetValues,
-                             CDA_SRuSSimulationStep* aLoopChain);
+                             CDA_SRuSSimulationStep* aLoopChain,
+                             bool aResetModel);
   ~CDA_SRuSSimulationStepLoop() {};
 
   void perform();
@@ -292,14 +318,30 @@ public:
   already_AddRefd<CDA_SRuSSimulationStep> shallowClone();
 
 private:
+  friend class CDA_SRuSLoopIterations;
+
   CDA_SRuSSimulationStepLoop(CDA_SRuSSimulationState* aState,
                              CDA_SRuSSimulationStep* aSuccessor,
                              int aNumPoints, int aCurrentIndex,
                              std::list<iface::SProS::Range*>& aRanges,
                              iface::SProS::SetValueSet* aSetValues,
-                             CDA_SRuSSimulationStep* aLoopChain);
+                             CDA_SRuSSimulationStep* aLoopChain,
+                             bool aResetModel);
+
+  /*
+   * Sets the range values for mCurrentIndex, and applies the set values to
+   * mState.
+   */
+  void setUpIteration();
+
+  /*
+   * True if each iteration starts from the initial state and nothing in it
+   * depends on an earlier iteration, so they can run at the same time.
+   */
+  bool iterationsAreIndependent();
 
   int mNumPoints, mCurrentIndex;
+  bool mResetModel;
   std::list<iface::SProS::Range*> mRanges;
   scoped_destroy<std::list<iface::SProS::Range*> > mRangesRAII;
   ObjRef<iface::SProS::SetValueSet> mSetValues;
@@ -446,3 +488,80 @@ public:
 private:
   std::map<std::wstring, std::vector<double> > mHistory;
 };
+
+/*
+ * MathML using the SED-ML subset, compiled once into a flat list of
+ * instructions, each of which writes one register, with variables resolved to
+ * slots. It is then evaluated over a block of points at a time, one
+ * instruction at a time, rather than walking the DOM at every point.
+ * Aggregates aren't supported; compiling math that uses one throws
+ * NeedsAggregate, so the caller can fall back to SEDMLMathEvaluatorWithAggregate.
+ */
+class SEDMLCompiledMath
+{
+public:
+  /*
+   * aSlots gives the slot of each variable that can change from point to point,
+   * and aParameters the value of each variable that can't.
+   */
+  SEDMLCompiledMath(iface::mathml_dom::MathMLElement* aME,
+                    const std::map<std::wstring, uint32_t>& aSlots,
+                    const std::map<std::wstring, double>& aParameters);
+
+  /*
+   * Evaluates the math at aN points, writing the results to aOut. The value of
+   * the variable in slot i at point j is aInputs[i][j * aStrides[i]], so a
+   * stride of zero gives a value that is the same at every point.
+   */
+  void evalBlock(uint32_t aN, const double* const* aInputs,
+                 const uint32_t* aStrides, double* aOut);
+
+private:
+  enum Opcode
+  {
+    OP_CONSTANT,
+    OP_VARIABLE,
+    OP_UNARY,
+    OP_BINARY,
+    OP_NEGATE,
+    OP_SUBTRACT,
+    OP_DIVIDE,
+    OP_PLUS,
+    OP_TIMES,
+    OP_AND,
+    OP_OR,
+    OP_SELECT
+  };
+
+  struct Instruction
+  {
+    Instruction(Opcode aOp)
+      : mOp(aOp), mConstant(0.0), mSlot(0), mUnary(NULL), mBinary(NULL) {}
+
+    Opcode mOp;
+    double mConstant;
+    uint32_t mSlot;
+    double (*mUnary)(double);
+    double (*mBinary)(double, double);
+    // The registers this instruction reads from.
+    std::vector<uint32_t> mOperands;
+  };
+
+  uint32_t compile(iface::mathml_dom::MathMLElement* aME);
+  uint32_t compileApply(iface::mathml_dom::MathMLApplyElement* mae);
+  uint32_t compileVariable(iface::mathml_dom::MathMLCiElement* mcie);
+  uint32_t compilePiecewise(iface::mathml_dom::MathMLPiecewiseElement* mpe);
+  uint32_t emitConstant(double aValue);
+  uint32_t emit(const Instruction& aInstruction);
+  void execute(uint32_t aInstruction, uint32_t aN, const double* const* aInputs,
+               const uint32_t* aStrides, uint32_t aOffset);
+
+  std::map<std::wstring, uint32_t> mSlots;
+  std::map<std::wstring, double> mParameters;
+  // Used to read constants and predefined symbols.
+  SEDMLMathEvaluator mConstantEvaluator;
+  std::vector<Instruction> mProgram;
+  // One block of values for each instruction, in order.
+  std::vector<double> mRegisters;
+  uint32_t mResult;
+};
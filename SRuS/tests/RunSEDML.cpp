@@ -3,6 +3,8 @@
 #include "SProSBootstrap.hpp"
 #include "SRuSBootstrap.hpp"
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <map>
 #include <vector>
@@ -141,10 +143,15 @@ main(int argc, char** argv)
 
   if (argc < 2)
   {
-    printf("Usage: RunSEDML url-to-sedml-file\n");
+    printf("Usage: RunSEDML url-to-sedml-file [iterations n]\n");
     return 1;
   }
 
+  // The other arguments come in pairs; ones we don't know are ignored.
+  for (int i = 2; i + 1 < argc; i += 2)
+    if (!strcmp(argv[i], "iterations"))
+      sp->maximumConcurrentIterations(strtoul(argv[i + 1], NULL, 10));
+
   uint32_t taskCount = 0;
   size_t l = strlen(argv[1]);
   wchar_t* URL = new wchar_t[l + 1];
@@ -87,6 +87,58 @@ ConvertWcharStringToJString(JNIEnv* env, const wchar_t* aString)
   return ret;
 }
 
+static JavaBridgeIDs sJavaBridgeIDs;
+static bool sHaveJavaBridgeIDs = false;
+static CDAMutex sJavaBridgeIDsMutex;
+
+const JavaBridgeIDs*
+GetJavaBridgeIDs(JNIEnv* env)
+{
+  CDALock l(sJavaBridgeIDsMutex);
+  if (sHaveJavaBridgeIDs)
+    return &sJavaBridgeIDs;
+
+  jclass vec = env->FindClass("java/util/Vector");
+  sJavaBridgeIDs.vectorClass = static_cast<jclass>(env->NewGlobalRef(vec));
+  env->DeleteLocalRef(vec);
+  sJavaBridgeIDs.vectorInit = env->GetMethodID(sJavaBridgeIDs.vectorClass,
+                                               "<init>", "(I)V");
+  sJavaBridgeIDs.vectorSize = env->GetMethodID(sJavaBridgeIDs.vectorClass,
+                                               "size", "()I");
+  sJavaBridgeIDs.vectorGet = env->GetMethodID(sJavaBridgeIDs.vectorClass,
+                                              "get", "(I)Ljava/lang/Object;");
+  sJavaBridgeIDs.vectorAdd = env->GetMethodID(sJavaBridgeIDs.vectorClass,
+                                              "add", "(Ljava/lang/Object;)Z");
+
+  jclass ref = env->FindClass("pjm/Reference");
+  sJavaBridgeIDs.referenceClass = static_cast<jclass>(env->NewGlobalRef(ref));
+  env->DeleteLocalRef(ref);
+  sJavaBridgeIDs.referenceInit = env->GetMethodID(sJavaBridgeIDs.referenceClass,
+                                                  "<init>", "()V");
+  sJavaBridgeIDs.referenceGet = env->GetMethodID(sJavaBridgeIDs.referenceClass,
+                                                 "get", "()Ljava/lang/Object;");
+  sJavaBridgeIDs.referenceSet = env->GetMethodID(sJavaBridgeIDs.referenceClass,
+                                                 "set", "(Ljava/lang/Object;)V");
+
+  sHaveJavaBridgeIDs = true;
+  return &sJavaBridgeIDs;
+}
+
+// Looks everything up while we are on a Java thread, where FindClass can see
+// our classes. Platforms which don't call this for a dependent library look
+// them up on first use instead.
+extern "C" PUBLIC_JAVA_PRE jint JNI_OnLoad(JavaVM* vm, void* reserved) PUBLIC_JAVA_POST;
+
+jint
+JNI_OnLoad(JavaVM* vm, void* reserved)
+{
+  JNIEnv* env;
+  if (vm->GetEnv((void**)&env, JNI_VERSION_1_2) != JNI_OK)
+    return JNI_ERR;
+  GetJavaBridgeIDs(env);
+  return JNI_VERSION_1_2;
+}
+
 std::map<std::string, P2JFactory*>* P2JFactory::mMap = NULL;
 
 jobject
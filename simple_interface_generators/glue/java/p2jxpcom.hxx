@@ -48,6 +48,19 @@ PUBLIC_JAVA_PRE jobject wrap_XPCOM_IObject(JNIEnv* aEnv, iface::XPCOM::IObject*
 
 PUBLIC_JAVA_PRE jstring ConvertWcharStringToJString(JNIEnv* env, const wchar_t* aString) PUBLIC_JAVA_POST;
 
+// Classes and methods which the generated code uses on almost every call. They
+// are looked up once, since FindClass and GetMethodID are slow, and FindClass
+// can't see our own classes from threads which Java didn't start.
+struct JavaBridgeIDs
+{
+  jclass vectorClass;
+  jmethodID vectorInit, vectorSize, vectorGet, vectorAdd;
+  jclass referenceClass;
+  jmethodID referenceInit, referenceGet, referenceSet;
+};
+
+PUBLIC_JAVA_PRE const JavaBridgeIDs* GetJavaBridgeIDs(JNIEnv* env) PUBLIC_JAVA_POST;
+
 PUBLIC_JAVA_PRE class PUBLIC_JAVA_POST P2JFactory
 {
 public:
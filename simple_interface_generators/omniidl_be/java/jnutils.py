@@ -51,10 +51,9 @@ class Type:
             return td + ';'
         else:
             # Create the Reference object...
-            makeReference = "  jclass tmpclazz = env->FindClass(\"pjm/Reference\");\n" +\
-                            "  jmethodID initmethod = env->GetMethodID(tmpclazz, \"" +\
-                            "<init>\", \"()V\");\n" +\
-                            "  " + name + " = env->NewObject(tmpclazz, initmethod);\n"
+            makeReference = "  const JavaBridgeIDs* tmpids = GetJavaBridgeIDs(env);\n" +\
+                            "  " + name + " = env->NewObject(tmpids->referenceClass, " +\
+                            "tmpids->referenceInit);\n"
             return td + ';\n  {\n' + makeReference + '  }'
 
     def javaSig(self, direction):
@@ -79,19 +78,17 @@ class Type:
 
     def readJNIReference(self, code, jniname):
         return "{\n" +\
-               "  jclass tmpclazz = env->FindClass(\"pjm/Reference\");\n" +\
-               "  jmethodID tmpgetref = env->GetMethodID(tmpclazz, \"get\", \"()Ljava/lang/Object;\");\n" +\
-               "  jobject tmpobj = env->CallObjectMethod(" + jniname + ", tmpgetref);\n" +\
+               "  jobject tmpobj = env->CallObjectMethod(" + jniname + ", " +\
+               "GetJavaBridgeIDs(env)->referenceGet);\n" +\
                code +\
                "}\n"
 
     def writeJNIReference(self, code, jniname):
         return "{\n" +\
-               "  jclass tmpclazz = env->FindClass(\"pjm/Reference\");\n" +\
-               "  jmethodID tmpsetref = env->GetMethodID(tmpclazz, \"set\", \"(Ljava/lang/Object;)V\");\n" +\
                "  jobject tmpobj;\n" +\
                code +\
-               "  env->CallVoidMethod(" + jniname + ", tmpsetref, tmpobj);\n" +\
+               "  env->CallVoidMethod(" + jniname + ", " +\
+               "GetJavaBridgeIDs(env)->referenceSet, tmpobj);\n" +\
                "}\n"
 
     def convertToPCM(self, jniname, pcmname, indirectIn = 0, indirectOut = 0, unbox = 0):
@@ -393,12 +390,29 @@ class WString(String):
                 Type.DERIVE: 'Ljava/lang/String;'
                }[direction]
 
+# Sequences of these are passed as Java arrays, and copied a block at a time.
+PRIMITIVE_ARRAY_KINDS = [idltype.tk_short, idltype.tk_long, idltype.tk_ushort,
+                         idltype.tk_ulong, idltype.tk_float, idltype.tk_double,
+                         idltype.tk_octet, idltype.tk_longlong,
+                         idltype.tk_ulonglong]
+# ... but these have a wider Java type than C++ type, so need converting.
+WIDENED_KINDS = [idltype.tk_ushort, idltype.tk_ulong]
+
 class Sequence(Type):
     def __init__(self, type):
-        self.seqType = GetTypeInformation(type.seqType().unalias())
-        self.derive_name = self.seqType.javaType(Type.DERIVE)
-        self.java_type = 'java.util.Vector<' + self.derive_name + '>'
-        self.java_sig = 'Ljava/util/Vector;'
+        seqType = type.seqType().unalias()
+        self.seqType = GetTypeInformation(seqType)
+        self.primitive = seqType.kind() in PRIMITIVE_ARRAY_KINDS
+        if self.primitive:
+            self.widened = seqType.kind() in WIDENED_KINDS
+            self.java_type = self.seqType.java_type + '[]'
+            self.java_sig = '[' + self.seqType.java_sig
+            self.array_type = self.seqType.jni_type + 'Array'
+            self.array_call = string.capitalize(self.seqType.java_type) + 'Array'
+        else:
+            self.derive_name = self.seqType.javaType(Type.DERIVE)
+            self.java_type = 'java.util.Vector<' + self.derive_name + '>'
+            self.java_sig = 'Ljava/util/Vector;'
         self.failure_return = 'NULL'
         self.cref = ''
 
@@ -422,6 +436,48 @@ class Sequence(Type):
         else:
           return ""
 
+    def arrayToPCM(self, iname, oname):
+        pcmtype = self.seqType.pcmType(Type.DERIVE)
+        jnitype = self.seqType.jni_type
+        code = "{\n" +\
+               "  " + self.array_type + " tmparray = static_cast<" +\
+               self.array_type + ">(" + iname + ");\n" +\
+               "  jsize _tmp_length = env->GetArrayLength(tmparray);\n"
+        if self.widened:
+            code = code +\
+                   "  std::vector<" + jnitype + "> tmpbuf(_tmp_length);\n" +\
+                   "  if (_tmp_length != 0)\n" +\
+                   "    env->Get" + self.array_call + "Region(tmparray, 0, _tmp_length, &tmpbuf[0]);\n" +\
+                   "  " + oname + " = std::vector<" + pcmtype + ">(_tmp_length);\n" +\
+                   "  for (jsize tmpidx = 0; tmpidx < _tmp_length; tmpidx++)\n" +\
+                   "    " + oname + "[tmpidx] = static_cast<" + pcmtype + ">(tmpbuf[tmpidx]);\n"
+        else:
+            code = code +\
+                   "  " + oname + " = std::vector<" + pcmtype + ">(_tmp_length);\n" +\
+                   "  if (_tmp_length != 0)\n" +\
+                   "    env->Get" + self.array_call + "Region(tmparray, 0, _tmp_length, " +\
+                   "reinterpret_cast<" + jnitype + "*>(&" + oname + "[0]));\n"
+        return code + "}\n"
+
+    def arrayToJNI(self, iname, oname):
+        jnitype = self.seqType.jni_type
+        code = "{\n" +\
+               "  jsize _tmp_length = " + iname + ".size();\n" +\
+               "  " + self.array_type + " tmparray = env->New" + self.array_call +\
+               "(_tmp_length);\n"
+        if self.widened:
+            code = code +\
+                   "  std::vector<" + jnitype + "> tmpbuf(" + iname + ".begin(), " +\
+                   iname + ".end());\n" +\
+                   "  if (_tmp_length != 0)\n" +\
+                   "    env->Set" + self.array_call + "Region(tmparray, 0, _tmp_length, &tmpbuf[0]);\n"
+        else:
+            code = code +\
+                   "  if (_tmp_length != 0)\n" +\
+                   "    env->Set" + self.array_call + "Region(tmparray, 0, _tmp_length, " +\
+                   "reinterpret_cast<const " + jnitype + "*>(&" + iname + "[0]));\n"
+        return code + "  " + oname + " = tmparray;\n}\n"
+
     def convertToPCM(self, jniname, pcmname, indirectIn = 0, indirectOut = 0, unbox = 0):
         oname = pcmname
 
@@ -430,21 +486,22 @@ class Sequence(Type):
         else:
             iname = jniname
 
-        code = "{\n" +\
-               "  jclass vec = env->FindClass(\"java/util/Vector\");\n" +\
-               "  jmethodID vecsize = env->GetMethodID(vec, \"size\", \"()I\");\n"+\
-               "  jmethodID vecget = env->GetMethodID(vec, \"get\", \"(I)Ljava/lang/Object;\");\n"+\
-               '  uint32_t _tmp_length = env->CallIntMethod(' + iname + ", vecsize);\n"+\
-               '  ' + oname + ' = std::vector<' + self.seqType.pcmType(Type.DERIVE) + ">();\n"+\
-               "  for (uint32_t tmpidx = 0; tmpidx < _tmp_length; tmpidx++)\n"+\
-               "  {\n"+\
-               "    jobject tmparrayobj = env->CallObjectMethod(" + iname + ", vecget, tmpidx);\n"+\
-               "    " + self.seqType.pcmType(Type.RETURN) + " _tmp_val;"+\
-               self.seqType.convertToPCM('tmparrayobj', '_tmp_val', 0, 0, 1)+\
-               "    " + oname + ".push_back(_tmp_val);\n"+\
-               "    env->DeleteLocalRef(tmparrayobj);\n"+\
-               "  }\n" +\
-               "}\n"
+        if self.primitive:
+            code = self.arrayToPCM(iname, oname)
+        else:
+            code = "{\n" +\
+                   "  const JavaBridgeIDs* tmpids = GetJavaBridgeIDs(env);\n" +\
+                   '  uint32_t _tmp_length = env->CallIntMethod(' + iname + ", tmpids->vectorSize);\n"+\
+                   '  ' + oname + ' = std::vector<' + self.seqType.pcmType(Type.DERIVE) + ">();\n"+\
+                   "  for (uint32_t tmpidx = 0; tmpidx < _tmp_length; tmpidx++)\n"+\
+                   "  {\n"+\
+                   "    jobject tmparrayobj = env->CallObjectMethod(" + iname + ", tmpids->vectorGet, tmpidx);\n"+\
+                   "    " + self.seqType.pcmType(Type.RETURN) + " _tmp_val;"+\
+                   self.seqType.convertToPCM('tmparrayobj', '_tmp_val', 0, 0, 1)+\
+                   "    " + oname + ".push_back(_tmp_val);\n"+\
+                   "    env->DeleteLocalRef(tmparrayobj);\n"+\
+                   "  }\n" +\
+                   "}\n"
 
         if indirectIn:
             return self.readJNIReference(code, jniname)
@@ -453,30 +510,31 @@ class Sequence(Type):
 
     def convertToJNI(self, jniname, pcmname, indirectIn = 0, indirectOut = 0, box = 0):
         if indirectIn:
-            iname = '*' + pcmname
+            iname = '(*' + pcmname + ')'
         else:
             iname = pcmname
 
-        if indirectIn:
+        if indirectOut:
             oname = 'tmpobj'
         else:
             oname = jniname
 
-        code = "{\n" +\
-               "  jclass vec = env->FindClass(\"java/util/Vector\");\n" +\
-               "  jmethodID initmethod = env->GetMethodID(vec, \"<init>\", " +\
-               "\"(I)V\");\n" +\
-               "  " + oname + " = env->NewObject(vec, initmethod, " + iname + ".size());\n" +\
-               "  jmethodID vecadd = env->GetMethodID(vec, \"add\", \"(Ljava/lang/Object;)Z\");"+\
-               "  for (uint32_t tmpidx = 0; tmpidx < " + iname + ".size(); tmpidx++)\n"+\
-               "  {\n"+\
-               "    jobject tmparrayobj;\n"+\
-               self.seqType.convertToJNI('tmparrayobj', '(' + iname +\
-                                         ')[tmpidx]', 0, 0, 1)+\
-               "    env->CallBooleanMethod(" + oname + ", vecadd, tmparrayobj);\n"+\
-               "    env->DeleteLocalRef(tmparrayobj);\n"+\
-               "  }\n" +\
-               "}\n"
+        if self.primitive:
+            code = self.arrayToJNI(iname, oname)
+        else:
+            code = "{\n" +\
+                   "  const JavaBridgeIDs* tmpids = GetJavaBridgeIDs(env);\n" +\
+                   "  " + oname + " = env->NewObject(tmpids->vectorClass, tmpids->vectorInit, " +\
+                   iname + ".size());\n" +\
+                   "  for (uint32_t tmpidx = 0; tmpidx < " + iname + ".size(); tmpidx++)\n"+\
+                   "  {\n"+\
+                   "    jobject tmparrayobj;\n"+\
+                   self.seqType.convertToJNI('tmparrayobj', '(' + iname +\
+                                             ')[tmpidx]', 0, 0, 1)+\
+                   "    env->CallBooleanMethod(" + oname + ", tmpids->vectorAdd, tmparrayobj);\n"+\
+                   "    env->DeleteLocalRef(tmparrayobj);\n"+\
+                   "  }\n" +\
+                   "}\n"
 
         if indirectOut:
             return self.writeJNIReference(code, jniname)
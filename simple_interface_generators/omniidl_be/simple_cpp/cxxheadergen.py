@@ -114,6 +114,11 @@ class Walker(idlvisitor.AstVisitor):
         # Write a pure virtual destructor...
         self.cxxheader.out('static const char* INTERFACE_NAME() { return "' + node.corbacxxscoped + '"; }')
         self.cxxheader.out('virtual ~' + node.simplename + '() {}')
+        if node.corbacxxscoped == 'XPCOM::IObject':
+            # Not in the IDL: objects made in this process give the number
+            # their objid() was formatted from, so they can be compared
+            # without building the strings. Anything else returns 0.
+            self.cxxheader.out('virtual uint64_t objectNumber() throw() { return 0; }')
         for n in node.contents():
             n.accept(self)
         self.cxxheader.dec_indent()
@@ -275,6 +280,13 @@ class Walker(idlvisitor.AstVisitor):
         call = call + ') throw(std::exception&)' +\
                simplecxx.shouldWarnIfUnused(node.returnType()) + ' = 0;'
         self.cxxheader.out(call)
+        if node.simplename == 'query_interface':
+            # A faster form taking a name from CDA_InternInterfaceName, which
+            # implementations can override to compare by pointer. Anything
+            # which doesn't (such as bridges) just gets the string version.
+            self.cxxheader.out('virtual void* query_interface_interned(' +
+                               'const char* id) throw(std::exception&) ' +
+                               '{ return query_interface(id); }')
     
 def run(tree):
     w = Walker()
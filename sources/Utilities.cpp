@@ -1,6 +1,7 @@
 #include "Utilities.hxx"
 #include "Ifacexpcom.hxx"
 #include <map>
+#include <set>
 #include <list>
 
 UTILS_PUBLIC_PRE wchar_t*
@@ -12,6 +13,103 @@ CDA_wcsdup(const wchar_t* str)
   return xstr;
 }
 
+static volatile uint64_t sLastObjectID = 0;
+#if !(defined(WIN32) || defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8))
+static CDAMutex sObjectIDMutex;
+#endif
+
+UTILS_PUBLIC_PRE uint64_t
+CDA_NextObjectID()
+{
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+  return __sync_add_and_fetch(&sLastObjectID, 1);
+#elif defined(WIN32)
+  return InterlockedIncrement64((volatile LONGLONG*)&sLastObjectID);
+#else
+  CDALock l(sObjectIDMutex);
+  return ++sLastObjectID;
+#endif
+}
+
+// In ASCII order, so that comparing two IDs from this process gives the same
+// answer as comparing their numbers (see CDA_objcmp).
+static const char sObjectIDDigits[] =
+  "+/0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+// The prefix keeps IDs from different processes (e.g. over a bridge) apart.
+// It is filled in while the library is loaded, before any other threads can
+// be asking for IDs.
+static char sObjectIDPrefix[6];
+
+static void
+FillObjectIDPrefix()
+{
+  MersenneTwister mt;
+  uint32_t r = mt.randomUInt32();
+  for (uint32_t i = 0; i < sizeof(sObjectIDPrefix); i++, r >>= 6)
+    sObjectIDPrefix[i] = sObjectIDDigits[r & 0x3F];
+}
+
+class ObjectIDPrefixInitialiser
+{
+public:
+  ObjectIDPrefixInitialiser()
+  {
+    if (sObjectIDPrefix[0] == 0)
+      FillObjectIDPrefix();
+  }
+};
+static ObjectIDPrefixInitialiser sObjectIDPrefixInitialiser;
+
+UTILS_PUBLIC_PRE void
+CDA_FormatObjectID(uint64_t aID, char* aBuf)
+{
+  // Objects made by other static initialisers could get here first.
+  if (sObjectIDPrefix[0] == 0)
+    FillObjectIDPrefix();
+
+  memcpy(aBuf, sObjectIDPrefix, sizeof(sObjectIDPrefix));
+  for (uint32_t i = CDA_OBJECT_ID_LENGTH; i > sizeof(sObjectIDPrefix);
+       i--, aID >>= 6)
+    aBuf[i - 1] = sObjectIDDigits[aID & 0x3F];
+  aBuf[CDA_OBJECT_ID_LENGTH] = 0;
+}
+
+static std::set<std::string>* sInternedInterfaceNames;
+static CDAMutex* sInternedInterfaceNamesMutex;
+
+static void
+EnsureInternedInterfaceNames()
+{
+  if (sInternedInterfaceNames != NULL)
+    return;
+  sInternedInterfaceNames = new std::set<std::string>();
+  sInternedInterfaceNamesMutex = new CDAMutex();
+}
+
+// Sets up the names while the library is loaded, before other threads can be
+// asking for them.
+class InternedInterfaceNamesInitialiser
+{
+public:
+  InternedInterfaceNamesInitialiser()
+  {
+    EnsureInternedInterfaceNames();
+  }
+};
+static InternedInterfaceNamesInitialiser sInternedInterfaceNamesInitialiser;
+
+UTILS_PUBLIC_PRE const char*
+CDA_InternInterfaceName(const char* aName)
+{
+  // Objects made by other static initialisers could get here first.
+  EnsureInternedInterfaceNames();
+
+  CDALock l(*sInternedInterfaceNamesMutex);
+  // Elements of a set never move, so the pointer stays valid.
+  return sInternedInterfaceNames->insert(aName).first->c_str();
+}
+
 static int sWasInitialised = 0;
 
 static std::list<std::pair<void*, void(*)(void*)> >* sAllThreadDestructors;
@@ -52,7 +150,7 @@ UTILS_PUBLIC_PRE void CDA_RegisterNamedDestructorThreadLocal(const char* aName,
                              (aName, std::pair<void*,void(*)(void*)>(aData, aFunc)));
 }
 
-UTILS_PUBLIC_PRE void CDAThread::startthread()
+UTILS_PUBLIC_PRE bool CDAThread::startthread()
 {
     if (!mRunning)
     {
@@ -61,14 +159,24 @@ UTILS_PUBLIC_PRE void CDAThread::startthread()
       DWORD tid;
       HANDLE h = CreateThread(NULL, 0, ThreadProc,
                               reinterpret_cast<LPVOID>(this), 0, &tid);
+      if (h == NULL)
+      {
+        mRunning = false;
+        return false;
+      }
       CloseHandle(h);
 #else
       pthread_t thread;
-      pthread_create(&thread, NULL, start_routine,
-                     reinterpret_cast<void*>(this));
+      if (pthread_create(&thread, NULL, start_routine,
+                         reinterpret_cast<void*>(this)) != 0)
+      {
+        mRunning = false;
+        return false;
+      }
       pthread_detach(thread);
 #endif
     }
+    return true;
 }
 
 void CDAThread::runThreadCleanup()
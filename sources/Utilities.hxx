@@ -440,6 +440,7 @@ public:
 #endif
   }
 private:
+  friend class CDACondition;
 #ifdef WIN32
   CRITICAL_SECTION mMutex;
 #else
@@ -447,6 +448,60 @@ private:
 #endif
 };
 
+// A wrapper for a condition variable, which is waited on with a CDAMutex held...
+class CDACondition
+{
+public:
+  CDACondition()
+  {
+#ifdef WIN32
+    InitializeConditionVariable(&mCondition);
+#else
+    pthread_cond_init(&mCondition, NULL);
+#endif
+  }
+
+  ~CDACondition()
+  {
+#ifndef WIN32
+    pthread_cond_destroy(&mCondition);
+#endif
+  }
+
+  void Wait(CDAMutex& aMutex)
+  {
+#ifdef WIN32
+    SleepConditionVariableCS(&mCondition, &aMutex.mMutex, INFINITE);
+#else
+    pthread_cond_wait(&mCondition, &aMutex.mMutex);
+#endif
+  }
+
+  void Signal()
+  {
+#ifdef WIN32
+    WakeConditionVariable(&mCondition);
+#else
+    pthread_cond_signal(&mCondition);
+#endif
+  }
+
+  void Broadcast()
+  {
+#ifdef WIN32
+    WakeAllConditionVariable(&mCondition);
+#else
+    pthread_cond_broadcast(&mCondition);
+#endif
+  }
+private:
+#ifdef WIN32
+  CONDITION_VARIABLE mCondition;
+#else
+  pthread_cond_t mCondition;
+#endif
+};
+
 // A class to provide a scoped lock...
 class CDALock
 {
@@ -475,7 +530,8 @@ public:
 
   virtual ~CDAThread() {}
 
-  UTILS_PUBLIC_PRE void startthread() UTILS_PUBLIC_POST;
+  // Returns false if the thread couldn't be started.
+  UTILS_PUBLIC_PRE bool startthread() UTILS_PUBLIC_POST;
 
 protected:
   virtual void runthread() {}
@@ -786,55 +842,51 @@ HEADER_INLINE int
 CDA_objcmp(iface::XPCOM::IObject* o1, iface::XPCOM::IObject* o2)
   throw()
 {
-  std::string s1(o1->objid()), s2(o2->objid());
-  return strcmp(s1.c_str(), s2.c_str());
+  // Most comparisons which find a match are against the very same pointer, so
+  // don't bother fetching the IDs for them.
+  if (o1 == o2)
+    return 0;
+  // IDs made in this process differ only in the number, and sort the same way
+  // as it does, so there is no need to build the strings.
+  uint64_t n1 = o1->objectNumber(), n2 = o2->objectNumber();
+  if (n1 != 0 && n2 != 0)
+    return (n1 < n2) ? -1 : ((n1 > n2) ? 1 : 0);
+  return o1->objid().compare(o2->objid());
 }
 
+// Object IDs are made up of a prefix which is random for each process, followed
+// by a number counting up from 1. They are kept short enough that
+// std::string doesn't need to allocate memory for them.
+#define CDA_OBJECT_ID_LENGTH 14
+
+// Returns the next number to use in an object ID. Safe to call from any thread.
+UTILS_PUBLIC_PRE uint64_t CDA_NextObjectID() UTILS_PUBLIC_POST;
+
+// Writes the object ID for aID into aBuf, which must have space for
+// CDA_OBJECT_ID_LENGTH characters plus a terminating null.
+UTILS_PUBLIC_PRE void CDA_FormatObjectID(uint64_t aID, char* aBuf) UTILS_PUBLIC_POST;
+
 class CDA_ID
 {
 public:
   CDA_ID()
+    : mID(CDA_NextObjectID())
   {
-    uint32_t a, b, c, d;
-    a = sharedRandom()->randomUInt32();
-    b = sharedRandom()->randomUInt32();
-    c = sharedRandom()->randomUInt32();
-    d = sharedRandom()->randomUInt32();
-    mIDString[0] = (char)(((a << 1) & 0xFE) | 1);
-    mIDString[1] = (char)(((a >> 6) & 0xFE) | 1);
-    mIDString[2] = (char)(((a >> 13) & 0xFE) | 1);
-    mIDString[3] = (char)(((a >> 20) & 0xFE) | 1);
-    mIDString[4] = (char)(((a >> 26) & 0x1E) | ((b << 5) & 0x70) | 1);
-    mIDString[5] = (char)(((b >> 2) & 0xFE) | 1);
-    mIDString[6] = (char)(((b >> 9) & 0xFE) | 1);
-    mIDString[7] = (char)(((b >> 16) & 0xFE) | 1);
-    mIDString[8] = (char)(((b >> 23) & 0xFE) | 1);
-    mIDString[9] = (char)(((b >> 30) & 0x2) | ((c << 2) & (0xFC)) | 1);
-    mIDString[10] = (char)(((c >> 5) & 0xFE) | 1);
-    mIDString[11] = (char)(((c >> 12) & 0xFE) | 1);
-    mIDString[12] = (char)(((c >> 19) & 0xFE) | 1);
-    mIDString[13] = (char)(((c >> 26) & 0x3E) | ((d << 6) & 0xC0) | 1);
-    mIDString[14] = (char)(((d >> 1) & 0xFE) | 1);
-    mIDString[15] = (char)(((d >> 8) & 0xFE) | 1);
-    mIDString[16] = (char)(((d >> 15) & 0xFE) | 1);
-    mIDString[17] = (char)(((d >> 22) & 0xFE) | 1);
-    mIDString[18] = (char)(((d >> 29) & 0x06) | 1);
-    mIDString[19] = 0;
-
-    // This form is more readable, but too expensive to generate routinely.
-    // sprintf(mIDString, "%08X-%04X-%04X-%04X-%04X%08X",
-    //        a, (b & 0xFFFF), (b >> 16) & 0xFFFF,
-    //        c & 0xFFFF, (c >> 16) & 0xFFFF, d);
-    //mIDString[36] = 0;
-
   }
 
   std::string cloneID() const
   {
-    return mIDString;
+    char buf[CDA_OBJECT_ID_LENGTH + 1];
+    CDA_FormatObjectID(mID, buf);
+    return std::string(buf, CDA_OBJECT_ID_LENGTH);
+  }
+
+  uint64_t number() const
+  {
+    return mID;
   }
 private:
-  char mIDString[20];
+  uint64_t mID;
 };
 
 class CDA_RefCount
@@ -903,6 +955,11 @@ private:
       throw() \
     { \
       return _cda_id.cloneID(); \
+    } \
+  uint64_t objectNumber() \
+      throw() \
+    { \
+      return _cda_id.number(); \
     }
 
 #define CDA_IMPL_REFCOUNT \
@@ -921,6 +978,40 @@ private:
         delete this; \
     }
 
+// Returns a pointer to a single copy of the interface name aName, which is
+// the same for every call with the same name. Safe to call from any thread.
+UTILS_PUBLIC_PRE const char* CDA_InternInterfaceName(const char* aName) UTILS_PUBLIC_POST;
+
+// These make up query_interface_interned, which compares the (interned) id it
+// is given with each interface by pointer, instead of comparing strings. The
+// interned names are cached in function statics; if two threads race to set
+// one up, they both store the same pointer.
+#define CDA_QI_INTERNED_BEGIN \
+    void* query_interface_interned(const char* id) \
+      throw(std::exception&) \
+    { \
+      static const char* _qi_IObject = \
+        CDA_InternInterfaceName("XPCOM::IObject"); \
+      if (id == _qi_IObject) \
+      { \
+        add_ref(); \
+        return static_cast<iface::XPCOM::IObject*>(this); \
+      }
+
+#define CDA_QI_INTERNED_CASE(c) \
+      { \
+        static const char* _qi_id = CDA_InternInterfaceName(#c); \
+        if (id == _qi_id) \
+        { \
+          add_ref(); \
+          return static_cast< iface::c* >(this); \
+        } \
+      }
+
+#define CDA_QI_INTERNED_END \
+      return NULL; \
+    }
+
 #define CDA_IMPL_QI0 \
     void* query_interface(const std::string& id) \
       throw(std::exception&) \
@@ -937,7 +1028,9 @@ private:
       std::vector<std::string> v; \
       v.push_back("XPCOM::IObject"); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI1(c1) \
     void* query_interface(const std::string& id) \
@@ -961,7 +1054,10 @@ private:
       v.push_back("XPCOM::IObject"); \
       v.push_back(#c1); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI2(c1, c2) \
     void* query_interface(const std::string& id) \
@@ -991,7 +1087,11 @@ private:
       v.push_back(#c1); \
       v.push_back(#c2); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+      CDA_QI_INTERNED_CASE(c2) \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI3(c1, c2, c3) \
     void* query_interface(const std::string& id) \
@@ -1027,7 +1127,12 @@ private:
       v.push_back(#c2); \
       v.push_back(#c3); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+      CDA_QI_INTERNED_CASE(c2) \
+      CDA_QI_INTERNED_CASE(c3) \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI4(c1, c2, c3, c4) \
     void* query_interface(const std::string& id) \
@@ -1069,7 +1174,13 @@ private:
       v.push_back(#c3); \
       v.push_back(#c4); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+      CDA_QI_INTERNED_CASE(c2) \
+      CDA_QI_INTERNED_CASE(c3) \
+      CDA_QI_INTERNED_CASE(c4) \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI5(c1, c2, c3, c4, c5) \
     void* query_interface(const std::string& id) \
@@ -1117,7 +1228,14 @@ private:
       v.push_back(#c4); \
       v.push_back(#c5); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+      CDA_QI_INTERNED_CASE(c2) \
+      CDA_QI_INTERNED_CASE(c3) \
+      CDA_QI_INTERNED_CASE(c4) \
+      CDA_QI_INTERNED_CASE(c5) \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI6(c1, c2, c3, c4, c5, c6) \
     void* query_interface(const std::string& id) \
@@ -1171,7 +1289,15 @@ private:
       v.push_back(#c5); \
       v.push_back(#c6); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+      CDA_QI_INTERNED_CASE(c2) \
+      CDA_QI_INTERNED_CASE(c3) \
+      CDA_QI_INTERNED_CASE(c4) \
+      CDA_QI_INTERNED_CASE(c5) \
+      CDA_QI_INTERNED_CASE(c6) \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI7(c1, c2, c3, c4, c5, c6, c7) \
     void* query_interface(const std::string& id) \
@@ -1231,7 +1357,16 @@ private:
       v.push_back(#c6); \
       v.push_back(#c7); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+      CDA_QI_INTERNED_CASE(c2) \
+      CDA_QI_INTERNED_CASE(c3) \
+      CDA_QI_INTERNED_CASE(c4) \
+      CDA_QI_INTERNED_CASE(c5) \
+      CDA_QI_INTERNED_CASE(c6) \
+      CDA_QI_INTERNED_CASE(c7) \
+    CDA_QI_INTERNED_END
 
 #define CDA_IMPL_QI8(c1, c2, c3, c4, c5, c6, c7, c8) \
     void* query_interface(const std::string& id) \
@@ -1297,7 +1432,17 @@ private:
       v.push_back(#c7); \
       v.push_back(#c8); \
       return v; \
-    }
+    } \
+    CDA_QI_INTERNED_BEGIN \
+      CDA_QI_INTERNED_CASE(c1) \
+      CDA_QI_INTERNED_CASE(c2) \
+      CDA_QI_INTERNED_CASE(c3) \
+      CDA_QI_INTERNED_CASE(c4) \
+      CDA_QI_INTERNED_CASE(c5) \
+      CDA_QI_INTERNED_CASE(c6) \
+      CDA_QI_INTERNED_CASE(c7) \
+      CDA_QI_INTERNED_CASE(c8) \
+    CDA_QI_INTERNED_END
 
 class DoQueryInterface
 {
@@ -1616,7 +1761,8 @@ private:
 #define QUERY_INTERFACE(lhs, rhs, type) \
   if (rhs != NULL) \
   { \
-    void* _qicast_obj = rhs->query_interface(#type); \
+    static const char* _qicast_id = CDA_InternInterfaceName(#type); \
+    void* _qicast_obj = rhs->query_interface_interned(_qicast_id); \
     if (_qicast_obj != NULL) \
     { \
       lhs = already_AddRefd<iface::type>(reinterpret_cast<iface::type*>(_qicast_obj)); \
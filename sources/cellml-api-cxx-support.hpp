@@ -13,6 +13,13 @@ HEADER_INLINE int
 CDA_objcmp(iface::XPCOM::IObject* o1, iface::XPCOM::IObject* o2)
   throw()
 {
+  if (o1 == o2)
+    return 0;
+
+  uint64_t n1 = o1->objectNumber(), n2 = o2->objectNumber();
+  if (n1 != 0 && n2 != 0)
+    return (n1 < n2) ? -1 : ((n1 > n2) ? 1 : 0);
+
   std::string s1, s2;
   bool vs1 = true, vs2 = true;
   try
@@ -35,7 +42,7 @@ CDA_objcmp(iface::XPCOM::IObject* o1, iface::XPCOM::IObject* o2)
   int cmp;
   if (vs1 && vs2)
   {
-    cmp = strcmp(s1.c_str(), s2.c_str());
+    cmp = s1.compare(s2);
   }
   // if we have a dead object, we can't compare them so easily, so we just
   // follow a basic rule. This can break ordering relationships, but once
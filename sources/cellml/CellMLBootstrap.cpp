@@ -14,6 +14,11 @@
 #include "CellMLBootstrapImpl.hpp"
 #include "CellMLBootstrap.hpp"
 #include "DOMWriter.hxx"
+#include <list>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <ctype.h>
 
 #define CELLML_1_0_NS L"http://www.cellml.org/cellml/1.0#"
 #define CELLML_1_1_NS L"http://www.cellml.org/cellml/1.1#"
@@ -209,6 +214,229 @@ CDA_CellMLBootstrap::makeURLAbsolute
   return aURL;
 }
 
+// The documents we have already parsed, for loading them again without going
+// back to the file. Only local files are cached, because we can tell when
+// those have changed...
+struct CDA_CachedDocument
+{
+  ObjRef<iface::dom::Document> document;
+  time_t mtime;
+  size_t size;
+  std::list<std::string>::iterator lruPosition;
+};
+
+static std::map<std::string, CDA_CachedDocument>* sDocumentCache;
+// Canonical paths, with the most recently used first...
+static std::list<std::string>* sDocumentCacheLRU;
+static CDAMutex* sDocumentCacheMutex;
+static size_t sDocumentCacheLimit, sDocumentCacheSize;
+
+static void
+EnsureDocumentCache()
+{
+  if (sDocumentCache != NULL)
+    return;
+  sDocumentCache = new std::map<std::string, CDA_CachedDocument>();
+  sDocumentCacheLRU = new std::list<std::string>();
+  sDocumentCacheMutex = new CDAMutex();
+  const char* limit = getenv("CELLML_DOCUMENT_CACHE");
+  if (limit != NULL)
+    sDocumentCacheLimit = strtoul(limit, NULL, 10);
+}
+
+// Sets up the cache while the library is loaded, before other threads can be
+// loading documents.
+class DocumentCacheInitialiser
+{
+public:
+  DocumentCacheInitialiser()
+  {
+    EnsureDocumentCache();
+  }
+};
+static DocumentCacheInitialiser sDocumentCacheInitialiser;
+
+// Throws away least recently used documents until the cache fits in its limit.
+// Call with sDocumentCacheMutex held.
+static void
+TrimDocumentCache()
+{
+  while (sDocumentCacheSize > sDocumentCacheLimit)
+  {
+    std::map<std::string, CDA_CachedDocument>::iterator i =
+      sDocumentCache->find(sDocumentCacheLRU->back());
+    sDocumentCacheSize -= (*i).second.size;
+    sDocumentCache->erase(i);
+    sDocumentCacheLRU->pop_back();
+  }
+}
+
+CDA_EXPORT_PRE CDA_EXPORT_POST void
+SetCellMLDocumentCacheLimit(size_t aBytes)
+{
+  EnsureDocumentCache();
+  CDALock l(*sDocumentCacheMutex);
+  sDocumentCacheLimit = aBytes;
+  TrimDocumentCache();
+}
+
+// Works out the canonical path of the local file aURL refers to. Returns false
+// if it isn't a local file.
+static bool
+CDA_CanonicalPathForURL(const std::wstring& aURL, std::string& aPath)
+{
+  std::wstring path;
+  size_t colon = aURL.find(L':');
+  if (colon != std::wstring::npos && colon > 1 &&
+      aURL.find(L'/') > colon)
+  {
+    // It has a scheme, so it had better be a file URL on this host...
+    if (aURL.compare(0, 7, L"file://"))
+      return false;
+    size_t slash = aURL.find(L'/', 7);
+    if (slash == std::wstring::npos)
+      return false;
+    std::wstring host = aURL.substr(7, slash - 7);
+    if (host != L"" && host != L"localhost")
+      return false;
+    path = aURL.substr(slash);
+#ifdef WIN32
+    // file:///C:/...
+    if (path.length() > 2 && path[2] == L':')
+      path = path.substr(1);
+#endif
+  }
+  else
+    path = aURL;
+
+  size_t n = wcstombs(NULL, path.c_str(), 0);
+  if (n == static_cast<size_t>(-1))
+    return false;
+  char* buf = new char[n + 1];
+  wcstombs(buf, path.c_str(), n + 1);
+
+  // Undo any escapes in a file URL...
+  std::string unescaped;
+  for (char* c = buf; *c; c++)
+  {
+    if (c[0] == '%' && isxdigit(c[1]) && isxdigit(c[2]))
+    {
+      char hex[3] = { c[1], c[2], 0 };
+      unescaped += static_cast<char>(strtoul(hex, NULL, 16));
+      c += 2;
+    }
+    else
+      unescaped += *c;
+  }
+  delete [] buf;
+
+#ifdef WIN32
+  char* canonical = _fullpath(NULL, unescaped.c_str(), 0);
+#else
+  char* canonical = realpath(unescaped.c_str(), NULL);
+#endif
+  if (canonical == NULL)
+    return false;
+  aPath = canonical;
+  free(canonical);
+  return true;
+}
+
+// Makes a copy of a cached document for someone to change as they like.
+// Returns NULL if it can't be copied. Call with sDocumentCacheMutex held, since
+// the cached document is shared between threads.
+static iface::dom::Document*
+CDA_CopyCachedDocument(iface::dom::Document* aDocument)
+{
+  try
+  {
+    RETURN_INTO_OBJREF(n, iface::dom::Node, aDocument->cloneNode(true));
+    DECLARE_QUERY_INTERFACE(d, n, dom::Document);
+    return d;
+  }
+  catch (...)
+  {
+    return NULL;
+  }
+}
+
+// Loads aURL, using the document cache if it is switched on...
+static iface::dom::Document*
+CDA_LoadDocumentThroughCache
+(
+ CellML_DOMImplementationBase* aDOMImpl,
+ const std::wstring& aURL,
+ std::wstring& aErrorMessage
+)
+{
+  bool enabled;
+  {
+    CDALock l(*sDocumentCacheMutex);
+    enabled = (sDocumentCacheLimit != 0);
+  }
+
+  // The protocol restrictions are checked on every load, so don't get around
+  // them by caching.
+  std::string path;
+  struct stat st;
+  if (!enabled || getenv("CELLML_RESTRICT_PROTOCOL") != NULL ||
+      !CDA_CanonicalPathForURL(aURL, path) || stat(path.c_str(), &st) != 0)
+    return aDOMImpl->loadDocument(aURL, aErrorMessage);
+
+  {
+    CDALock l(*sDocumentCacheMutex);
+    std::map<std::string, CDA_CachedDocument>::iterator i =
+      sDocumentCache->find(path);
+    if (i != sDocumentCache->end())
+    {
+      CDA_CachedDocument& cd = (*i).second;
+      if (cd.mtime == st.st_mtime && cd.size == static_cast<size_t>(st.st_size))
+      {
+        iface::dom::Document* d = CDA_CopyCachedDocument(cd.document);
+        if (d != NULL)
+        {
+          sDocumentCacheLRU->splice(sDocumentCacheLRU->begin(),
+                                    *sDocumentCacheLRU, cd.lruPosition);
+          return d;
+        }
+      }
+
+      // It has changed since we parsed it...
+      sDocumentCacheSize -= cd.size;
+      sDocumentCacheLRU->erase(cd.lruPosition);
+      sDocumentCache->erase(i);
+    }
+  }
+
+  // Parse without holding the lock, so other threads can load at the same
+  // time...
+  iface::dom::Document* d = aDOMImpl->loadDocument(aURL, aErrorMessage);
+  if (d == NULL)
+    return NULL;
+
+  CDALock l(*sDocumentCacheMutex);
+  size_t size = st.st_size;
+  if (size > sDocumentCacheLimit ||
+      sDocumentCache->find(path) != sDocumentCache->end())
+    return d;
+
+  // Keep the document we parsed, and give the caller a copy...
+  iface::dom::Document* copy = CDA_CopyCachedDocument(d);
+  if (copy == NULL)
+    return d;
+
+  CDA_CachedDocument& cd = (*sDocumentCache)[path];
+  cd.document = already_AddRefd<iface::dom::Document>(d);
+  cd.mtime = st.st_mtime;
+  cd.size = size;
+  sDocumentCacheLRU->push_front(path);
+  cd.lruPosition = sDocumentCacheLRU->begin();
+  sDocumentCacheSize += size;
+  TrimDocumentCache();
+
+  return copy;
+}
+
 CDA_DOMURLLoader::CDA_DOMURLLoader(CellML_DOMImplementationBase* aDOMImpl)
   : mDOMImpl(aDOMImpl)
 {
@@ -219,7 +447,8 @@ already_AddRefd<iface::dom::Document>
 CDA_DOMURLLoader::loadDocument(const std::wstring& URL)
   throw(std::exception&)
 {
-  iface::dom::Document* d = mDOMImpl->loadDocument(URL, mLastError);
+  iface::dom::Document* d =
+    CDA_LoadDocumentThroughCache(mDOMImpl, URL, mLastError);
   if (d == NULL)
   {
     throw iface::cellml_api::CellMLException(L"Could not load document.");
@@ -260,6 +489,118 @@ CDA_DOMURLLoader::lastErrorMessage()
   return mLastError;
 }
 
+// The most threads loadDocuments will use, including the calling thread.
+#define MAX_LOADER_THREADS 4
+
+// The documents being loaded by one call to loadDocuments...
+class CDA_DocumentBatch
+{
+public:
+  CDA_DocumentBatch(CellML_DOMImplementationBase* aDOMImpl,
+                    const std::vector<std::wstring>& aURLs,
+                    std::vector<iface::dom::Document*>& aDocuments)
+    : mDOMImpl(aDOMImpl), mURLs(aURLs), mDocuments(aDocuments), mNext(0),
+      mRunningThreads(0)
+  {
+  }
+
+  // Takes documents off the batch and loads them until there are none left.
+  void
+  loadUntilDone()
+  {
+    while (true)
+    {
+      size_t i;
+      {
+        CDALock l(mMutex);
+        if (mNext == mURLs.size())
+          return;
+        i = mNext++;
+      }
+
+      // The error message is thrown away; the caller finds out what went
+      // wrong by loading the document again itself.
+      std::wstring error;
+      try
+      {
+        mDocuments[i] = CDA_LoadDocumentThroughCache(mDOMImpl, mURLs[i],
+                                                     error);
+      }
+      catch (...)
+      {
+      }
+    }
+  }
+
+  CellML_DOMImplementationBase* mDOMImpl;
+  const std::vector<std::wstring>& mURLs;
+  std::vector<iface::dom::Document*>& mDocuments;
+  size_t mNext;
+
+  CDAMutex mMutex;
+  CDACondition mThreadFinished;
+  uint32_t mRunningThreads;
+};
+
+class CDA_DocumentBatchThread
+  : public CDAThread
+{
+public:
+  CDA_DocumentBatchThread(CDA_DocumentBatch* aBatch)
+    : mBatch(aBatch)
+  {
+  }
+
+protected:
+  void
+  runthread()
+  {
+    mBatch->loadUntilDone();
+    {
+      CDALock l(mBatch->mMutex);
+      mBatch->mRunningThreads--;
+      mBatch->mThreadFinished.Signal();
+    }
+    // The batch may be gone now, but nothing else refers to us.
+    delete this;
+  }
+
+private:
+  CDA_DocumentBatch* mBatch;
+};
+
+void
+CDA_DOMURLLoader::loadDocuments
+(
+ const std::vector<std::wstring>& aURLs,
+ std::vector<iface::dom::Document*>& aDocuments
+)
+{
+  aDocuments.assign(aURLs.size(), NULL);
+  CDA_DocumentBatch batch(mDOMImpl, aURLs, aDocuments);
+
+  // Start helper threads, if there is more than one document...
+  for (size_t i = 1; i < aURLs.size() && i < MAX_LOADER_THREADS; i++)
+  {
+    CDA_DocumentBatchThread* t = new CDA_DocumentBatchThread(&batch);
+    CDALock l(batch.mMutex);
+    if (!t->startthread())
+    {
+      delete t;
+      break;
+    }
+    batch.mRunningThreads++;
+  }
+
+  // This thread loads documents too, so the batch finishes even if no threads
+  // could be started...
+  batch.loadUntilDone();
+
+  CDALock l(batch.mMutex);
+  while (batch.mRunningThreads != 0)
+    batch.mThreadFinished.Wait(batch.mMutex);
+}
+
 CDA_ModelLoader::CDA_ModelLoader(iface::cellml_api::DOMURLLoader* aURLLoader)
   : mURLLoader(aURLLoader)
 {
@@ -9,3 +9,13 @@
 
 CELLML_PUBLIC_PRE already_AddRefd<iface::cellml_api::CellMLBootstrap> CreateCellMLBootstrap()
   CELLML_PUBLIC_POST;
+
+/**
+ * Sets how many bytes of local CellML files may be kept parsed in memory
+ * between loads, for the whole process. Loading a file which is in the cache,
+ * and hasn't changed on disk since it was parsed, then costs a copy of the
+ * document instead of a parse. The limit is 0, which turns the cache off,
+ * unless the CELLML_DOCUMENT_CACHE environment variable gives another.
+ */
+CELLML_PUBLIC_PRE void SetCellMLDocumentCacheLimit(size_t aBytes)
+  CELLML_PUBLIC_POST;
@@ -1,4 +1,5 @@
 #include "DOMBootstrap.hxx"
+#include <vector>
 
 class CDA_ModelLoader
   : public iface::cellml_api::DOMModelLoader
@@ -56,6 +57,12 @@ public:
                          iface::cellml_api::DocumentLoadedListener* listener)
     throw(std::exception&);
   std::wstring lastErrorMessage() throw(std::exception&);
+
+  // Implementation use only: loads several documents at once, on a few
+  // threads. aDocuments gets a new reference to each document, or NULL where
+  // it couldn't be loaded.
+  void loadDocuments(const std::vector<std::wstring>& aURLs,
+                     std::vector<iface::dom::Document*>& aDocuments);
 private:
   CellML_DOMImplementationBase* mDOMImpl;
   std::wstring mLastError;
@@ -10,6 +10,7 @@
 #define MODULE_CONTAINS_DOMevents
 #define MODULE_CONTAINS_MathMLcontentAPISPEC
 #include "CellMLImplementation.hpp"
+#include "CellMLBootstrapImpl.hpp"
 #include "DOMWriter.hxx"
 #ifdef ENABLE_RDF
 #include "RDFBootstrap.hpp"
@@ -31,40 +32,73 @@ WrapCellMLElement(CDA_CellMLElement* newParent,
                   iface::dom::Element* el) throw(std::exception&);
 
 /*
- * This next bit is a very pragmatic way of deciding when to throw away the
- * caches. We need to know when the cache might be stale, while at the same
- * time changes must be efficient. This problem is not as easy as checking the
- * root, since we could easily be working with partial fragments, which get
- * re-arranged. We could do this properly by visiting all elements connected to
- * the element being changed, and invalidating the cache at that time, but that
- * would be too slow. Instead, we have a single global serial number, which we
- * touch every time a change is made. If the current serial number doesn't
- * match the number on the cache, we throw the cache away and rebuild. This
- * does, of course, have the downside that if you have two models open, changes
- * to one model will wipe the cache of the other, completely separate model.
- * The other issue is that serial numbers wrap, so we should make sure the type
- * is big enough. At 1000 changes/second, it would take 49 days to get a
- * conflict with 32 bits, or about 585 million years with 64 bits.
+ * Caches are thrown away when the tree of elements they belong to might have
+ * changed. We need to know when a cache might be stale, while at the same time
+ * changes must be efficient. This problem is not as easy as checking the root,
+ * since we could easily be working with partial fragments, which get
+ * re-arranged. Instead, the root of each tree listens for changes anywhere
+ * under it, and moves the tree on to a new change generation each time. The
+ * generations are taken from a single global counter, so no two trees ever
+ * share one, and a cache built in one tree can't be mistaken for current after
+ * its element is moved into another. Changes to one model therefore leave the
+ * caches of other, completely separate models alone.
+ *
+ * Serial numbers wrap, so we should make sure the type is big enough. At 1000
+ * changes/second, it would take 49 days to get a conflict with 32 bits, or
+ * about 585 million years with 64 bits.
  */
 cda_serial_t gCDAChangeSerial = 1;
 
-// Called to update the change serial when something changes...
-static void CDA_SomethingChanged()
+// Listens for changes under the root of a tree...
+class CDA_ChangeListener
+  : public iface::events::EventListener
 {
-  gCDAChangeSerial++;
-}
+public:
+  CDA_ChangeListener(CDA_CellMLElement* aRoot) : mRoot(aRoot) {}
 
-// Returns true if a cache serial matches the global serial.
-static bool CDA_CompareSerial(cda_serial_t aSerial)
-{
-  return gCDAChangeSerial == aSerial;
-}
+  CDA_IMPL_ID
+  CDA_IMPL_QI1(events::EventListener)
+  void add_ref() throw() {}
+  void release_ref() throw() {}
 
-// A global change listener...
-class CDAGlobalChangeListener
+  void handleEvent(iface::events::Event* aEvent)
+    throw()
+  {
+    mRoot->treeChanged();
+  }
+
+private:
+  CDA_CellMLElement* mRoot;
+};
+
+/*
+ * Keeps the name map of a set of children up to date as children are added,
+ * removed and renamed, so that editing a model doesn't throw away the maps of
+ * every set in it. The DOM events bubble, so we see changes anywhere under the
+ * element, but only act on those to its own children.
+ */
+class CDA_NameIndexListener
   : public iface::events::EventListener
 {
 public:
+  CDA_NameIndexListener(CDA_NamedCellMLElementSetBase* aSet,
+                        iface::dom::Element* aElement)
+    : mSet(aSet), mElement(aElement)
+  {
+    DECLARE_QUERY_INTERFACE_OBJREF(targ, mElement, events::EventTarget);
+    targ->addEventListener(L"DOMNodeInserted", this, false);
+    targ->addEventListener(L"DOMNodeRemoved", this, false);
+    targ->addEventListener(L"DOMAttrModified", this, false);
+  }
+
+  ~CDA_NameIndexListener()
+  {
+    DECLARE_QUERY_INTERFACE_OBJREF(targ, mElement, events::EventTarget);
+    targ->removeEventListener(L"DOMNodeInserted", this, false);
+    targ->removeEventListener(L"DOMNodeRemoved", this, false);
+    targ->removeEventListener(L"DOMAttrModified", this, false);
+  }
+
   CDA_IMPL_ID
   CDA_IMPL_QI1(events::EventListener)
   void add_ref() throw() {}
@@ -73,11 +107,61 @@ public:
   void handleEvent(iface::events::Event* aEvent)
     throw()
   {
-    CDA_SomethingChanged();
+    try
+    {
+      DECLARE_QUERY_INTERFACE_OBJREF(me, aEvent, events::MutationEvent);
+      if (me == NULL)
+        return;
+      RETURN_INTO_OBJREF(targ, iface::events::EventTarget, me->target());
+      // Only elements can be in the set.
+      DECLARE_QUERY_INTERFACE_OBJREF(el, targ, dom::Element);
+      if (el == NULL)
+        return;
+
+      std::wstring type = me->type();
+      if (type == L"DOMAttrModified")
+      {
+        if (me->attrName() != L"name")
+          return;
+        RETURN_INTO_OBJREF(parent, iface::dom::Node, el->parentNode());
+        if (parent == NULL || CDA_objcmp(parent, mElement) != 0)
+          return;
+        mSet->childRenamed(el, me->prevValue(), me->newValue());
+        return;
+      }
+
+      RETURN_INTO_OBJREF(parent, iface::dom::Node, me->relatedNode());
+      if (parent == NULL || CDA_objcmp(parent, mElement) != 0)
+        return;
+
+      if (type == L"DOMNodeRemoved")
+      {
+        mSet->childRemoved(el);
+        return;
+      }
+
+      // Elements appended after all the others can just be added to the end of
+      // the map, but an insertion anywhere else changes where everything
+      // after it is counted, so we have to start again.
+      ObjRef<iface::dom::Node> n(already_AddRefd<iface::dom::Node>
+                                 (el->nextSibling()));
+      while (n != NULL && n->nodeType() != iface::dom::Node::ELEMENT_NODE)
+        n = already_AddRefd<iface::dom::Node>(n->nextSibling());
+      if (n == NULL)
+        mSet->childAppended();
+      else
+        mSet->clearCache();
+    }
+    catch (...)
+    {
+      mSet->clearCache();
+    }
   }
-};
 
-CDAGlobalChangeListener gCDAChangeListener;
+private:
+  CDA_NamedCellMLElementSetBase* mSet;
+  ObjRef<iface::dom::Element> mElement;
+};
 
 CDA_RDFXMLDOMRepresentation::CDA_RDFXMLDOMRepresentation(CDA_Model* aModel)
   : mModel(aModel)
@@ -371,20 +455,16 @@ CDA_CellMLElement::CDA_CellMLElement
  iface::dom::Element* idata
 )
   : mParent(parent), datastore(idata),
-    children(NULL)
+    children(NULL), mChangeListener(NULL), mChangeGeneration(0)
 {
+  datastore->add_ref();
+
   if (parent != NULL)
     parent->add_ref();
   else
-  {
     // We have an unparented element, so changes to it are cache invalidating
-    // events...
-    DECLARE_QUERY_INTERFACE_OBJREF(targ, datastore, events::EventTarget);
-    targ->addEventListener(L"DOMSubtreeModified",
-                           &gCDAChangeListener, false);
-  }
-
-  datastore->add_ref();
+    // events for its tree...
+    becomeRoot();
 }
 
 CDA_CellMLElement::~CDA_CellMLElement()
@@ -403,9 +483,7 @@ CDA_CellMLElement::~CDA_CellMLElement()
 
   if (datastore != NULL)
   {
-    DECLARE_QUERY_INTERFACE_OBJREF(targ, datastore, events::EventTarget);
-    targ->removeEventListener(L"DOMSubtreeModified", &gCDAChangeListener,
-                              false);
+    stopBeingRoot();
     datastore->release_ref();
   }
 
@@ -707,6 +785,48 @@ CDA_CellMLElement::removeElement(iface::cellml_api::CellMLElement* x)
   }
 }
 
+cda_serial_t
+CDA_CellMLElement::changeGeneration()
+{
+  CDA_CellMLElement* root = this;
+  while (root->mParent != NULL)
+    root = root->mParent;
+  return root->mChangeGeneration;
+}
+
+void
+CDA_CellMLElement::treeChanged()
+{
+  CDA_CellMLElement* root = this;
+  while (root->mParent != NULL)
+    root = root->mParent;
+  root->mChangeGeneration = ++gCDAChangeSerial;
+}
+
+void
+CDA_CellMLElement::becomeRoot()
+{
+  mChangeGeneration = ++gCDAChangeSerial;
+  if (mChangeListener != NULL)
+    return;
+
+  mChangeListener = new CDA_ChangeListener(this);
+  DECLARE_QUERY_INTERFACE_OBJREF(targ, datastore, events::EventTarget);
+  targ->addEventListener(L"DOMSubtreeModified", mChangeListener, false);
+}
+
+void
+CDA_CellMLElement::stopBeingRoot()
+{
+  if (mChangeListener == NULL)
+    return;
+
+  DECLARE_QUERY_INTERFACE_OBJREF(targ, datastore, events::EventTarget);
+  targ->removeEventListener(L"DOMSubtreeModified", mChangeListener, false);
+  delete mChangeListener;
+  mChangeListener = NULL;
+}
+
 void
 CDA_CellMLElement::removeLinkFromHereToParent()
 {
@@ -1590,14 +1710,14 @@ CDA_Model::findGroupsWithRelationshipRefName
   return new CDA_GroupSet(allChildren, name);
 }
 
-void
-CDA_Model::fullyInstantiateImports()
+// Adds the imports directly in aModel to the end of aQueue...
+static void
+CDA_QueueImports(CDA_Model* aModel,
+                 std::list<ObjRef<CDA_CellMLImport> >& aQueue)
   throw(std::exception&)
 {
-  std::list<iface::cellml_api::CellMLImport*> importQueue;
-
-  // Go through the list of imports and add them to the queue...
-  RETURN_INTO_OBJREF(imps, iface::cellml_api::CellMLImportSet, imports());
+  RETURN_INTO_OBJREF(imps, iface::cellml_api::CellMLImportSet,
+                     aModel->imports());
   RETURN_INTO_OBJREF(impi, iface::cellml_api::CellMLImportIterator,
                      imps->iterateImports());
   while (true)
@@ -1606,38 +1726,147 @@ CDA_Model::fullyInstantiateImports()
                        impi->nextImport());
     if (imp == NULL)
       break;
-    imp->add_ref();
-    importQueue.push_back(imp);
+    aQueue.push_back(unsafe_dynamic_cast<CDA_CellMLImport*>(imp.getPointer()));
+  }
+}
+
+// Makes a copy of aDocument that shares nothing with it...
+static already_AddRefd<iface::dom::Document>
+CDA_CopyDocument(iface::dom::Document* aDocument)
+  throw(std::exception&)
+{
+  RETURN_INTO_OBJREF(de, iface::dom::Element, aDocument->documentElement());
+  if (de == NULL)
+  {
+    aDocument->add_ref();
+    return aDocument;
   }
 
+  RETURN_INTO_OBJREF(di, iface::dom::DOMImplementation,
+                     aDocument->implementation());
+  RETURN_INTO_WSTRING(ns, de->namespaceURI());
+  RETURN_INTO_OBJREF(newDoc, iface::dom::Document,
+                     di->createDocument(ns.c_str(), L"model", NULL));
+  RETURN_INTO_OBJREF(jde, iface::dom::Element, newDoc->documentElement());
+  newDoc->removeChild(jde)->release_ref();
+  RETURN_INTO_OBJREF(cn, iface::dom::Node, newDoc->importNode(de, true));
+  newDoc->appendChild(cn)->release_ref();
+
+  newDoc->add_ref();
+  return newDoc.getPointer();
+}
+
+struct CDA_ImportDocument
+{
+  CDA_ImportDocument() : used(false) {}
+
+  ObjRef<iface::dom::Document> document;
+  // True once a model has been made from document, so the next import of the
+  // same URL needs a copy...
+  bool used;
+};
+
+void
+CDA_Model::fullyInstantiateImports()
+  throw(std::exception&)
+{
+  std::list<ObjRef<CDA_CellMLImport> > importQueue;
+  CDA_QueueImports(this, importQueue);
+
+  // Every document we have loaded so far, by absolute URL. Models which are
+  // imported more than once (a common units model, say) are only fetched and
+  // parsed once.
+  std::map<std::wstring, CDA_ImportDocument> documents;
+
+  // We go one level of the import tree at a time, so that all the documents
+  // needed for a level can be loaded together...
   while (!importQueue.empty())
   {
-    RETURN_INTO_OBJREF(imp, iface::cellml_api::CellMLImport,
-                       importQueue.front());
-    importQueue.pop_front();
+    std::list<ObjRef<CDA_CellMLImport> > level;
+    level.swap(importQueue);
+
+    std::vector<CDA_Model*> roots;
+    std::vector<std::wstring> urls, newURLs;
+    for (std::list<ObjRef<CDA_CellMLImport> >::iterator i = level.begin();
+         i != level.end(); i++)
+    {
+      if ((*i)->mImportedModel != NULL)
+      {
+        roots.push_back(NULL);
+        urls.push_back(L"");
+        continue;
+      }
 
-    if (!imp->wasInstantiated())
-      imp->instantiate();
+      CDA_Model* root = (*i)->findRootModel();
+      std::wstring url = (*i)->absoluteURL(root);
+      roots.push_back(root);
+      urls.push_back(url);
+      if (documents.find(url) == documents.end())
+      {
+        documents[url];
+        newURLs.push_back(url);
+      }
+    }
 
-    // Now that the model is loaded, add its children to the importQueue...
-    CDA_Model* m =
-      unsafe_dynamic_cast<CDA_Model*>(unsafe_dynamic_cast<CDA_CellMLImport*>
-                                      (imp.getPointer())->mImportedModel);
-    if (m == NULL)
-      continue;
-    
-    // Go through the list of imports and add them to the queue...
-    imps = already_AddRefd<iface::cellml_api::CellMLImportSet>(m->imports());
-    impi = already_AddRefd<iface::cellml_api::CellMLImportIterator>
-      (imps->iterateImports());
-    while (true)
+    // Load the new documents. Only our own loader promises that it can load
+    // from several threads at once; anything else is asked for one document
+    // at a time...
+    CDA_DOMURLLoader* ourLoader = dynamic_cast<CDA_DOMURLLoader*>
+      (mLoader.getPointer());
+    if (ourLoader != NULL)
     {
-      RETURN_INTO_OBJREF(imp, iface::cellml_api::CellMLImport,
-                         impi->nextImport());
-      if (imp == NULL)
-        break;
-      imp->add_ref();
-      importQueue.push_back(imp);
+      std::vector<iface::dom::Document*> newDocs;
+      ourLoader->loadDocuments(newURLs, newDocs);
+      for (size_t j = 0; j < newURLs.size(); j++)
+        documents[newURLs[j]].document =
+          already_AddRefd<iface::dom::Document>(newDocs[j]);
+    }
+    else
+    {
+      for (std::vector<std::wstring>::iterator j = newURLs.begin();
+           j != newURLs.end(); j++)
+      {
+        try
+        {
+          documents[*j].document = already_AddRefd<iface::dom::Document>
+            (mLoader->loadDocument(j->c_str()));
+        }
+        catch (...)
+        {
+        }
+      }
+    }
+
+    size_t idx = 0;
+    for (std::list<ObjRef<CDA_CellMLImport> >::iterator i = level.begin();
+         i != level.end(); i++, idx++)
+    {
+      CDA_CellMLImport* imp = *i;
+      if (roots[idx] != NULL && imp->mImportedModel == NULL)
+      {
+        CDA_ImportDocument& id = documents[urls[idx]];
+        if (id.document == NULL)
+          // The load failed, so let instantiate try again, and report the
+          // error the same way it always has...
+          imp->instantiate();
+        else if (!id.used)
+        {
+          imp->instantiateFromDocument(roots[idx], id.document, urls[idx]);
+          id.used = true;
+        }
+        else
+        {
+          RETURN_INTO_OBJREF(copy, iface::dom::Document,
+                             CDA_CopyDocument(id.document));
+          imp->instantiateFromDocument(roots[idx], copy, urls[idx]);
+        }
+      }
+
+      // Now that the model is loaded, add its children to the queue for the
+      // next level...
+      CDA_Model* m = unsafe_dynamic_cast<CDA_Model*>(imp->mImportedModel);
+      if (m != NULL)
+        CDA_QueueImports(m, importQueue);
     }
   }
 }
@@ -3630,14 +3859,10 @@ CDA_MakeURLAbsolute(CDA_Model* aModel, std::wstring& aURL)
     aURL += L'/';
 }
 
-void
-CDA_CellMLImport::instantiate()
+CDA_Model*
+CDA_CellMLImport::findRootModel()
   throw(std::exception&)
 {
-  // If this import has already been instantiated, throw an exception....
-  if (mImportedModel != NULL)
-    throw iface::cellml_api::CellMLException(L"Model is already instantiated.");
-
   // We need to get hold of the top level CellML model...
   CDA_CellMLElement *lastEl = NULL, *nextEl;
 
@@ -3657,19 +3882,52 @@ CDA_CellMLImport::instantiate()
   if (rootModel == NULL)
     throw iface::cellml_api::CellMLException(L"Cannot find root model in hierarchy.");
 
-  // Get the URL...
+  return rootModel;
+}
+
+std::wstring
+CDA_CellMLImport::absoluteURL(CDA_Model* aRootModel)
+  throw(std::exception&)
+{
   RETURN_INTO_OBJREF(url, iface::cellml_api::URI, xlinkHref());
   RETURN_INTO_WSTRING(urlStr, url->asText());
 
-  CDA_MakeURLAbsolute(rootModel, urlStr);
+  CDA_MakeURLAbsolute(aRootModel, urlStr);
+  return urlStr;
+}
+
+void
+CDA_CellMLImport::instantiate()
+  throw(std::exception&)
+{
+  // If this import has already been instantiated, throw an exception....
+  if (mImportedModel != NULL)
+    throw iface::cellml_api::CellMLException(L"Model is already instantiated.");
+
+  CDA_Model* rootModel = findRootModel();
+
+  // Get the URL...
+  std::wstring urlStr = absoluteURL(rootModel);
 
   // We now have a root model, and so we also have a loader...
   RETURN_INTO_OBJREF(dd, iface::dom::Document,
                      rootModel->mLoader->loadDocument(urlStr.c_str()));
 
+  instantiateFromDocument(rootModel, dd, urlStr);
+}
+
+void
+CDA_CellMLImport::instantiateFromDocument
+(
+ CDA_Model* aRootModel,
+ iface::dom::Document* aDocument,
+ const std::wstring& aURL
+)
+  throw(std::exception&)
+{
   try
   {
-    RETURN_INTO_OBJREF(modelEl, iface::dom::Element, dd->documentElement());
+    RETURN_INTO_OBJREF(modelEl, iface::dom::Element, aDocument->documentElement());
     if (modelEl == NULL)
       throw iface::cellml_api::CellMLException(L"Document has no document element.");
 
@@ -3683,11 +3941,11 @@ CDA_CellMLImport::instantiate()
     if (modName != L"model")
       throw iface::cellml_api::CellMLException(L"Unrecognised localName in imported model.");
 
-    ObjRef<CDA_Model> cm = already_AddRefd<CDA_Model>(new CDA_Model(rootModel->mLoader, dd, modelEl));
+    ObjRef<CDA_Model> cm = already_AddRefd<CDA_Model>(new CDA_Model(aRootModel->mLoader, aDocument, modelEl));
     RETURN_INTO_OBJREF(bu, iface::cellml_api::URI, cm->xmlBase());
     RETURN_INTO_WSTRING(base, bu->asText());
     if (base == L"")
-      bu->asText(urlStr.c_str());
+      bu->asText(aURL.c_str());
     mImportedModel = cm;
 
     // Adjust the refcounts to leave the importedModel completely dependent on
@@ -3695,6 +3953,8 @@ CDA_CellMLImport::instantiate()
     cm->mParent = this;
     // We increment our refcount(and our other ancestors') by one...
     add_ref();
+    // The imported model's elements are now part of our tree...
+    treeChanged();
 
     // As cm goes out of scope, cm's(and its ancestors', which includes us, as we
     // are cm's parent), refcount is decremented by 1. cm's refcount is now 0,
@@ -3756,6 +4016,8 @@ CDA_CellMLImport::instantiateFromText(const std::wstring& aText)
     cm->mParent = this;
     // We increment our refcount(and our other ancestors') by one...
     add_ref();
+    // The imported model's elements are now part of our tree...
+    treeChanged();
     // This will decrement cm's(and its ancestors', which includes us, as we
     // are cm's parent), refcount by 1. cm's refcount is now 0, and our/our
     // ancestors' refcounts are back to what they were before the add_ref().
@@ -4944,7 +5206,8 @@ already_AddRefd<iface::cellml_api::MapComponents>
 CDA_Connection::componentMapping()
   throw(std::exception&)
 {
-  if (CDA_CompareSerial(mCacheSerial))
+  cda_serial_t generation = changeGeneration();
+  if (mCacheSerial == generation)
   {
     mMapComponents->add_ref();
     return mMapComponents;
@@ -4970,7 +5233,7 @@ CDA_Connection::componentMapping()
       iface::cellml_api::MapComponents* rmc = mc;
       rmc->add_ref();
       mMapComponents = rmc;
-      mCacheSerial = gCDAChangeSerial;
+      mCacheSerial = generation;
       return rmc;
     }
     iface::cellml_api::MapComponents* mc =
@@ -4979,7 +5242,7 @@ CDA_Connection::componentMapping()
     {
       mc->add_ref();
       mMapComponents = mc;
-      mCacheSerial = gCDAChangeSerial;
+      mCacheSerial = generation;
       return mc;
     }
   }
@@ -7323,8 +7586,7 @@ CDA_CellMLElementSet::iterate()
 void
 CDA_CellMLElementSet::addChildToWrapper(CDA_CellMLElement* el)
 {
-  DECLARE_QUERY_INTERFACE_OBJREF(targ, el->datastore, events::EventTarget);
-  targ->removeEventListener(L"DOMSubtreeModified", &gCDAChangeListener, false);
+  el->stopBeingRoot();
   childMap.insert(std::pair<iface::dom::Element*,
                             CDA_CellMLElement*>
                   (el->datastore, el));
@@ -7333,8 +7595,7 @@ CDA_CellMLElementSet::addChildToWrapper(CDA_CellMLElement* el)
 void
 CDA_CellMLElementSet::removeChildFromWrapper(CDA_CellMLElement* el)
 {
-  DECLARE_QUERY_INTERFACE_OBJREF(targ, el->datastore, events::EventTarget);
-  targ->addEventListener(L"DOMSubtreeModified", &gCDAChangeListener, false);
+  el->becomeRoot();
   childMap.erase(el->datastore);
 }
 
@@ -7347,11 +7608,12 @@ CDA_CellMLElementSet::dumpRootCaches()
 iface::cellml_api::CellMLElement*
 CDA_CellMLElementSet::searchDescendents(iface::dom::Element* aEl)
 {
-  if (descendentSerial != gCDAChangeSerial)
+  cda_serial_t generation = mParent->changeGeneration();
+  if (descendentSerial != generation)
   {
     dumpRootCaches();
     populateDescendentCache(descendentMap);
-    descendentSerial = gCDAChangeSerial;
+    descendentSerial = generation;
   }
 
   std::map<iface::dom::Element*, CDA_CellMLElement*,XPCOMComparator>::iterator
@@ -7383,31 +7645,125 @@ CDA_CellMLElementSet::populateDescendentCache(std::map<iface::dom::Element*,CDA_
   }
 }
 
+cda_serial_t
+CDA_CellMLElementSetOuter::changeGeneration()
+{
+  // Sets which don't belong to an element (e.g. those built from component
+  // refs) can hold elements from anywhere, so any change at all is treated as
+  // a change to them.
+  if (mParent == NULL)
+    return gCDAChangeSerial;
+  return mParent->changeGeneration();
+}
+
+CDA_NamedCellMLElementSetBase::~CDA_NamedCellMLElementSetBase()
+{
+  if (mIndexListener != NULL)
+    delete mIndexListener;
+}
+
+void
+CDA_NamedCellMLElementSetBase::clearCache()
+{
+  mCacheComplete = false;
+  mCacheUsed = false;
+  mHasDuplicates = false;
+  mHighWaterMark = 0;
+  mMap.clear();
+}
+
+void
+CDA_NamedCellMLElementSetBase::childAppended()
+{
+  // The new child comes after everything counted so far, so it gets added
+  // the next time we go past the high water mark.
+  mCacheComplete = false;
+}
+
+void
+CDA_NamedCellMLElementSetBase::childRemoved(iface::dom::Element* aChild)
+{
+  if (mHasDuplicates)
+  {
+    clearCache();
+    return;
+  }
+
+  // Every element counted so far is in the map under its own name, so if it
+  // isn't there, it was never counted (it isn't in this set, or it is past the
+  // high water mark), and nothing needs to change.
+  NameMap::iterator i = mMap.find(aChild->getAttributeNS(NULL_NS, L"name"));
+  if (i == mMap.end() ||
+      CDA_objcmp(dynamic_cast<CDA_CellMLElement*>((*i).second)->datastore,
+                 aChild) != 0)
+    return;
+
+  mMap.erase(i);
+  mHighWaterMark--;
+}
+
+void
+CDA_NamedCellMLElementSetBase::childRenamed(iface::dom::Element* aChild,
+                                            const std::wstring& aOldName,
+                                            const std::wstring& aNewName)
+{
+  if (mHasDuplicates)
+  {
+    clearCache();
+    return;
+  }
+
+  NameMap::iterator i = mMap.find(aOldName);
+  if (i == mMap.end() ||
+      CDA_objcmp(dynamic_cast<CDA_CellMLElement*>((*i).second)->datastore,
+                 aChild) != 0)
+    return;
+
+  iface::cellml_api::NamedCellMLElement* nel = (*i).second;
+  mMap.erase(i);
+  // If the new name is already taken, we don't know which of the two comes
+  // first, so start again.
+  if (!mMap.insert(NameMap::value_type(aNewName, nel)).second)
+    clearCache();
+}
+
 already_AddRefd<iface::cellml_api::NamedCellMLElement>
 CDA_NamedCellMLElementSetBase::get(const std::wstring& name)
   throw(std::exception&)
 {
-  bool multipleCalls = false;
-  if (CDA_CompareSerial(mCacheSerial))
+  if (mIndexListener == NULL)
   {
-    std::map<std::wstring, iface::cellml_api::NamedCellMLElement*>::iterator i
-      = mMap.find(name);
-    if (i != mMap.end())
+    // Sets of the children of an element keep their map up to date by
+    // listening to the element. Other sets can hold elements from anywhere,
+    // so they start again whenever their tree changes.
+    if (mInner != NULL && mInner->mParent != NULL)
     {
-      (*i).second->add_ref();
-      return (*i).second;
+      clearCache();
+      mIndexListener = new CDA_NameIndexListener(this,
+                                                 mInner->mParent->datastore);
+    }
+    else
+    {
+      cda_serial_t generation = changeGeneration();
+      if (mCacheSerial != generation)
+      {
+        mCacheSerial = generation;
+        clearCache();
+      }
     }
-    if (mCacheComplete)
-      return NULL;
-    multipleCalls = true;
   }
-  else
+
+  NameMap::iterator i = mMap.find(name);
+  if (i != mMap.end())
   {
-    mCacheSerial = gCDAChangeSerial;
-    mCacheComplete = false;
-    mHighWaterMark = 0;
-    mMap.clear();
+    (*i).second->add_ref();
+    return (*i).second;
   }
+  if (mCacheComplete)
+    return NULL;
+
+  bool multipleCalls = mCacheUsed;
+  mCacheUsed = true;
 
   RETURN_INTO_OBJREF(elIt, iface::cellml_api::CellMLElementIterator, iterate());
   uint32_t count = 0;
@@ -7429,8 +7785,8 @@ CDA_NamedCellMLElementSetBase::get(const std::wstring& name)
     count++;
     if (count > mHighWaterMark)
     {
-      mMap.insert(std::pair<std::wstring,
-                            iface::cellml_api::NamedCellMLElement*>(n, nel));
+      if (!mMap.insert(NameMap::value_type(n, nel)).second)
+        mHasDuplicates = true;
       mHighWaterMark = count;
     }
 
@@ -7455,8 +7811,8 @@ CDA_NamedCellMLElementSetBase::get(const std::wstring& name)
             // If tnel == null, you are missing a NamedCellMLElement QI item on your
             // implementation.
 	    std::wstring tn = tnel->name();
-            mMap.insert(std::pair<std::wstring,
-                        iface::cellml_api::NamedCellMLElement*>(tn, tnel));
+            if (!mMap.insert(NameMap::value_type(tn, tnel)).second)
+              mHasDuplicates = true;
             mHighWaterMark = count;
           }
         }
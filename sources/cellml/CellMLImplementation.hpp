@@ -120,6 +120,8 @@ private:
 
 class CDA_CellMLElementSet;
 class CDA_CellMLElementEventAdaptor;
+class CDA_ChangeListener;
+class CDA_NameIndexListener;
 
 class CDA_CellMLElement
   : public virtual iface::cellml_api::CellMLElement,
@@ -218,6 +220,16 @@ public:
   already_AddRefd<iface::cellml_api::CellMLElement> findCellMLElementFromDOMElement
     (iface::dom::Element* aEl) throw(std::exception&);
 
+  // Returns the change generation of the tree this element is in. No two trees
+  // share a generation, and a tree gets a new one whenever it changes.
+  cda_serial_t changeGeneration();
+  // Moves the tree this element is in on to a new change generation.
+  void treeChanged();
+  // Starts or stops listening for changes to the subtree under this element,
+  // for when it becomes or stops being the root of a tree.
+  void becomeRoot();
+  void stopBeingRoot();
+
   CDA_CellMLElement* mParent;
   iface::dom::Element* datastore;
 protected:
@@ -230,6 +242,12 @@ protected:
 
   CDA_CellMLElementSet* children;
 
+  // Only non-NULL while this element is the root of a tree (or the root of an
+  // imported model, which shares its importing model's generation).
+  CDA_ChangeListener* mChangeListener;
+  // Only meaningful while this element is the root of a tree.
+  cda_serial_t mChangeGeneration;
+
   std::map<std::wstring,iface::cellml_api::UserData*> userData;
 
   friend class CDA_CellMLElementEventAdaptor;
@@ -570,6 +588,16 @@ public:
   
   void uninstantiate() throw(std::exception&);
 
+  // Implementation use only...
+  // The nearest model above this import, which relative URLs are resolved
+  // against.
+  CDA_Model* findRootModel() throw(std::exception&);
+  std::wstring absoluteURL(CDA_Model* aRootModel) throw(std::exception&);
+  void instantiateFromDocument(CDA_Model* aRootModel,
+                               iface::dom::Document* aDocument,
+                               const std::wstring& aURL)
+    throw(std::exception&);
+
   WeakReference<CDA_Model> lastIdentifierModel;
   // This number uniquely identifies the CellML import within the toplevel
   // parent model. It is computed lazily when requested and lastIdentifierModel
@@ -1204,6 +1232,9 @@ public:
   }
 
 protected:
+  // Returns the change generation of the tree the set belongs to.
+  cda_serial_t changeGeneration();
+
   CDA_CellMLElement* mParent;
   CDA_CellMLElementSet* mInner;
 
@@ -1219,24 +1250,44 @@ public:
   CDA_NamedCellMLElementSetBase(CDA_CellMLElement* aParent,
                                 CDA_CellMLElementSet* aInner)
     : CDA_CellMLElementSetOuter(aParent, aInner), mCacheSerial(0),
-      mHighWaterMark(0), mCacheComplete(false)
+      mHighWaterMark(0), mCacheComplete(false), mCacheUsed(false),
+      mHasDuplicates(false), mIndexListener(NULL)
   {
   }
 
-  virtual ~CDA_NamedCellMLElementSetBase() {};
+  virtual ~CDA_NamedCellMLElementSetBase();
 
   already_AddRefd<iface::cellml_api::NamedCellMLElement>
   get(const std::wstring& name)
     throw(std::exception&);
 
 private:
+  friend class CDA_NameIndexListener;
+
+  // Called by the index listener as the children of the element this set
+  // belongs to change, to keep the map up to date without rebuilding it.
+  void childAppended();
+  void childRemoved(iface::dom::Element* aChild);
+  void childRenamed(iface::dom::Element* aChild, const std::wstring& aOldName,
+                    const std::wstring& aNewName);
+  void clearCache();
+
+  // Only used for sets which don't have a listener, see get().
   cda_serial_t mCacheSerial;
   uint32_t mHighWaterMark;
-  bool mCacheComplete;
+  bool mCacheComplete, mCacheUsed;
+  // True if two elements in the map had the same name, in which case only
+  // the first is in the map and changes can't be applied incrementally.
+  bool mHasDuplicates;
+  CDA_NameIndexListener* mIndexListener;
   // Warning: NamedCellMLElements in the map are not add_refd. They are
-  // guaranteed to exist as long a mCacheSerial is latest, but after that, they
-  // may be dangling (so don't touch them in this case).
-  std::map<std::wstring, iface::cellml_api::NamedCellMLElement*> mMap;
+  // guaranteed to exist until the listener sees them removed from the DOM
+  // (or, for sets without a listener, as long as mCacheSerial is the tree's
+  // current change generation), but after that, they may be dangling (so
+  // don't touch them in this case).
+  typedef std::map<std::wstring, iface::cellml_api::NamedCellMLElement*>
+    NameMap;
+  NameMap mMap;
 };
 
 class CDA_CellMLComponentIteratorBase
@@ -34,6 +34,19 @@ public:
   virtual iface::dom::Document* loadDocumentFromText(const std::wstring& aText,
                                                      std::wstring& aErrorMessage)
     throw(std::exception&) = 0;
+
+  // Loads a document from aLength bytes of XML at aText, without converting
+  // it to a wide string first.
+  virtual iface::dom::Document* loadDocumentFromUTF8(const char* aText,
+                                                     size_t aLength,
+                                                     std::wstring& aErrorMessage)
+    throw(std::exception&) = 0;
+
+  // Loads a document from the XML read from the file descriptor aFD, which is
+  // left open.
+  virtual iface::dom::Document* loadDocumentFromFD(int aFD,
+                                                   std::wstring& aErrorMessage)
+    throw(std::exception&) = 0;
 };
 
 // Get a DOM Implementation. This is a C++ specific method, not part of the
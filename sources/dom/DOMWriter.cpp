@@ -7,8 +7,12 @@
 #include <string>
 #include "DOMWriter.hxx"
 
+#include <errno.h>
 #ifdef _WIN32
 #include <stdio.h>
+#include <io.h>
+#else
+#include <unistd.h>
 #endif
 
 // These tables were adapted from the Mozilla code.
@@ -31,10 +35,10 @@ L"", L"", L"", L"", L"", L"", L"", L"", L"", L"",
 L"&lt;", L"", L"&gt;"
 };
 
-std::wstring
-static TranslateEntities(const std::wstring& inp, bool isAttribute = false)
+static void
+WriteEscaped(DOMWriterOutput& out, const std::wstring& inp,
+             bool isAttribute = false)
 {
-  std::wstring o;
   const wchar_t** table;
 
   if (isAttribute)
@@ -42,20 +46,147 @@ static TranslateEntities(const std::wstring& inp, bool isAttribute = false)
   else
     table = kEntities;
 
-  uint32_t i, l = inp.length();
+  // Write out runs of characters that don't need escaping in one go...
+  const wchar_t* data = inp.data();
+  uint32_t i, l = inp.length(), runStart = 0;
   wchar_t c;
   for (i = 0; i < l; i++)
   {
-    c = inp[i];
+    c = data[i];
     if (c > 62 || (table[c][0] == 0))
-    {
-      o += c;
       continue;
+    if (i != runStart)
+      out.write(data + runStart, i - runStart);
+    out.write(table[c], wcslen(table[c]));
+    runStart = i + 1;
+  }
+  if (l != runStart)
+    out.write(data + runStart, l - runStart);
+}
+
+DOMWriterUTF8Output::DOMWriterUTF8Output(Sink aSink, void* aClosure)
+  : mSink(aSink), mClosure(aClosure), mFD(-1), mFailed(false),
+    mHighSurrogate(0), mUsed(0)
+{
+}
+
+DOMWriterUTF8Output::DOMWriterUTF8Output(int aFD)
+  : mSink(WriteToFD), mClosure(this), mFD(aFD), mFailed(false),
+    mHighSurrogate(0), mUsed(0)
+{
+}
+
+DOMWriterUTF8Output::~DOMWriterUTF8Output()
+{
+  // A high surrogate with nothing after it can't be encoded.
+  if (mHighSurrogate != 0)
+    appendCodePoint(0xFFFD);
+  flush();
+}
+
+bool
+DOMWriterUTF8Output::WriteToFD(void* aClosure, const char* aData,
+                               size_t aLength)
+{
+  DOMWriterUTF8Output* self = static_cast<DOMWriterUTF8Output*>(aClosure);
+  while (aLength != 0)
+  {
+#ifdef _WIN32
+    int ret = _write(self->mFD, aData, aLength);
+#else
+    ssize_t ret = ::write(self->mFD, aData, aLength);
+#endif
+    if (ret < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
     }
-    o += table[c];
+    aData += ret;
+    aLength -= ret;
   }
+  return true;
+}
+
+bool
+DOMWriterUTF8Output::flush()
+{
+  if (mUsed != 0 && !mFailed && !mSink(mClosure, mBuffer, mUsed))
+    mFailed = true;
+  mUsed = 0;
+  return !mFailed;
+}
 
-  return o;
+void
+DOMWriterUTF8Output::appendCodePoint(uint32_t aCodePoint)
+{
+  if (mUsed + 4 > sizeof(mBuffer))
+    flush();
+
+  if (aCodePoint < 0x80)
+    mBuffer[mUsed++] = aCodePoint;
+  else if (aCodePoint < 0x800)
+  {
+    mBuffer[mUsed++] = 0xC0 | (aCodePoint >> 6);
+    mBuffer[mUsed++] = 0x80 | (aCodePoint & 0x3F);
+  }
+  else if (aCodePoint < 0x10000)
+  {
+    mBuffer[mUsed++] = 0xE0 | (aCodePoint >> 12);
+    mBuffer[mUsed++] = 0x80 | ((aCodePoint >> 6) & 0x3F);
+    mBuffer[mUsed++] = 0x80 | (aCodePoint & 0x3F);
+  }
+  else
+  {
+    mBuffer[mUsed++] = 0xF0 | (aCodePoint >> 18);
+    mBuffer[mUsed++] = 0x80 | ((aCodePoint >> 12) & 0x3F);
+    mBuffer[mUsed++] = 0x80 | ((aCodePoint >> 6) & 0x3F);
+    mBuffer[mUsed++] = 0x80 | (aCodePoint & 0x3F);
+  }
+}
+
+void
+DOMWriterUTF8Output::write(const wchar_t* aData, size_t aLength)
+{
+  if (mFailed)
+    return;
+
+  for (const wchar_t* end = aData + aLength; aData != end; aData++)
+  {
+    uint32_t c = static_cast<uint32_t>(*aData);
+
+    // Plain ASCII is by far the most common case...
+    if (c < 0x80 && mHighSurrogate == 0 && mUsed < sizeof(mBuffer))
+    {
+      mBuffer[mUsed++] = c;
+      continue;
+    }
+
+    // Where wchar_t is UTF-16, pairs of surrogates make up one code point,
+    // and a pair can be split between writes.
+    if (c >= 0xDC00 && c <= 0xDFFF && mHighSurrogate != 0)
+    {
+      c = 0x10000 + ((mHighSurrogate - 0xD800) << 10) + (c - 0xDC00);
+      mHighSurrogate = 0;
+    }
+    else
+    {
+      if (mHighSurrogate != 0)
+      {
+        appendCodePoint(0xFFFD);
+        mHighSurrogate = 0;
+      }
+      if (c >= 0xD800 && c <= 0xDBFF)
+      {
+        mHighSurrogate = c;
+        continue;
+      }
+      if ((c >= 0xDC00 && c <= 0xDFFF) || c > 0x10FFFF)
+        c = 0xFFFD;
+    }
+
+    appendCodePoint(c);
+  }
 }
 
 /* CDA_EXPORT_PRE CDA_EXPORT_POST */
@@ -66,6 +197,14 @@ DOMWriter::DOMWriter()
 void
 DOMWriter::writeNode(DOMNamespaceContext* dnc, iface::dom::Node* n, std::wstring& appendTo)
   throw(std::exception&)
+{
+  DOMWriterStringOutput out(appendTo);
+  writeNode(dnc, n, out);
+}
+
+void
+DOMWriter::writeNode(DOMNamespaceContext* dnc, iface::dom::Node* n, DOMWriterOutput& out)
+  throw(std::exception&)
 {
   uint16_t nt = n->nodeType();
 
@@ -75,7 +214,7 @@ DOMWriter::writeNode(DOMNamespaceContext* dnc, iface::dom::Node* n, std::wstring
     DECLARE_QUERY_INTERFACE_OBJREF(t, n, dom::ntn); \
     if (t == NULL) \
       throw iface::dom::DOMException(iface::dom::INVALID_STATE_ERR);    \
-    write##ntn(dnc, t, appendTo); \
+    write##ntn(dnc, t, out); \
   } \
   break;
 
@@ -98,7 +237,7 @@ DOMWriter::writeNode(DOMNamespaceContext* dnc, iface::dom::Node* n, std::wstring
 
 void
 DOMWriter::writeElement(DOMNamespaceContext* parentContext,
-                        iface::dom::Element* el, std::wstring& appendTo)
+                        iface::dom::Element* el, DOMWriterOutput& out)
   throw(std::exception&)
 {
   DOMNamespaceContext elementContext(parentContext);
@@ -156,7 +295,7 @@ DOMWriter::writeElement(DOMNamespaceContext* parentContext,
   }
 
   // Start the tag...
-  appendTo += L"<";
+  out.write(L"<");
   std::wstring qname;
   qname += elpr;
   if (elpr != L"")
@@ -166,7 +305,7 @@ DOMWriter::writeElement(DOMNamespaceContext* parentContext,
     ln = el->nodeName();
   qname += ln;
 
-  appendTo += qname;
+  out.write(qname);
 
   for (i = 0; i < l; i++)
   {
@@ -253,7 +392,7 @@ DOMWriter::writeElement(DOMNamespaceContext* parentContext,
   }
 
   elementContext.resolveOrInventPrefixes();
-  elementContext.writeXMLNS(appendTo);
+  elementContext.writeXMLNS(out);
 
   // Now once more through the attributes...
   for (i = 0; i < l; i++)
@@ -280,7 +419,7 @@ DOMWriter::writeElement(DOMNamespaceContext* parentContext,
       continue;
 
     // Write out this attribute...
-    writeAttr(&elementContext, at, appendTo);
+    writeAttr(&elementContext, at, out);
   }
 
   RETURN_INTO_OBJREF(elcnl, iface::dom::NodeList, el->childNodes());  
@@ -288,11 +427,11 @@ DOMWriter::writeElement(DOMNamespaceContext* parentContext,
 
   if (l == 0)
   {
-    appendTo += L"/>";
+    out.write(L"/>");
     return;
   }
 
-  appendTo += L">";
+  out.write(L">");
 
   // This time, we write everything except the attributes...
   for (i = 0; i < l; i++)
@@ -308,18 +447,20 @@ DOMWriter::writeElement(DOMNamespaceContext* parentContext,
     //if (at != NULL)
     //  continue;
 
-    writeNode(&elementContext, n, appendTo);
+    writeNode(&elementContext, n, out);
   }
 
-  appendTo += L"</" + qname + L">";
+  out.write(L"</");
+  out.write(qname);
+  out.write(L">");
 }
 
 void
-DOMWriter::writeAttr(DOMNamespaceContext* dnc, iface::dom::Attr* at, std::wstring& appendTo)
+DOMWriter::writeAttr(DOMNamespaceContext* dnc, iface::dom::Attr* at, DOMWriterOutput& out)
   throw(std::exception&)
 {
   // Always put a space first...
-  appendTo += L" ";
+  out.write(L" ");
   
   // Next, we might need a prefix.
   RETURN_INTO_WSTRING(atpr, at->prefix());
@@ -342,42 +483,42 @@ DOMWriter::writeAttr(DOMNamespaceContext* dnc, iface::dom::Attr* at, std::wstrin
 
   if (atpr != L"")
   {
-    appendTo += atpr;
-    appendTo += L":";
+    out.write(atpr);
+    out.write(L":");
   }
   std::wstring ln = at->localName();
   if (ln == L"")
     ln = at->nodeName();
 
-  appendTo += ln;
+  out.write(ln);
 
-  appendTo += L"=\"";
+  out.write(L"=\"");
   std::wstring value = at->value();
-  appendTo += TranslateEntities(value, true);
-  appendTo += L"\"";
+  WriteEscaped(out, value, true);
+  out.write(L"\"");
 }
 
 void
 DOMWriter::writeText(DOMNamespaceContext* dnc, iface::dom::Text* txt,
-                     std::wstring& appendTo)
+                     DOMWriterOutput& out)
   throw(std::exception&)
 {
-  appendTo += TranslateEntities(txt->data());
+  WriteEscaped(out, txt->data());
 }
 
 void
 DOMWriter::writeCDATASection
-(DOMNamespaceContext* dnc, iface::dom::CDATASection* cds, std::wstring& appendTo)
+(DOMNamespaceContext* dnc, iface::dom::CDATASection* cds, DOMWriterOutput& out)
   throw(std::exception&)
 {
-  appendTo += L"<![CDATA[";
-  appendTo += cds->data();
-  appendTo += L"]]>";
+  out.write(L"<![CDATA[");
+  out.write(cds->data());
+  out.write(L"]]>");
 }
 
 void
 DOMWriter::writeEntity(DOMNamespaceContext* dnc, iface::dom::Entity* er,
-                       std::wstring& appendTo)
+                       DOMWriterOutput& out)
   throw(std::exception&)
 {
 }
@@ -385,7 +526,7 @@ DOMWriter::writeEntity(DOMNamespaceContext* dnc, iface::dom::Entity* er,
 void
 DOMWriter::writeEntityReference(DOMNamespaceContext* dnc,
                                 iface::dom::EntityReference* er,
-                                std::wstring& appendTo)
+                                DOMWriterOutput& out)
   throw(std::exception&)
 {
 }
@@ -393,39 +534,48 @@ DOMWriter::writeEntityReference(DOMNamespaceContext* dnc,
 void
 DOMWriter::writeProcessingInstruction(DOMNamespaceContext* dnc,
                                       iface::dom::ProcessingInstruction* proci,
-                                      std::wstring& appendTo)
+                                      DOMWriterOutput& out)
   throw(std::exception&)
 {
-  appendTo += L"<?";
-  appendTo += proci->target();
+  out.write(L"<?");
+  out.write(proci->target());
 
   std::wstring data = proci->data();
   if (data.size())
   {
-    appendTo += L" ";
-    appendTo += data;
+    out.write(L" ");
+    out.write(data);
   }
 
-  appendTo += L"?>";
+  out.write(L"?>");
 }
 
 void
 DOMWriter::writeComment(DOMNamespaceContext* dnc, iface::dom::Comment* comment,
-                        std::wstring& appendTo)
+                        DOMWriterOutput& out)
   throw(std::exception&)
 {
-  appendTo += L"<!--";
-  appendTo += comment->data();
-  appendTo += L"-->";
+  out.write(L"<!--");
+  out.write(comment->data());
+  out.write(L"-->");
 }
 
 void
 DOMWriter::writeDocument(DOMNamespaceContext* dnc,
                          iface::dom::Document* doc, std::wstring& appendTo)
   throw(std::exception&)
+{
+  DOMWriterStringOutput out(appendTo);
+  writeDocument(dnc, doc, out);
+}
+
+void
+DOMWriter::writeDocument(DOMNamespaceContext* dnc,
+                         iface::dom::Document* doc, DOMWriterOutput& out)
+  throw(std::exception&)
 {
   // Firstly write the header...
-  appendTo += L"<?xml version=\"1.0\"?>\n";
+  out.write(L"<?xml version=\"1.0\"?>\n");
 
   RETURN_INTO_OBJREF(elnl, iface::dom::NodeList, doc->childNodes());
   uint32_t l = elnl->length(), i;
@@ -436,14 +586,14 @@ DOMWriter::writeDocument(DOMNamespaceContext* dnc,
     if (n == NULL)
       break;
     
-    writeNode(dnc, n, appendTo);
+    writeNode(dnc, n, out);
   }
 }
 
 void
 DOMWriter::writeDocumentType(DOMNamespaceContext* dnc,
                              iface::dom::DocumentType* dt,
-                             std::wstring& appendTo)
+                             DOMWriterOutput& out)
   throw(std::exception&)
 {
 }
@@ -451,7 +601,7 @@ DOMWriter::writeDocumentType(DOMNamespaceContext* dnc,
 void
 DOMWriter::writeDocumentFragment(DOMNamespaceContext* dnc,
                                  iface::dom::DocumentFragment* df,
-                                 std::wstring& appendTo)
+                                 DOMWriterOutput& out)
   throw(std::exception)
 {
   RETURN_INTO_OBJREF(elnl, iface::dom::NodeList, df->childNodes());
@@ -463,13 +613,13 @@ DOMWriter::writeDocumentFragment(DOMNamespaceContext* dnc,
     if (n == NULL)
       break;
     
-    writeNode(dnc, n, appendTo);
+    writeNode(dnc, n, out);
   }
 }
 
 void
 DOMWriter::writeNotation(DOMNamespaceContext* dnc,
-                         iface::dom::Notation* nt, std::wstring& appendTo)
+                         iface::dom::Notation* nt, DOMWriterOutput& out)
   throw(std::exception)
 {
 }
@@ -547,6 +697,11 @@ DOMNamespaceContext::possiblyInventPrefix(const std::wstring& prefix)
 void
 DOMNamespaceContext::resolveOrInventPrefixes()
 {
+  // Most elements are in namespaces that already have a prefix, so don't pay
+  // for the locale change unless there is something to invent.
+  if (NamespacesNeedingPrefixes.empty())
+    return;
+
   // Scoped locale change.
   CNumericLocale locobj;
 
@@ -594,21 +749,27 @@ DOMNamespaceContext::resolveOrInventPrefixes()
 }
 
 void
-DOMNamespaceContext::writeXMLNS(std::wstring& appendTo)
+DOMNamespaceContext::writeXMLNS(DOMWriterOutput& out)
 {
   std::map<std::wstring,std::wstring>::iterator i;
 
   // If we have changed our default prefix, set that here...
   if (mOverrideDefaultNamespace)
-    appendTo += L" xmlns=\"" + TranslateEntities(defaultNamespace, true) +
-      L"\"";
+  {
+    out.write(L" xmlns=\"");
+    WriteEscaped(out, defaultNamespace, true);
+    out.write(L"\"");
+  }
 
   for (i = URIfromPrefix.begin(); i != URIfromPrefix.end(); i++)
   {
     const std::wstring& prefix = (*i).first;
     if (prefix[0] == L'x' && prefix[1] == L'm' && prefix[2] == L'l')
       continue;
-    appendTo += L" xmlns:" + prefix + L"=\"" +
-      TranslateEntities((*i).second, true) + L"\"";
+    out.write(L" xmlns:");
+    out.write(prefix);
+    out.write(L"=\"");
+    WriteEscaped(out, (*i).second, true);
+    out.write(L"\"");
   }
 }
@@ -3,6 +3,7 @@
 #include "IfaceDOM_APISPEC.hxx"
 #include <map>
 #include <string>
+#include <wchar.h>
 #include <list>
 
 class DOMNamespaceContext;
@@ -15,6 +16,92 @@ class DOMNamespaceContext;
 #define DOMWRITER_PUBLIC_POST CDA_IMPORT_POST
 #endif
 
+// Somewhere for DOMWriter to put what it writes.
+class DOMWriterOutput
+{
+public:
+  virtual ~DOMWriterOutput() {}
+
+  virtual void write(const wchar_t* aData, size_t aLength) = 0;
+
+  void
+  write(const wchar_t* aData)
+  {
+    write(aData, wcslen(aData));
+  }
+
+  void
+  write(const std::wstring& aData)
+  {
+    write(aData.data(), aData.length());
+  }
+};
+
+// Appends everything written to a string.
+class DOMWriterStringOutput
+  : public DOMWriterOutput
+{
+public:
+  DOMWriterStringOutput(std::wstring& aAppendTo)
+    : mAppendTo(aAppendTo)
+  {
+  }
+
+  using DOMWriterOutput::write;
+
+  void
+  write(const wchar_t* aData, size_t aLength)
+  {
+    mAppendTo.append(aData, aLength);
+  }
+
+private:
+  std::wstring& mAppendTo;
+};
+
+/*
+ * Encodes everything written as UTF-8, and passes it on to a sink through a
+ * fixed size buffer, so the serialised document never has to be in memory all
+ * at once. Anything still buffered is passed on when the output is destroyed.
+ */
+DOMWRITER_PUBLIC_PRE
+class DOMWRITER_PUBLIC_POST DOMWriterUTF8Output
+  : public DOMWriterOutput
+{
+public:
+  // Returns false if the data couldn't be written. Nothing more is passed to
+  // the sink after that.
+  typedef bool (*Sink)(void* aClosure, const char* aData, size_t aLength);
+
+  DOMWRITER_PUBLIC_PRE DOMWriterUTF8Output(Sink aSink, void* aClosure)
+    DOMWRITER_PUBLIC_POST;
+  // Writes to a file descriptor, which is left open afterwards.
+  DOMWRITER_PUBLIC_PRE DOMWriterUTF8Output(int aFD) DOMWRITER_PUBLIC_POST;
+  DOMWRITER_PUBLIC_PRE ~DOMWriterUTF8Output() DOMWRITER_PUBLIC_POST;
+
+  using DOMWriterOutput::write;
+
+  DOMWRITER_PUBLIC_PRE void write(const wchar_t* aData, size_t aLength)
+    DOMWRITER_PUBLIC_POST;
+
+  // Passes on anything buffered. Returns false if the sink has failed.
+  DOMWRITER_PUBLIC_PRE bool flush() DOMWRITER_PUBLIC_POST;
+
+  bool failed() const { return mFailed; }
+
+private:
+  static bool WriteToFD(void* aClosure, const char* aData, size_t aLength);
+  void appendCodePoint(uint32_t aCodePoint);
+
+  Sink mSink;
+  void* mClosure;
+  int mFD;
+  bool mFailed;
+  uint32_t mHighSurrogate;
+  size_t mUsed;
+  char mBuffer[16384];
+};
+
 DOMWRITER_PUBLIC_PRE
 class DOMWRITER_PUBLIC_POST DOMWriter
 {
@@ -24,35 +111,41 @@ public:
   DOMWRITER_PUBLIC_PRE void writeNode(DOMNamespaceContext* dnc,
                  iface::dom::Node* n, std::wstring& appendTo)
     throw(std::exception&) DOMWRITER_PUBLIC_POST;
+  DOMWRITER_PUBLIC_PRE void writeNode(DOMNamespaceContext* dnc,
+                 iface::dom::Node* n, DOMWriterOutput& out)
+    throw(std::exception&) DOMWRITER_PUBLIC_POST;
 
   void writeElement(DOMNamespaceContext* dnc,
-                    iface::dom::Element* el, std::wstring& appendTo)
+                    iface::dom::Element* el, DOMWriterOutput& out)
     throw(std::exception&);
-  void writeAttr(DOMNamespaceContext* dnc, iface::dom::Attr* at, std::wstring& appendTo)
+  void writeAttr(DOMNamespaceContext* dnc, iface::dom::Attr* at, DOMWriterOutput& out)
     throw(std::exception&);
-  void writeText(DOMNamespaceContext* dnc, iface::dom::Text* txt, std::wstring& appendTo)
+  void writeText(DOMNamespaceContext* dnc, iface::dom::Text* txt, DOMWriterOutput& out)
     throw(std::exception&);
-  void writeCDATASection(DOMNamespaceContext* dnc, iface::dom::CDATASection* cds, std::wstring& appendTo)
+  void writeCDATASection(DOMNamespaceContext* dnc, iface::dom::CDATASection* cds, DOMWriterOutput& out)
     throw(std::exception&);
-  void writeEntity(DOMNamespaceContext* dnc, iface::dom::Entity* er, std::wstring& appendTo)
+  void writeEntity(DOMNamespaceContext* dnc, iface::dom::Entity* er, DOMWriterOutput& out)
     throw(std::exception&);
   void writeEntityReference(DOMNamespaceContext* dnc, iface::dom::EntityReference* er,
-                            std::wstring& appendTo)
+                            DOMWriterOutput& out)
     throw(std::exception&);
   void writeProcessingInstruction(DOMNamespaceContext* dnc, iface::dom::ProcessingInstruction* pi,
-                                  std::wstring& appendTo)
+                                  DOMWriterOutput& out)
     throw(std::exception&);
   void writeComment(DOMNamespaceContext* dnc, iface::dom::Comment* comment,
-                    std::wstring& appendTo)
+                    DOMWriterOutput& out)
     throw(std::exception&);
   DOMWRITER_PUBLIC_PRE void writeDocument(DOMNamespaceContext* dnc,
 					  iface::dom::Document* doc, std::wstring& appendTo)
     throw(std::exception&) DOMWRITER_PUBLIC_POST;
-  void writeDocumentType(DOMNamespaceContext* dnc, iface::dom::DocumentType* dt, std::wstring& appendTo)
+  DOMWRITER_PUBLIC_PRE void writeDocument(DOMNamespaceContext* dnc,
+					  iface::dom::Document* doc, DOMWriterOutput& out)
+    throw(std::exception&) DOMWRITER_PUBLIC_POST;
+  void writeDocumentType(DOMNamespaceContext* dnc, iface::dom::DocumentType* dt, DOMWriterOutput& out)
     throw(std::exception&);
-  void writeDocumentFragment(DOMNamespaceContext* dnc, iface::dom::DocumentFragment* df, std::wstring& appendTo)
+  void writeDocumentFragment(DOMNamespaceContext* dnc, iface::dom::DocumentFragment* df, DOMWriterOutput& out)
     throw(std::exception);
-  void writeNotation(DOMNamespaceContext* dnc, iface::dom::Notation* nt, std::wstring& appendTo)
+  void writeNotation(DOMNamespaceContext* dnc, iface::dom::Notation* nt, DOMWriterOutput& out)
     throw(std::exception);
 };
 
@@ -70,7 +163,7 @@ public:
   void possiblyInventPrefix(const std::wstring& prefix);
   void resolveOrInventPrefixes();
 
-  void writeXMLNS(std::wstring& appendTo);
+  void writeXMLNS(DOMWriterOutput& out);
 private:
   DOMNamespaceContext* mParent;
   bool mOverrideDefaultNamespace;
@@ -6,6 +6,7 @@
 #include "cda_compiler_support.h"
 #include "DOMImplementation.hpp"
 #include <stdexcept>
+#include <new>
 
 /*
  * This next bit is a very pragmatic way of deciding when to throw away the
@@ -36,6 +37,220 @@ static bool CDA_DOMCompareSerial(cda_serial_t aSerial)
   return gCDADOMChangeSerial == aSerial;
 }
 
+// Names common enough in CellML documents to be worth sharing. Anything not
+// here is still fine, it just gets its own copy.
+static const wchar_t* const kCommonDOMNames[] =
+{
+  L"",
+  // Namespaces.
+  L"http://www.cellml.org/cellml/1.0#", L"http://www.cellml.org/cellml/1.1#",
+  L"http://www.cellml.org/metadata/1.0#", L"http://www.w3.org/1998/Math/MathML",
+  L"http://www.w3.org/1999/02/22-rdf-syntax-ns#",
+  L"http://purl.org/dc/elements/1.1/", L"http://purl.org/dc/terms/",
+  L"http://www.w3.org/2001/vcard-rdf/3.0#", L"http://www.w3.org/1999/xlink",
+  L"http://www.w3.org/2000/xmlns/", L"http://www.w3.org/XML/1998/namespace",
+  L"http://www.cellml.org/tmp-documentation",
+  // Node names of nodes that aren't elements or attributes.
+  L"#text", L"#comment", L"#cdata-section", L"#document",
+  L"#document-fragment",
+  // CellML elements and attributes.
+  L"model", L"component", L"variable", L"units", L"unit", L"connection",
+  L"map_components", L"map_variables", L"group", L"relationship_ref",
+  L"component_ref", L"import", L"reaction", L"variable_ref", L"role",
+  L"documentation", L"text", L"name", L"initial_value", L"public_interface",
+  L"private_interface", L"prefix", L"multiplier", L"exponent", L"offset",
+  L"base_units", L"component_1", L"component_2", L"variable_1",
+  L"variable_2", L"relationship", L"namespace", L"units_ref", L"reversible",
+  L"direction", L"stoichiometry", L"delta_variable", L"href", L"id",
+  L"cmeta:id", L"xlink:href", L"cellml:units", L"xmlns", L"xmlns:cellml",
+  L"xmlns:cmeta", L"xmlns:xlink", L"xmlns:rdf", L"xmlns:dc",
+  L"xmlns:dcterms", L"xmlns:vCard", L"xmlns:mathml", L"cellml", L"cmeta",
+  L"xlink", L"mathml",
+  // MathML elements and attributes.
+  L"math", L"apply", L"ci", L"cn", L"eq", L"neq", L"gt", L"lt", L"geq",
+  L"leq", L"plus", L"minus", L"times", L"divide", L"power", L"root", L"abs",
+  L"exp", L"ln", L"log", L"floor", L"ceiling", L"factorial", L"rem", L"and",
+  L"or", L"xor", L"not", L"diff", L"bvar", L"degree", L"logbase",
+  L"piecewise", L"piece", L"otherwise", L"sin", L"cos", L"tan", L"sec",
+  L"csc", L"cot", L"sinh", L"cosh", L"tanh", L"sech", L"csch", L"coth",
+  L"arcsin", L"arccos", L"arctan", L"arcsec", L"arccsc", L"arccot",
+  L"arcsinh", L"arccosh", L"arctanh", L"arcsech", L"arccsch", L"arccoth",
+  L"min", L"max", L"sep", L"true", L"false", L"pi", L"exponentiale",
+  L"infinity", L"notanumber", L"semantics", L"annotation", L"annotation-xml",
+  L"csymbol", L"type", L"definitionURL", L"encoding", L"e-notation",
+  L"integer", L"real",
+  // RDF metadata.
+  L"RDF", L"Description", L"about", L"resource", L"parseType", L"nodeID",
+  L"datatype", L"li", L"Seq", L"Bag", L"Alt", L"value", L"rdf:RDF",
+  L"rdf:Description", L"rdf:about", L"rdf:resource", L"rdf:parseType",
+  L"rdf:nodeID", L"rdf:datatype", L"rdf:li", L"rdf:Seq", L"rdf:Bag",
+  L"rdf:value", L"creator", L"contributor", L"publisher", L"title",
+  L"date", L"created", L"modified", L"W3CDTF", L"N", L"Family", L"Given",
+  L"Other", L"ORG", L"Orgname", L"Orgunit", L"EMAIL", L"dc:creator",
+  L"dc:contributor", L"dc:publisher", L"dc:title", L"dcterms:created",
+  L"dcterms:modified", L"dcterms:W3CDTF", L"vCard:N", L"vCard:Family",
+  L"vCard:Given", L"vCard:Other", L"vCard:ORG", L"vCard:Orgname",
+  L"vCard:Orgunit", L"vCard:EMAIL"
+};
+
+// The table, sorted so it can be searched without a lock. It is built once,
+// and never changes after that.
+const std::wstring* CDA_DOMName::sCommonBegin;
+const std::wstring* CDA_DOMName::sCommonEnd;
+
+void
+CDA_DOMName::EnsureCommon()
+{
+  if (sCommonBegin != NULL)
+    return;
+
+  size_t n = sizeof(kCommonDOMNames) / sizeof(kCommonDOMNames[0]);
+  std::wstring* names = new std::wstring[n];
+  std::copy(kCommonDOMNames, kCommonDOMNames + n, names);
+  std::sort(names, names + n);
+  sCommonEnd = std::unique(names, names + n);
+  sCommonBegin = names;
+}
+
+static ThreadLocal<CDA_NodeArena*>* sCurrentNodeArena;
+
+// Sets up the table while the library is loaded, before other threads can be
+// making nodes.
+class DOMNamesInitialiser
+{
+public:
+  DOMNamesInitialiser()
+  {
+    CDA_DOMName::EnsureCommon();
+    sCurrentNodeArena = new ThreadLocal<CDA_NodeArena*>(1, NULL, NULL);
+  }
+};
+static DOMNamesInitialiser sDOMNamesInitialiser;
+
+const std::wstring*
+CDA_DOMName::Make(const std::wstring& aName)
+{
+  EnsureCommon();
+  const std::wstring* i = std::lower_bound(sCommonBegin, sCommonEnd, aName);
+  if (i != sCommonEnd && *i == aName)
+    return i;
+  return new std::wstring(aName);
+}
+
+const std::wstring*
+CDA_DOMName::Empty()
+{
+  EnsureCommon();
+  // "" sorts first.
+  return sCommonBegin;
+}
+
+// Every node is preceded by the chunk it is in, or NULL if it came from the
+// heap. The double keeps the node after it aligned.
+union CDA_NodeHeader
+{
+  CDA_NodeArenaChunk* mChunk;
+  double mAlign;
+};
+
+// The start of each chunk. It counts the nodes in the chunk, plus one while
+// the arena is still allocating from it.
+struct CDA_NodeArenaChunk
+{
+  CDA_RefCount mUsers;
+};
+
+static const size_t kNodeArenaChunkSize = 65536;
+// The chunk header, rounded up so the nodes after it stay aligned.
+static const size_t kNodeArenaChunkHeaderSize =
+  (sizeof(CDA_NodeArenaChunk) + sizeof(CDA_NodeHeader) - 1) /
+  sizeof(CDA_NodeHeader) * sizeof(CDA_NodeHeader);
+
+CDA_NodeArena::CDA_NodeArena()
+  : mChunk(NULL), mFree(NULL), mFreeLength(0)
+{
+}
+
+CDA_NodeArena::~CDA_NodeArena()
+{
+  if (mChunk != NULL)
+    release(mChunk);
+}
+
+void*
+CDA_NodeArena::allocate(size_t aSize)
+{
+  // The node and its header, rounded up so the next node stays aligned.
+  aSize = (aSize + sizeof(CDA_NodeHeader) - 1) / sizeof(CDA_NodeHeader) *
+    sizeof(CDA_NodeHeader) + sizeof(CDA_NodeHeader);
+  if (aSize > mFreeLength)
+  {
+    size_t chunkSize = std::max(aSize + kNodeArenaChunkHeaderSize,
+                                kNodeArenaChunkSize);
+    char* chunk = new char[chunkSize];
+    if (mChunk != NULL)
+      release(mChunk);
+    mChunk = new (chunk) CDA_NodeArenaChunk();
+    mFree = chunk + kNodeArenaChunkHeaderSize;
+    mFreeLength = chunkSize - kNodeArenaChunkHeaderSize;
+  }
+
+  CDA_NodeHeader* h = reinterpret_cast<CDA_NodeHeader*>(mFree);
+  mFree += aSize;
+  mFreeLength -= aSize;
+  ++mChunk->mUsers;
+  h->mChunk = mChunk;
+  return h + 1;
+}
+
+void
+CDA_NodeArena::release(CDA_NodeArenaChunk* aChunk)
+{
+  if (--aChunk->mUsers)
+    return;
+  aChunk->~CDA_NodeArenaChunk();
+  delete [] reinterpret_cast<char*>(aChunk);
+}
+
+CDA_NodeArena*
+CDA_NodeArena::Current()
+{
+  if (sCurrentNodeArena == NULL)
+    return NULL;
+  return static_cast<CDA_NodeArena*&>(*sCurrentNodeArena);
+}
+
+void
+CDA_NodeArena::SetCurrent(CDA_NodeArena* aArena)
+{
+  *sCurrentNodeArena = aArena;
+}
+
+void*
+CDA_Node::operator new(size_t aSize)
+{
+  CDA_NodeArena* arena = CDA_NodeArena::Current();
+  if (arena != NULL)
+    return arena->allocate(aSize);
+
+  CDA_NodeHeader* h = reinterpret_cast<CDA_NodeHeader*>
+    (::operator new(aSize + sizeof(CDA_NodeHeader)));
+  h->mChunk = NULL;
+  return h + 1;
+}
+
+void
+CDA_Node::operator delete(void* aNode)
+{
+  if (aNode == NULL)
+    return;
+  CDA_NodeHeader* h = reinterpret_cast<CDA_NodeHeader*>(aNode) - 1;
+  if (h->mChunk == NULL)
+    ::operator delete(h);
+  else
+    CDA_NodeArena::release(h->mChunk);
+}
+
 CDA_DOMImplementation* CDA_DOMImplementation::sDOMImplementation = 
   new CDA_DOMImplementation();
 
@@ -1204,7 +1419,7 @@ CDA_NodeListDFSSearch::length()
 }
 
 CDA_NamedNodeMap::CDA_NamedNodeMap(CDA_Element* aElement)
-  : mElement(aElement), hintSerial(0)
+  : mElement(aElement)
 {
   mElement->add_ref();
 }
@@ -1218,7 +1433,7 @@ already_AddRefd<iface::dom::Node>
 CDA_NamedNodeMap::getNamedItem(const std::wstring& name)
   throw(std::exception&)
 {
-  std::map<CDA_Element::LocalName, CDA_Attr*>::iterator i =
+  CDA_SmallMap<CDA_Element::LocalName, CDA_Attr*>::iterator i =
     mElement->attributeMap.find(CDA_Element::LocalName(name));
   if (i == mElement->attributeMap.end())
     return NULL;
@@ -1240,7 +1455,7 @@ CDA_NamedNodeMap::removeNamedItem(const std::wstring& name)
   throw(std::exception&)
 {
   // std::pair<std::wstring,std::wstring> p(L"", name);
-  std::map<CDA_Element::LocalName, CDA_Attr*>::iterator
+  CDA_SmallMap<CDA_Element::LocalName, CDA_Attr*>::iterator
     i = mElement->attributeMap.find(CDA_Element::LocalName(name));
 
   if (i == mElement->attributeMap.end())
@@ -1253,7 +1468,7 @@ CDA_NamedNodeMap::removeNamedItem(const std::wstring& name)
   CDA_Element::LocalName ln((*i).first);
 
   mElement->attributeMap.erase(i);
-  std::map<CDA_Element::QualifiedName, CDA_Attr*>::iterator j =
+  CDA_SmallMap<CDA_Element::QualifiedName, CDA_Attr*>::iterator j =
     mElement->attributeMapNS.find(CDA_Element::QualifiedName
                                   (at->mNamespaceURI,
                                    at->mLocalName));
@@ -1282,32 +1497,13 @@ already_AddRefd<iface::dom::Node>
 CDA_NamedNodeMap::item(uint32_t index)
   throw(std::exception&)
 {
-  uint32_t saveIndex =  index;
-
-  std::map<CDA_Element::QualifiedName, CDA_Attr*>::iterator i =
-    mElement->attributeMapNS.begin();
-
-  // Can we use a hint saved from last time?
-  if (CDA_DOMCompareSerial(hintSerial) && hintIndex <= index)
-  {
-    i = hintIterator;
-    index -= hintIndex;
-  }
-
-  for (; i != mElement->attributeMapNS.end(); i++)
-  {
-    if (index == 0)
-    {
-      hintSerial = gCDADOMChangeSerial;
-      hintIterator = i;
-      hintIndex = saveIndex;
+  // The attributes are in a vector, so we can go straight to the one we want.
+  if (index >= mElement->attributeMapNS.size())
+    return NULL;
 
-      (*i).second->add_ref();
-      return (*i).second;
-    }
-    index--;
-  }
-  return NULL;
+  CDA_Attr* at = (*(mElement->attributeMapNS.begin() + index)).second;
+  at->add_ref();
+  return at;
 }
 
 uint32_t
@@ -1322,7 +1518,7 @@ CDA_NamedNodeMap::getNamedItemNS(const std::wstring& namespaceURI,
                                  const std::wstring& localName)
   throw(std::exception&)
 {
-  std::map<CDA_Element::QualifiedName, CDA_Attr*>::iterator i =
+  CDA_SmallMap<CDA_Element::QualifiedName, CDA_Attr*>::iterator i =
     mElement->attributeMapNS.find(CDA_Element::QualifiedName
                                   (namespaceURI, localName));
   if (i == mElement->attributeMapNS.end())
@@ -1345,7 +1541,7 @@ CDA_NamedNodeMap::removeNamedItemNS(const std::wstring& namespaceURI,
                                     const std::wstring& localName)
   throw(std::exception&)
 {
-  std::map<CDA_Element::QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<CDA_Element::QualifiedName, CDA_Attr*>::iterator
     i = mElement->attributeMapNS.find
     (CDA_Element::QualifiedName(namespaceURI, localName));
 
@@ -1356,7 +1552,7 @@ CDA_NamedNodeMap::removeNamedItemNS(const std::wstring& namespaceURI,
   ObjRef<CDA_Attr> at = (*i).second;
   mElement->removeChildPrivate(at)->release_ref();
 
-  std::map<CDA_Element::LocalName, CDA_Attr*>::iterator j =
+  CDA_SmallMap<CDA_Element::LocalName, CDA_Attr*>::iterator j =
     mElement->attributeMap.find(CDA_Element::LocalName
                                 (at->mNodeName));
 
@@ -1708,7 +1904,7 @@ CDA_Element::shallowCloneNode(CDA_Document* aDoc)
   ca->mNodeName = mNodeName;
   ca->mNodeValue = mNodeValue;
   // Attributes get cloned too...
-  std::map<QualifiedName, CDA_Attr*>::iterator i
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator i
     = attributeMapNS.begin();
   for (; i != attributeMapNS.end(); i++)
   {
@@ -1746,7 +1942,7 @@ std::wstring
 CDA_Element::getAttribute(const std::wstring& name)
   throw(std::exception&)
 {
-  std::map<LocalName, CDA_Attr*>::iterator
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator
     i = attributeMap.find(LocalName(name));
   if (i == attributeMap.end())
     return L"";
@@ -1758,7 +1954,7 @@ void
 CDA_Element::setAttribute(const std::wstring& name, const std::wstring& value)
   throw(std::exception&)
 {
-  std::map<LocalName, CDA_Attr*>::iterator
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator
     i = attributeMap.find(LocalName(name));
 
   CDA_DOM_SomethingChanged();
@@ -1770,10 +1966,10 @@ CDA_Element::setAttribute(const std::wstring& name, const std::wstring& value)
     a->mNodeName = name;
     insertBeforePrivate(a, NULL)->release_ref();
     attributeMapNS.insert(std::pair<QualifiedName, CDA_Attr*>
-                          (QualifiedName(L"", name),
+                          (QualifiedName(a->mNamespaceURI, a->mNodeName),
                            a));
     attributeMap.insert(std::pair<LocalName,CDA_Attr*>
-                        (LocalName(name), a));
+                        (LocalName(a->mNodeName), a));
 
     if (eventsHaveEffects())
     {
@@ -1809,7 +2005,7 @@ void
 CDA_Element::removeAttribute(const std::wstring& name)
   throw(std::exception&)
 {
-  std::map<LocalName, CDA_Attr*>::iterator
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator
     i = attributeMap.find(LocalName(name));
 
   if (i == attributeMap.end())
@@ -1823,7 +2019,7 @@ CDA_Element::removeAttribute(const std::wstring& name)
   removeChildPrivate(at)->release_ref();
   attributeMap.erase(i);
 
-  std::map<QualifiedName, CDA_Attr*>::iterator j;
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator j;
   if (at->mLocalName != L"")
     j = attributeMapNS.find
       (
@@ -1845,7 +2041,7 @@ CDA_Element::removeAttribute(const std::wstring& name)
   {
     RETURN_INTO_OBJREF(me, CDA_MutationEvent, new CDA_MutationEvent());
     me->initMutationEvent(L"DOMAttrModified", true, false,
-                          (*i).second, at->mNodeValue.c_str(), L"", name,
+                          at, at->mNodeValue.c_str(), L"", name,
                           iface::events::MutationEvent::REMOVAL);
     dispatchEvent(me);
     me->initMutationEvent(L"DOMSubtreeModified", true, false, NULL, L"", L"",
@@ -1858,7 +2054,7 @@ already_AddRefd<iface::dom::Attr>
 CDA_Element::getAttributeNode(const std::wstring& name)
   throw(std::exception&)
 {
-  std::map<LocalName, CDA_Attr*>::iterator
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator
     i = attributeMap.find(LocalName(name));
   if (i == attributeMap.end())
     return NULL;
@@ -1875,9 +2071,9 @@ CDA_Element::setAttributeNode(iface::dom::Attr* inewAttr)
   if (newAttr == NULL)
     throw iface::dom::DOMException(iface::dom::NOT_FOUND_ERR);
   std::wstring name = newAttr->name();
-  std::map<LocalName, CDA_Attr*>::iterator
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator
     i = attributeMap.find(LocalName(name));
-  std::map<QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator
     j = attributeMapNS.find(QualifiedName(L"", name));
 
   CDA_DOM_SomethingChanged();
@@ -1885,9 +2081,11 @@ CDA_Element::setAttributeNode(iface::dom::Attr* inewAttr)
   if (i == attributeMap.end())
   {
     insertBeforePrivate(newAttr, NULL)->release_ref();
-    attributeMap.insert(std::pair<LocalName, CDA_Attr*>(name, newAttr));
+    attributeMap.insert(std::pair<LocalName, CDA_Attr*>
+                        (LocalName(newAttr->mNodeName), newAttr));
     attributeMapNS.insert(std::pair<QualifiedName, CDA_Attr*>
-                          (QualifiedName(L"", name), newAttr));
+                          (QualifiedName(CDA_DOMName(), newAttr->mNodeName),
+                           newAttr));
 
     if (eventsHaveEffects())
     {
@@ -1913,9 +2111,9 @@ CDA_Element::setAttributeNode(iface::dom::Attr* inewAttr)
 
   insertBeforePrivate(newAttr, NULL)->release_ref();
   attributeMap.insert(std::pair<LocalName, CDA_Attr*>
-                      (LocalName(name), newAttr));
+                      (LocalName(newAttr->mNodeName), newAttr));
   attributeMapNS.insert(std::pair<QualifiedName, CDA_Attr*>
-                        (QualifiedName(L"", name),
+                        (QualifiedName(CDA_DOMName(), newAttr->mNodeName),
                          newAttr));
 
   if (eventsHaveEffects())
@@ -1948,7 +2146,7 @@ CDA_Element::removeAttributeNode(iface::dom::Attr* ioldAttr)
   std::wstring name = oldAttr->name();
   std::wstring lname = oldAttr->localName();
   std::wstring nsuri = oldAttr->namespaceURI();
-  std::map<LocalName, CDA_Attr*>::iterator
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator
     i = attributeMap.find(LocalName(name));
   if (i == attributeMap.end())
   {
@@ -1959,7 +2157,7 @@ CDA_Element::removeAttributeNode(iface::dom::Attr* ioldAttr)
   removeChildPrivate(at)->release_ref();
   attributeMap.erase(i);
 
-  std::map<QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator
     j = attributeMapNS.find(QualifiedName(nsuri, lname));
   QualifiedName qn((*j).first);
   attributeMapNS.erase(j);
@@ -1995,7 +2193,7 @@ CDA_Element::getAttributeNS(const std::wstring& namespaceURI,
   throw(std::exception&)
 {
   std::pair<std::wstring,std::wstring> p(namespaceURI, localName);
-  std::map<QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator
     i = attributeMapNS.find(QualifiedName(namespaceURI, localName));
   if (i == attributeMapNS.end())
     return L"";
@@ -2016,7 +2214,7 @@ CDA_Element::setAttributeNS(const std::wstring& namespaceURI,
   else
     localName = pos + 1;
 
-  std::map<QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator
     i = attributeMapNS.find(QualifiedName(namespaceURI, localName));
 
   CDA_DOM_SomethingChanged();
@@ -2031,12 +2229,12 @@ CDA_Element::setAttributeNS(const std::wstring& namespaceURI,
     insertBeforePrivate(a, NULL)->release_ref();
     attributeMapNS.insert(std::pair<QualifiedName, CDA_Attr*>
                           (
-                           QualifiedName(namespaceURI, localName), a
+                           QualifiedName(a->mNamespaceURI, a->mLocalName), a
                           )
                          );
 
 
-    std::map<LocalName, CDA_Attr*>::iterator
+    CDA_SmallMap<LocalName, CDA_Attr*>::iterator
       j = attributeMap.find(LocalName(qualifiedName));
     if (j != attributeMap.end())
     {
@@ -2044,7 +2242,7 @@ CDA_Element::setAttributeNS(const std::wstring& namespaceURI,
     }
 
     attributeMap.insert(std::pair<LocalName,CDA_Attr*>
-                        (LocalName(qualifiedName), a));
+                        (LocalName(a->mNodeName), a));
 
     if (eventsHaveEffects())
     {
@@ -2081,7 +2279,7 @@ CDA_Element::removeAttributeNS(const std::wstring& namespaceURI,
                                const std::wstring& localName)
   throw(std::exception&)
 {
-  std::map<QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator
     i = attributeMapNS.find
     (QualifiedName(namespaceURI, localName));
 
@@ -2098,7 +2296,7 @@ CDA_Element::removeAttributeNS(const std::wstring& namespaceURI,
   removeChildPrivate(at)->release_ref();
   QualifiedName qn((*i).first);
 
-  std::map<LocalName, CDA_Attr*>::iterator  
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator  
     j = attributeMap.find(LocalName((*i).second->mNodeName));
 
   ObjRef<iface::dom::Node> n = (*i).second;
@@ -2125,7 +2323,7 @@ CDA_Element::getAttributeNodeNS(const std::wstring& namespaceURI,
                                 const std::wstring& localName)
   throw(std::exception&)
 {
-  std::map<QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator
     i = attributeMapNS.find(QualifiedName(namespaceURI, localName));
   if (i == attributeMapNS.end())
     return NULL;
@@ -2145,7 +2343,7 @@ CDA_Element::setAttributeNodeNS(iface::dom::Attr* inewAttr)
     newAttr->mLocalName = newAttr->mNodeName;
   std::pair<std::wstring,std::wstring> p
     (newAttr->mNamespaceURI, newAttr->mLocalName);
-  std::map<QualifiedName, CDA_Attr*>::iterator
+  CDA_SmallMap<QualifiedName, CDA_Attr*>::iterator
     i = attributeMapNS.find
     (QualifiedName(newAttr->mNamespaceURI.c_str(),
                    newAttr->mLocalName.c_str()));
@@ -2185,7 +2383,7 @@ CDA_Element::setAttributeNodeNS(iface::dom::Attr* inewAttr)
   removeChildPrivate(at)->release_ref();
   attributeMapNS.erase(i);
 
-  std::map<LocalName, CDA_Attr*>::iterator j =
+  CDA_SmallMap<LocalName, CDA_Attr*>::iterator j =
     attributeMap.find(LocalName(at->mNodeName.c_str()));
   LocalName ln((*j).first);
   attributeMap.erase(j);
@@ -8,6 +8,8 @@
 #include <string>
 #include <list>
 #include <map>
+#include <vector>
+#include <algorithm>
 #ifdef HAVE_INTTYPES_H
 #include <inttypes.h>
 #endif
@@ -18,6 +20,7 @@
 #endif
 #include <time.h>
 #include "DOMBootstrap.hxx"
+#include "DOMName.hpp"
 
 typedef uint32_t cda_serial_t;
 
@@ -42,6 +45,103 @@ already_AddRefd<CDA_Document> CDA_NewDocument
 
 struct _xmlParserCtxt;
 struct _xmlError;
+class CDA_DOMBuilder;
+
+/*
+ * A map kept as a sorted vector, with the parts of the std::map interface the
+ * attribute maps use. Elements have a handful of attributes at most, so this
+ * is a lot smaller than a std::map, which allocates a node for each entry.
+ * Inserting or erasing moves the entries after it, and invalidates iterators.
+ */
+template<class K, class V>
+class CDA_SmallMap
+{
+public:
+  typedef std::pair<K, V> value_type;
+  typedef typename std::vector<value_type>::iterator iterator;
+
+  iterator begin() { return mEntries.begin(); }
+  iterator end() { return mEntries.end(); }
+  size_t size() const { return mEntries.size(); }
+  bool empty() const { return mEntries.empty(); }
+
+  iterator
+  lower_bound(const K& aKey)
+  {
+    return std::lower_bound(mEntries.begin(), mEntries.end(), aKey,
+                            KeyLess());
+  }
+
+  iterator
+  find(const K& aKey)
+  {
+    iterator i = lower_bound(aKey);
+    if (i == mEntries.end() || aKey < (*i).first)
+      return mEntries.end();
+    return i;
+  }
+
+  std::pair<iterator, bool>
+  insert(const value_type& aValue)
+  {
+    iterator i = lower_bound(aValue.first);
+    if (i != mEntries.end() && !(aValue.first < (*i).first))
+      return std::pair<iterator, bool>(i, false);
+    return std::pair<iterator, bool>(mEntries.insert(i, aValue), true);
+  }
+
+  void erase(iterator aWhere) { mEntries.erase(aWhere); }
+
+private:
+  struct KeyLess
+  {
+    bool
+    operator()(const value_type& aEntry, const K& aKey) const
+    {
+      return aEntry.first < aKey;
+    }
+  };
+
+  std::vector<value_type> mEntries;
+};
+
+struct CDA_NodeArenaChunk;
+
+/*
+ * Nodes made while loading a document are allocated from an arena, in large
+ * chunks, instead of with one heap allocation each. Nodes can outlive their
+ * document or move to another one, so the chunks aren't owned by the
+ * document; instead each chunk counts the nodes still in it, and is freed as
+ * soon as the last of them is deleted. A node which outlives the rest of its
+ * document only keeps its own chunk alive.
+ *
+ * Only the thread which set the arena as its current one allocates from it,
+ * but its nodes can be deleted from any thread.
+ */
+class CDA_NodeArena
+{
+public:
+  CDA_NodeArena();
+  // Stops allocating from the arena. Nodes already made from it stay until
+  // they are deleted.
+  ~CDA_NodeArena();
+
+  // Returns space for a node of aSize bytes, after a header saying which chunk
+  // it is in.
+  void* allocate(size_t aSize);
+  // Drops a node's reference to its chunk, and frees the chunk if the node
+  // was the last one in it.
+  static void release(CDA_NodeArenaChunk* aChunk);
+
+  // The arena new nodes on this thread come from, or NULL for the heap.
+  static CDA_NodeArena* Current();
+  static void SetCurrent(CDA_NodeArena* aArena);
+
+private:
+  CDA_NodeArenaChunk* mChunk;
+  char* mFree;
+  size_t mFreeLength;
+};
 
 class CDA_DOMImplementation
   : public CellML_DOMImplementationBase,
@@ -81,6 +181,15 @@ public:
                                              std::wstring& aErrorMessage)
     throw(std::exception&);
 
+  iface::dom::Document* loadDocumentFromUTF8(const char* aText,
+                                             size_t aLength,
+                                             std::wstring& aErrorMessage)
+    throw(std::exception&);
+
+  iface::dom::Document* loadDocumentFromFD(int aFD,
+                                           std::wstring& aErrorMessage)
+    throw(std::exception&);
+
   already_AddRefd<iface::mathml_dom::MathMLDocument> createMathMLDocument()
     throw(std::exception&);
 
@@ -89,6 +198,9 @@ public:
 private:
   void ProcessContextError(std::wstring& aErrorMessage,
                            _xmlParserCtxt* ctxt);
+  iface::dom::Document* FinishLoad(CDA_DOMBuilder& aBuilder,
+                                   _xmlParserCtxt* ctxt,
+                                   std::wstring& aErrorMessage);
 };
 
 class CDA_Document;
@@ -102,6 +214,10 @@ public:
   CDA_Node(CDA_Document* aDocument);
   virtual ~CDA_Node();
 
+  // Nodes come from the current CDA_NodeArena, if there is one.
+  static void* operator new(size_t aSize);
+  static void operator delete(void* aNode);
+
   void add_ref()
     throw(std::exception&)
   {
@@ -215,7 +331,8 @@ public:
   std::list<CDA_Node*>::iterator mPositionInParent;
   bool mDocumentIsAncestor;
   CDA_Document* mDocument;
-  std::wstring mNodeName, mLocalName, mNodeValue, mNamespaceURI;
+  CDA_DOMName mNodeName, mLocalName, mNamespaceURI;
+  std::wstring mNodeValue;
 
   std::list<CDA_Node*> mNodeList;
 private:
@@ -529,67 +646,101 @@ public:
   bool hasAttributes() throw(std::exception&);
   already_AddRefd<iface::dom::Element> searchForElementById(const std::wstring& elementId);
 
+  /*
+   * Keys stored in the attribute maps are made from the attribute's
+   * CDA_DOMNames, and keep a copy of them. Keys made from any other string
+   * just point at it, so they are only for lookups, and mustn't outlive that
+   * string.
+   */
   class LocalName
   {
   public:
+    LocalName(const CDA_DOMName& aName)
+      : stored(aName), name(NULL)
+    {
+    }
+
     LocalName(const std::wstring& aName)
-      : name(aName)
+      : name(&aName)
     {
     }
 
     LocalName(const LocalName& ln)
-      : name(ln.name)
+      : stored(ln.stored), name(ln.name)
     {
     }
 
+    const std::wstring& str() const { return name ? *name : stored.str(); }
+
     bool
     operator==(const LocalName& aCompareWith) const
     {
-      return name == aCompareWith.name;
+      if (name == NULL && aCompareWith.name == NULL)
+        return stored == aCompareWith.stored;
+      return str() == aCompareWith.str();
     }
 
     bool
     operator<(const LocalName& aCompareWith) const
     {
-      return name < aCompareWith.name;
+      return str() < aCompareWith.str();
     }
 
-    std::wstring name;
+    CDA_DOMName stored;
+    const std::wstring* name;
   };
 
   class QualifiedName
   {
   public:
+    QualifiedName(const CDA_DOMName& aNamespace, const CDA_DOMName& aName)
+      : storedName(aName), storedNS(aNamespace), name(NULL), ns(NULL)
+    {
+    }
+
     QualifiedName(const std::wstring& aNamespace, const std::wstring& aName)
-      : ns(aNamespace), name(aName)
+      : name(&aName), ns(&aNamespace)
     {
     }
 
     QualifiedName(const QualifiedName& ln)
-      : ns(ln.ns), name(ln.name)
+      : storedName(ln.storedName), storedNS(ln.storedNS), name(ln.name),
+        ns(ln.ns)
+    {
+    }
+
+    const std::wstring& nameStr() const
     {
+      return name ? *name : storedName.str();
     }
 
+    const std::wstring& nsStr() const { return ns ? *ns : storedNS.str(); }
+
     bool
     operator==(const QualifiedName& aCompareWith) const
     {
-      return name == aCompareWith.name && ns == aCompareWith.ns;
+      if (name == NULL && aCompareWith.name == NULL)
+        return storedName == aCompareWith.storedName &&
+          storedNS == aCompareWith.storedNS;
+      return nameStr() == aCompareWith.nameStr() &&
+        nsStr() == aCompareWith.nsStr();
     }
 
     bool
     operator<(const QualifiedName& aCompareWith) const
     {
-      int ret = wcscmp(name.c_str(), aCompareWith.name.c_str());
+      int ret = wcscmp(nameStr().c_str(), aCompareWith.nameStr().c_str());
       if (ret != 0)
         return ret < 0;
-      return wcscmp(ns.c_str(), aCompareWith.ns.c_str()) < 0;
+      return wcscmp(nsStr().c_str(), aCompareWith.nsStr().c_str()) < 0;
     }
 
-    std::wstring name, ns;
+    CDA_DOMName storedName, storedNS;
+    const std::wstring* name, * ns;
   };
 
-  std::map<QualifiedName, CDA_Attr*> attributeMapNS;
-  std::map<LocalName, CDA_Attr*> attributeMap;
+  CDA_SmallMap<QualifiedName, CDA_Attr*> attributeMapNS;
+  CDA_SmallMap<LocalName, CDA_Attr*> attributeMap;
 };
 
 class CDA_NamedNodeMap
@@ -619,11 +770,6 @@ public:
     throw(std::exception&);
 
   CDA_Element* mElement;
-
-private:
-  cda_serial_t hintSerial;
-  std::map<CDA_Element::QualifiedName, CDA_Attr*>::iterator hintIterator;
-  uint32_t hintIndex;
 };
 
 class CDA_TextBase
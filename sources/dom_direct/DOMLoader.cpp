@@ -10,6 +10,26 @@
 #include <libxml/rename-libxml.h>
 #endif
 #include <libxml/tree.h>
+#include <libxml/parser.h>
+#include <libxml/SAX2.h>
+#include <libxml/entities.h>
+#include <algorithm>
+#include <list>
+#include <map>
+#include <vector>
+
+// libxml has to set up its global state before documents are parsed on more
+// than one thread at once (see CDA_DOMURLLoader::loadDocuments), so do it
+// while the library is loaded, on the thread loading it.
+class CDA_XMLParserInitialiser
+{
+public:
+  CDA_XMLParserInitialiser()
+  {
+    xmlInitParser();
+  }
+};
+static CDA_XMLParserInitialiser sXMLParserInitialiser;
 
 struct CDA_utf8_data_t
 {
@@ -190,280 +210,532 @@ CDA_wchar_to_UTF8(const wchar_t *str)
   return newData;
 }
 
-CDA_Node*
-WrapXML2Node
-(
- CDA_Document* doc,
- xmlNode* x2node
-)
+// Appends the UTF-8 in [aStr, aEnd) to aData. libxml has already checked that
+// the text is valid UTF-8 by the time we see it.
+static void
+AppendUTF8(std::wstring& aData, const char* aStr, const char* aEnd)
 {
-  ObjRef<CDA_Document> docR;
-  ObjRef<CDA_Node> n;
+  wchar_t buf[64];
+  // Leave room for a surrogate pair at the end.
+  wchar_t* ne = buf + 62;
+  wchar_t* np = buf;
 
-  std::wstring localName, namespaceURI;
+  while (aStr < aEnd)
+  {
+    if (CDA_UNLIKELY(np >= ne))
+    {
+      aData.append(buf, np - buf);
+      np = buf;
+    }
 
-  if (x2node->name != NULL)
+    unsigned char c = (unsigned char)*aStr++;
+    if (CDA_LIKELY(c < 128))
+    {
+      *np++ = (wchar_t)c;
+      continue;
+    }
+
+    unsigned char l = CDA_utf8_data[c].len;
+    if (CDA_UNLIKELY(l == 0 || aStr + (l - 1) > aEnd))
+      break;
+    uint32_t cp = CDA_utf8_data[c].mask & c;
+    while (--l)
+      cp = (cp << 6) | ((*aStr++) & 0x3F);
+#ifndef WCHAR_T_CONSTANT_WIDTH
+    if (cp >= 0x10000)
+    {
+      cp -= 0x10000;
+      *np++ = (wchar_t)(0xD800 | (cp >> 10));
+      *np++ = (wchar_t)(0xDC00 | (cp & 0x3FF));
+      continue;
+    }
+#endif
+    *np++ = (wchar_t)cp;
+  }
+
+  aData.append(buf, np - buf);
+}
+
+/*
+ * Builds our DOM directly from libxml's SAX2 events, so we never have a
+ * libxml tree and our own tree in memory at the same time. libxml's own SAX2
+ * handlers are left in place for everything which isn't content (the DTD,
+ * entity declarations and so on), since it needs them to resolve entities, and
+ * for content parsed in any context other than ours (the replacement text of
+ * entities), which it builds into the entity as usual.
+ *
+ * The nodes come out the same as when we used to copy them from the libxml
+ * tree: in particular, the DTD is dropped, adjacent text is merged into one
+ * node, and text and comment nodes get libxml's names for them.
+ */
+class CDA_DOMBuilder
+{
+public:
+  CDA_DOMBuilder()
+    : mContext(NULL), mFailed(false), mLastText(NULL), mLastTextIsCDATA(false),
+      mTextName(L"text"), mXMLNSName(L"xmlns"),
+      mXMLNSNamespace(L"http://www.w3.org/2000/xmlns/"),
+      mArena(new CDA_NodeArena()), mPreviousArena(CDA_NodeArena::Current())
   {
-    localName += (const char*)x2node->name;
+    // Everything this thread makes until we are done comes from the arena.
+    CDA_NodeArena::SetCurrent(mArena);
   }
 
-  bool setNS = false;
+  ~CDA_DOMBuilder()
+  {
+    CDA_NodeArena::SetCurrent(mPreviousArena);
+    delete mArena;
+  }
 
-  bool isNodeStructure = false;
-  switch (x2node->type)
+  // Creates a parser context which builds into this builder. aChunk and aURL
+  // are as for xmlCreatePushParserCtxt.
+  xmlParserCtxtPtr createContext(const char* aChunk, int aSize,
+                                 const char* aURL)
   {
-  case XML_ELEMENT_NODE:
+    xmlSAXHandler sax;
+    memset(&sax, 0, sizeof(sax));
+    xmlSAXVersion(&sax, 2);
+    sax.startElementNs = startElementNs;
+    sax.endElementNs = endElementNs;
+    sax.characters = characters;
+    sax.ignorableWhitespace = characters;
+    sax.cdataBlock = cdataBlock;
+    sax.comment = comment;
+    sax.processingInstruction = processingInstruction;
+    sax.reference = reference;
+
+    mContext = xmlCreatePushParserCtxt(&sax, NULL, aChunk, aSize, aURL);
+    if (mContext != NULL)
+      mContext->_private = this;
+    return mContext;
+  }
+
+  xmlParserCtxtPtr mContext;
+  ObjRef<CDA_Document> mDocument;
+  bool mFailed;
+
+private:
+  struct PendingNode
+  {
+    PendingNode(bool aIsComment, const std::wstring& aName,
+                const std::wstring& aValue)
+      : mIsComment(aIsComment), mName(aName), mValue(aValue)
     {
-      setNS = true;
-      if (x2node->ns && x2node->ns->href)
-        namespaceURI += (const char*)x2node->ns->href;
-      isNodeStructure = true;
-      RETURN_INTO_OBJREF(el, CDA_Element, CDA_NewElement(doc, namespaceURI.c_str(),
-                                                         localName.c_str()));
-      n = el;
-      xmlAttr* at;
-      for (at = x2node->properties; at != NULL; at = at->next)
-      {
-        RETURN_INTO_OBJREF(cattr, CDA_Attr, new CDA_Attr(doc));
+    }
 
-        std::wstring nsURI, prefix, name;
-        if (at->ns && at->ns->href)
-        {
-          nsURI += (const char*)at->ns->href;
-          prefix += (const char*)at->ns->prefix;
-        }
-        name += (const char*)at->name;
+    bool mIsComment;
+    std::wstring mName, mValue;
+  };
 
-        cattr->mLocalName = name;
-        if (prefix != L"")
-          cattr->mNodeName = prefix + L":" + name;
-        else
-          cattr->mNodeName = name;
-        cattr->mNamespaceURI = nsURI;
+  // Returns the builder for the context aCtx, or NULL if libxml should handle
+  // the event itself.
+  static CDA_DOMBuilder*
+  builderFor(void* aCtx)
+  {
+    xmlParserCtxtPtr ctxt = reinterpret_cast<xmlParserCtxtPtr>(aCtx);
+    CDA_DOMBuilder* b = reinterpret_cast<CDA_DOMBuilder*>(ctxt->_private);
+    if (b == NULL || b->mContext != ctxt || ctxt->inSubset != 0)
+      return NULL;
+    return b;
+  }
 
-        xmlNode* tmp;
-        for (tmp = at->children; tmp != NULL; tmp = tmp->next)
-        {
-          RETURN_INTO_OBJREF(nw, CDA_Node, WrapXML2Node(doc, tmp));
-          if (nw != NULL)
-            cattr->appendChild(nw)->release_ref();
-        }
-        // Finally, fetch the value as a single string...
-        char *txt;
-        if (at->ns != NULL && at->ns->href != NULL)
-          txt = (char*)xmlGetNsProp(at->parent, at->name, at->ns->href);
-        else
-          txt = (char*)xmlGetNoNsProp(at->parent, at->name);
-
-        cattr->mNodeValue += txt;
-        xmlFree(txt);
-
-        el->attributeMapNS.insert
-          (
-           std::pair<CDA_Element::QualifiedName, CDA_Attr*>
-           (CDA_Element::QualifiedName(nsURI.c_str(), name.c_str()), cattr)
-          );
-        el->attributeMap.insert(std::pair<CDA_Element::LocalName, CDA_Attr*>
-                                (CDA_Element::LocalName
-                                 (cattr->mNodeName), cattr));
-        el->insertBeforePrivate(cattr, NULL)->release_ref();
-      }
+  // We can't let exceptions out through libxml, so stop the parse instead.
+  void
+  fail()
+  {
+    mFailed = true;
+    xmlStopParser(mContext);
+  }
 
-      xmlNs* nsd;
-      for (nsd = x2node->nsDef; nsd != NULL; nsd = nsd->next)
-      {
-        RETURN_INTO_OBJREF(cattr, CDA_Attr, new CDA_Attr(doc));
+  // Converts a name from libxml. A document uses the same few names over and
+  // over, so each parse keeps the ones it has already seen.
+  const CDA_DOMName&
+  internName(const char* aName)
+  {
+    if (aName == NULL)
+      return mEmptyName;
 
-        std::wstring nsURI, prefix, name;
-        if (nsd->prefix && strcmp((const char*)nsd->prefix, ""))
+    std::map<std::string, CDA_DOMName>::iterator i = mNames.find(aName);
+    if (i != mNames.end())
+      return (*i).second;
+
+    std::wstring name;
+    name += aName;
+    return (*mNames.insert(std::pair<std::string, CDA_DOMName>
+                           (aName, CDA_DOMName(name))).first).second;
+  }
+
+  // Converts prefix:name, or just the name if there is no prefix.
+  const CDA_DOMName&
+  internName(const char* aPrefix, const char* aName)
+  {
+    if (aPrefix == NULL || aPrefix[0] == 0)
+      return internName(aName);
+
+    std::string qname(aPrefix);
+    qname += ':';
+    qname += aName;
+    return internName(qname.c_str());
+  }
+
+  // The type of document depends on the namespace of the root element, so
+  // anything before that is kept until we know it.
+  void
+  createDocument(const std::wstring& aRootNS)
+  {
+    mDocument = already_AddRefd<CDA_Document>(CDA_NewDocument(aRootNS));
+    for (std::list<PendingNode>::iterator i = mPending.begin();
+         i != mPending.end(); i++)
+      addMisc((*i).mIsComment, (*i).mName, (*i).mValue);
+    mPending.clear();
+  }
+
+  void
+  append(CDA_Node* aNode)
+  {
+    CDA_Node* parent = mStack.empty() ?
+      static_cast<CDA_Node*>(mDocument) : mStack.back();
+    parent->insertBeforePrivate(aNode, NULL)->release_ref();
+    mLastText = NULL;
+  }
+
+  // Adds a comment or processing instruction where we are up to.
+  void
+  addMisc(bool aIsComment, const std::wstring& aName,
+          const std::wstring& aValue)
+  {
+    if (mStack.empty() && mDocument == NULL)
+    {
+      mPending.push_back(PendingNode(aIsComment, aName, aValue));
+      return;
+    }
+
+    ObjRef<CDA_Node> n;
+    if (aIsComment)
+      n = already_AddRefd<CDA_Comment>(new CDA_Comment(mDocument));
+    else
+      n = already_AddRefd<CDA_ProcessingInstruction>
+        (new CDA_ProcessingInstruction(mDocument, L"", L""));
+    n->mLocalName = aName;
+    n->mNodeName = aName;
+    n->mNodeValue = aValue;
+    append(n);
+  }
+
+  void
+  addAttribute(CDA_Element* aEl, const CDA_DOMName& aNSURI,
+               const CDA_DOMName& aQualifiedName, const CDA_DOMName& aName,
+               const std::wstring& aValue, bool aWithText)
+  {
+    RETURN_INTO_OBJREF(cattr, CDA_Attr, new CDA_Attr(mDocument));
+    cattr->mLocalName = aName;
+    cattr->mNodeName = aQualifiedName;
+    cattr->mNamespaceURI = aNSURI;
+    cattr->mNodeValue = aValue;
+
+    if (aWithText)
+    {
+      RETURN_INTO_OBJREF(txt, CDA_Text, new CDA_Text(mDocument));
+      txt->mLocalName = mTextName;
+      txt->mNodeName = mTextName;
+      txt->mNodeValue = aValue;
+      cattr->insertBeforePrivate(txt, NULL)->release_ref();
+    }
+
+    aEl->attributeMapNS.insert
+      (
+       std::pair<CDA_Element::QualifiedName, CDA_Attr*>
+       (CDA_Element::QualifiedName(cattr->mNamespaceURI, cattr->mLocalName),
+        cattr)
+      );
+    aEl->attributeMap.insert(std::pair<CDA_Element::LocalName, CDA_Attr*>
+                             (CDA_Element::LocalName(cattr->mNodeName), cattr));
+    aEl->insertBeforePrivate(cattr, NULL)->release_ref();
+  }
+
+  static void
+  startElementNs(void* aCtx, const xmlChar* aLocalName,
+                 const xmlChar* aPrefix, const xmlChar* aURI,
+                 int aNumNamespaces, const xmlChar** aNamespaces,
+                 int aNumAttributes, int aNumDefaulted,
+                 const xmlChar** aAttributes)
+  {
+    CDA_DOMBuilder* b = builderFor(aCtx);
+    if (b == NULL)
+    {
+      xmlSAX2StartElementNs(aCtx, aLocalName, aPrefix, aURI, aNumNamespaces,
+                            aNamespaces, aNumAttributes, aNumDefaulted,
+                            aAttributes);
+      return;
+    }
+
+    try
+    {
+      const CDA_DOMName& localName = b->internName((const char*)aLocalName);
+      const CDA_DOMName& namespaceURI = b->internName((const char*)aURI);
+
+      if (b->mDocument == NULL)
+        b->createDocument(namespaceURI);
+
+      RETURN_INTO_OBJREF(el, CDA_Element,
+                         CDA_NewElement(b->mDocument, namespaceURI,
+                                        localName));
+      el->mLocalName = localName;
+      el->mNamespaceURI = namespaceURI;
+      el->mNodeName = b->internName((const char*)aPrefix,
+                                    (const char*)aLocalName);
+
+      // Each attribute is its local name, prefix, URI, and the start and end
+      // of its value.
+      for (int i = 0; i < aNumAttributes; i++, aAttributes += 5)
+      {
+        const char* prefix = NULL, * nsURI = NULL;
+        if (aAttributes[2] != NULL)
         {
-          nsURI += "http://www.w3.org/2000/xmlns/";
-          prefix += L"xmlns";
-          name += (const char*)nsd->prefix;
+          nsURI = (const char*)aAttributes[2];
+          prefix = (const char*)aAttributes[1];
         }
-        else
-          name += L"xmlns";
+        std::wstring value;
+        AppendUTF8(value, (const char*)aAttributes[3],
+                   (const char*)aAttributes[4]);
+        b->addAttribute(el, b->internName(nsURI),
+                        b->internName(prefix, (const char*)aAttributes[0]),
+                        b->internName((const char*)aAttributes[0]),
+                        value, true);
+      }
 
-        cattr->mLocalName = name;
-        if (prefix != L"")
-          cattr->mNodeName = prefix + L":" + name;
+      // Each namespace declaration is its prefix and URI.
+      for (int i = 0; i < aNumNamespaces; i++, aNamespaces += 2)
+      {
+        std::wstring value;
+        value += (const char*)aNamespaces[1];
+        if (aNamespaces[0] && strcmp((const char*)aNamespaces[0], ""))
+          b->addAttribute(el, b->mXMLNSNamespace,
+                          b->internName("xmlns", (const char*)aNamespaces[0]),
+                          b->internName((const char*)aNamespaces[0]),
+                          value, false);
         else
-          cattr->mNodeName = name;
-        cattr->mNamespaceURI = nsURI;
-
-        cattr->mNodeValue += (const char*)nsd->href;
-
-        el->attributeMapNS.insert
-          (
-           std::pair<CDA_Element::QualifiedName, CDA_Attr*>
-           (CDA_Element::QualifiedName(nsURI.c_str(),
-                                       name.c_str()), cattr)
-          );
-        el->attributeMap.insert(std::pair<CDA_Element::LocalName, CDA_Attr*>
-                                (CDA_Element::LocalName
-                                 (cattr->mNodeName.c_str()), cattr));
-        el->insertBeforePrivate(cattr, NULL)->release_ref();
+          b->addAttribute(el, b->mEmptyName, b->mXMLNSName, b->mXMLNSName,
+                          value, false);
       }
+
+      b->append(el);
+      b->mStack.push_back(el);
     }
-    break;
-  case XML_TEXT_NODE:
+    catch (...)
     {
-      isNodeStructure = true;
-      CDA_Text* txt = new CDA_Text(doc);
-      n = already_AddRefd<CDA_Text>(txt);
+      b->fail();
     }
-    break;
-  case XML_CDATA_SECTION_NODE:
+  }
+
+  static void
+  endElementNs(void* aCtx, const xmlChar* aLocalName, const xmlChar* aPrefix,
+               const xmlChar* aURI)
+  {
+    CDA_DOMBuilder* b = builderFor(aCtx);
+    if (b == NULL)
     {
-      isNodeStructure = true;
-      n = already_AddRefd<CDA_CDATASection>(new CDA_CDATASection(doc));
+      xmlSAX2EndElementNs(aCtx, aLocalName, aPrefix, aURI);
+      return;
     }
-    break;
-  case XML_ENTITY_REF_NODE:
+
+    if (!b->mStack.empty())
+      b->mStack.pop_back();
+    b->mLastText = NULL;
+  }
+
+  // Adds text to the last node if it is of the same type, or a new node if
+  // not.
+  void
+  addText(bool aIsCDATA, const xmlChar* aText, int aLength)
+  {
+    // Text outside the document element isn't kept.
+    if (mStack.empty())
+      return;
+
+    if (mLastText == NULL || mLastTextIsCDATA != aIsCDATA)
     {
-      isNodeStructure = true;
-      n = already_AddRefd<CDA_EntityReference>(new CDA_EntityReference(doc));
+      ObjRef<CDA_Node> n;
+      if (aIsCDATA)
+        n = already_AddRefd<CDA_CDATASection>(new CDA_CDATASection(mDocument));
+      else
+      {
+        n = already_AddRefd<CDA_Text>(new CDA_Text(mDocument));
+        n->mLocalName = mTextName;
+        n->mNodeName = mTextName;
+      }
+      append(n);
+      mLastText = n;
+      mLastTextIsCDATA = aIsCDATA;
     }
-    break;
-  case XML_ENTITY_NODE:
+
+    AppendUTF8(mLastText->mNodeValue, (const char*)aText,
+               (const char*)aText + aLength);
+  }
+
+  static void
+  characters(void* aCtx, const xmlChar* aText, int aLength)
+  {
+    CDA_DOMBuilder* b = builderFor(aCtx);
+    if (b == NULL)
     {
-      xmlEntity* se = (xmlEntity*)x2node;
-      std::wstring notName, pubID, sysID;
-      notName += (const char*)se->name;
-      pubID += (const char*)se->ExternalID;
-      sysID += (const char*)se->SystemID;
-      n = already_AddRefd<CDA_Entity>
-          (new CDA_Entity(doc, pubID, sysID, notName));
+      xmlSAX2Characters(aCtx, aText, aLength);
+      return;
     }
-    break;
-  case XML_PI_NODE:
+
+    try
     {
-      isNodeStructure = true;
-      n =
-        already_AddRefd<CDA_ProcessingInstruction>
-        (new CDA_ProcessingInstruction(doc, L"", L""));
+      b->addText(false, aText, aLength);
     }
-    break;
-  case XML_COMMENT_NODE:
+    catch (...)
     {
-      isNodeStructure = true;
-      n = already_AddRefd<CDA_Comment>(new CDA_Comment(doc));
+      b->fail();
     }
-    break;
+  }
 
-  case XML_DOCUMENT_NODE:
-#ifdef XML_DOCB_DOCUMENT_NODE
-  case XML_DOCB_DOCUMENT_NODE:
-#endif
-#ifdef XML_HTML_DOCUMENT_NODE
-  case XML_HTML_DOCUMENT_NODE:
-#endif
+  static void
+  cdataBlock(void* aCtx, const xmlChar* aText, int aLength)
+  {
+    CDA_DOMBuilder* b = builderFor(aCtx);
+    if (b == NULL)
     {
-      // We need to decide what type of document before we add the children to
-      // it(e.g. for MathML support), so do a preliminary scan...
-      xmlNode* tnode = x2node->children;
-      std::wstring rootNS;
-      for (; tnode; tnode = tnode->next)
-      {
-        if (tnode->type != XML_ELEMENT_NODE)
-          continue;
-        if (tnode->ns == NULL || tnode->ns->href == NULL)
-          break;
-        rootNS += (const char*)tnode->ns->href;
-        break;
-      }
-
-      docR = already_AddRefd<CDA_Document>(CDA_NewDocument(rootNS.c_str()));
-      doc = docR;
-      xmlDoc* sd = (xmlDoc*)x2node;
-      xmlDtd* dt = sd->intSubset;
-      if (dt != NULL)
-      {
-        RETURN_INTO_OBJREF(dtwrap, CDA_Node, WrapXML2Node(doc, (xmlNode*)dt));
-        if (dtwrap != NULL)
-          doc->insertBeforePrivate(dtwrap, NULL)->release_ref();
-      }
-      n = doc;
+      xmlSAX2CDataBlock(aCtx, aText, aLength);
+      return;
     }
-    break;
 
-  case XML_DOCUMENT_TYPE_NODE:
+    try
     {
-      xmlDtd* dt = (xmlDtd*)x2node;
-      std::wstring pubID, sysID;
-      pubID += (const char*)dt->ExternalID;
-      sysID += (const char*)dt->SystemID;
-      n = already_AddRefd<CDA_DocumentType>
-          (new CDA_DocumentType(doc, localName, pubID, sysID));
+      b->addText(true, aText, aLength);
     }
-    break;
+    catch (...)
+    {
+      b->fail();
+    }
+  }
 
-  case XML_DOCUMENT_FRAG_NODE:
+  static void
+  comment(void* aCtx, const xmlChar* aValue)
+  {
+    CDA_DOMBuilder* b = builderFor(aCtx);
+    if (b == NULL)
     {
-      isNodeStructure = true;
-      n = already_AddRefd<CDA_DocumentFragment>(new CDA_DocumentFragment(doc));
+      xmlSAX2Comment(aCtx, aValue);
+      return;
     }
-    break;
 
-    // Handled as part of element...
-  case XML_ATTRIBUTE_NODE:
-    // Handled as part of document type...
-  case XML_NOTATION_NODE:
-    // The remaining types are not part of the standard DOM...
-  case XML_DTD_NODE:
-  case XML_ELEMENT_DECL:
-  case XML_ATTRIBUTE_DECL:
-  case XML_ENTITY_DECL:
-  case XML_NAMESPACE_DECL:
-  case XML_XINCLUDE_START:
-  case XML_XINCLUDE_END:
-    return NULL;
+    try
+    {
+      std::wstring value;
+      value += (const char*)aValue;
+      b->addMisc(true, L"comment", value);
+    }
+    catch (...)
+    {
+      b->fail();
+    }
   }
 
-  if (isNodeStructure)
+  static void
+  processingInstruction(void* aCtx, const xmlChar* aTarget,
+                        const xmlChar* aData)
   {
-    if (!setNS)
+    CDA_DOMBuilder* b = builderFor(aCtx);
+    if (b == NULL)
     {
-      if (x2node->ns && x2node->ns->href)
-      {
-        namespaceURI += (const char*)x2node->ns->href;
-      }
+      xmlSAX2ProcessingInstruction(aCtx, aTarget, aData);
+      return;
     }
 
-    n->mLocalName = localName;
-    if (x2node->ns && x2node->ns->href)
+    try
     {
-      n->mNamespaceURI = namespaceURI;
+      std::wstring target, data;
+      target += (const char*)aTarget;
+      data += (const char*)aData;
+      b->addMisc(false, target, data);
     }
-    if (x2node->ns && x2node->ns->prefix)
+    catch (...)
     {
-      std::wstring prefix;
-      prefix += (const char*)x2node->ns->prefix;
-      n->mNodeName = prefix + L":" + localName;
+      b->fail();
     }
-    else
-      n->mNodeName = localName;
+  }
 
-    if (x2node->content)
+  static void
+  reference(void* aCtx, const xmlChar* aName)
+  {
+    CDA_DOMBuilder* b = builderFor(aCtx);
+    if (b == NULL)
     {
-      std::wstring content;
-      content += (const char*)x2node->content;
-      n->mNodeValue = content;
+      xmlSAX2Reference(aCtx, aName);
+      return;
     }
+
+    if (b->mStack.empty())
+      return;
+
+    try
+    {
+      const char* name = (const char*)aName;
+      if (name[0] == '&')
+        name++;
+      std::string sname(name);
+      if (!sname.empty() && sname[sname.length() - 1] == ';')
+        sname.erase(sname.length() - 1);
+
+      RETURN_INTO_OBJREF(er, CDA_EntityReference,
+                         new CDA_EntityReference(b->mDocument));
+      std::wstring wname;
+      wname += sname.c_str();
+      er->mLocalName = wname;
+      er->mNodeName = er->mLocalName;
+      xmlEntityPtr ent = xmlGetDocEntity(b->mContext->myDoc,
+                                         (const xmlChar*)sname.c_str());
+      if (ent != NULL)
+        er->mNodeValue += (const char*)ent->content;
+      b->append(er);
+    }
+    catch (...)
+    {
+      b->fail();
+    }
+  }
+
+  std::vector<CDA_Node*> mStack;
+  CDA_Node* mLastText;
+  bool mLastTextIsCDATA;
+  std::list<PendingNode> mPending;
+  std::map<std::string, CDA_DOMName> mNames;
+  CDA_DOMName mEmptyName, mTextName, mXMLNSName, mXMLNSNamespace;
+  CDA_NodeArena* mArena, * mPreviousArena;
+};
+
+iface::dom::Document*
+CDA_DOMImplementation::FinishLoad(CDA_DOMBuilder& aBuilder,
+                                  xmlParserCtxtPtr ctxt,
+                                  std::wstring& aErrorMessage)
+{
+  // Whatever libxml built for the DTD and entities is no longer needed.
+  if (ctxt->myDoc != NULL)
+  {
+    xmlFreeDoc(ctxt->myDoc);
+    ctxt->myDoc = NULL;
   }
 
-  // Now visit children...
-  x2node = x2node->children;
-  while (x2node)
+  if (aBuilder.mFailed)
   {
-    RETURN_INTO_OBJREF(wn, CDA_Node, WrapXML2Node(doc, x2node));
-    if (wn != NULL)
-      n->insertBeforePrivate(wn, NULL)->release_ref();
-    x2node = x2node->next;
+    xmlFreeParserCtxt(ctxt);
+    aErrorMessage = L"nomemory";
+    return NULL;
   }
 
-  n->add_ref();
-  return n;
+  if (!ctxt->wellFormed || aBuilder.mDocument == NULL)
+  {
+    ProcessContextError(aErrorMessage, ctxt);
+    return NULL;
+  }
+  xmlFreeParserCtxt(ctxt);
+
+  aBuilder.mDocument->add_ref();
+  return aBuilder.mDocument;
 }
 
 void
@@ -1275,8 +1547,8 @@ CDA_DOMImplementation::loadDocument
   free(URL);
 
   CDA_PartialLoad pl = { this, aErrorMessage };
-  xmlParserCtxtPtr ctxt =
-    xmlCreatePushParserCtxt(NULL, NULL, NULL, 0, sURL.c_str());
+  CDA_DOMBuilder builder;
+  xmlParserCtxtPtr ctxt = builder.createContext(NULL, 0, sURL.c_str());
 
   if (ctxt == NULL)
   {
@@ -1289,18 +1561,11 @@ CDA_DOMImplementation::loadDocument
   xmlDocPtr xdp =
     xmlCtxtReadFile(ctxt, sURL.c_str(), NULL,
                     XML_PARSE_NOXINCNODE);
-  if (xdp == NULL)
-  {
-    ProcessContextError(aErrorMessage, ctxt);
-    return NULL;
-  }
-  xmlFreeParserCtxt(ctxt);
+  // This only holds the DTD; the document itself is in the builder.
+  if (xdp != NULL)
+    xmlFreeDoc(xdp);
 
-  // We just defined an XML2 document xdp. Convert to our data-structure...
-  iface::dom::Document* doc =
-    static_cast<CDA_Document*>(WrapXML2Node(NULL, (xmlNode*)xdp));
-  xmlFreeDoc(xdp);
-  return doc;
+  return FinishLoad(builder, ctxt, aErrorMessage);
 }
 
 iface::dom::Document*
@@ -1311,35 +1576,95 @@ CDA_DOMImplementation::loadDocumentFromText
 )
   throw(std::exception&)
 {
-  char* text = CDA_wchar_to_UTF8(aText.c_str());
-
   CDA_PartialLoad pl = { this, aErrorMessage };
-  xmlParserCtxtPtr ctxt =
-    xmlCreatePushParserCtxt(NULL, NULL, NULL, 0, NULL);
+  CDA_DOMBuilder builder;
+  xmlParserCtxtPtr ctxt = builder.createContext(NULL, 0, NULL);
 
   if (ctxt == NULL)
   {
     aErrorMessage = L"nomemory";
+    return NULL;
+  }
+
+  xmlSetStructuredErrorFunc(reinterpret_cast<void*>(&pl), CDA_XMLStructuredHandler);
+  xmlCtxtUseOptions(ctxt, XML_PARSE_NOXINCNODE | XML_PARSE_NONET);
+
+  // Convert and parse a piece at a time, so we never need a UTF-8 copy of the
+  // whole text.
+  const size_t chunkSize = 16384;
+  const wchar_t* p = aText.c_str();
+  const wchar_t* end = p + aText.length();
+  while (true)
+  {
+    const wchar_t* next = p + std::min(chunkSize, (size_t)(end - p));
+#ifndef WCHAR_T_CONSTANT_WIDTH
+    // Don't split a surrogate pair between chunks.
+    if (next != end && (next[-1] & 0xFC00) == 0xD800)
+      next++;
+#endif
+    std::wstring piece(p, next - p);
+    char* text = CDA_wchar_to_UTF8(piece.c_str());
+    int ret = xmlParseChunk(ctxt, text, strlen(text), next == end);
     free(text);
+    p = next;
+    if (ret != 0 || p == end || builder.mFailed)
+      break;
+  }
+
+  return FinishLoad(builder, ctxt, aErrorMessage);
+}
+
+iface::dom::Document*
+CDA_DOMImplementation::loadDocumentFromUTF8
+(
+ const char* aText,
+ size_t aLength,
+ std::wstring& aErrorMessage
+)
+  throw(std::exception&)
+{
+  CDA_PartialLoad pl = { this, aErrorMessage };
+  CDA_DOMBuilder builder;
+  xmlParserCtxtPtr ctxt = builder.createContext(NULL, 0, NULL);
+
+  if (ctxt == NULL)
+  {
+    aErrorMessage = L"nomemory";
     return NULL;
   }
 
   xmlSetStructuredErrorFunc(reinterpret_cast<void*>(&pl), CDA_XMLStructuredHandler);
-  
-  xmlDocPtr xdp =
-    xmlCtxtReadMemory(ctxt, text, strlen(text), NULL, NULL,
-                      XML_PARSE_NOXINCNODE | XML_PARSE_NONET);
-  free(text);
-  if (xdp == NULL)
+  xmlCtxtUseOptions(ctxt, XML_PARSE_NOXINCNODE | XML_PARSE_NONET);
+  xmlParseChunk(ctxt, aText, aLength, 1);
+
+  return FinishLoad(builder, ctxt, aErrorMessage);
+}
+
+iface::dom::Document*
+CDA_DOMImplementation::loadDocumentFromFD
+(
+ int aFD,
+ std::wstring& aErrorMessage
+)
+  throw(std::exception&)
+{
+  CDA_PartialLoad pl = { this, aErrorMessage };
+  CDA_DOMBuilder builder;
+  xmlParserCtxtPtr ctxt = builder.createContext(NULL, 0, NULL);
+
+  if (ctxt == NULL)
   {
-    ProcessContextError(aErrorMessage, ctxt);
+    aErrorMessage = L"nomemory";
     return NULL;
   }
-  xmlFreeParserCtxt(ctxt);
 
-  // We just defined an XML2 document xdp. Convert to our data-structure...
-  iface::dom::Document* doc =
-    static_cast<CDA_Document*>(WrapXML2Node(NULL, (xmlNode*)xdp));
-  xmlFreeDoc(xdp);
-  return doc;
+  xmlSetStructuredErrorFunc(reinterpret_cast<void*>(&pl), CDA_XMLStructuredHandler);
+
+  xmlDocPtr xdp =
+    xmlCtxtReadFd(ctxt, aFD, NULL, NULL,
+                  XML_PARSE_NOXINCNODE | XML_PARSE_NONET);
+  if (xdp != NULL)
+    xmlFreeDoc(xdp);
+
+  return FinishLoad(builder, ctxt, aErrorMessage);
 }
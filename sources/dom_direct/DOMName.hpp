@@ -0,0 +1,148 @@
+#ifndef _DOMNAME_HPP
+#define _DOMNAME_HPP
+#include <string>
+
+#include <functional>
+
+/*
+ * A node name, local name or namespace URI. Documents use the same CellML,
+ * MathML and RDF names over and over, so those come from a fixed table which
+ * is built once and never changes, and a name from the table is just a
+ * pointer into it. Any other name is a heap copy owned by the CDA_DOMName, so
+ * it goes away with the node that used it.
+ */
+class CDA_DOMName
+{
+public:
+  // Builds the table of common names, if it hasn't been built yet.
+  static void EnsureCommon();
+
+  CDA_DOMName()
+    : mName(Empty())
+  {
+  }
+
+  explicit CDA_DOMName(const std::wstring& aName)
+    : mName(Make(aName))
+  {
+  }
+
+  explicit CDA_DOMName(const wchar_t* aName)
+    : mName(Make(aName))
+  {
+  }
+
+  CDA_DOMName(const CDA_DOMName& aName)
+    : mName(Copy(aName.mName))
+  {
+  }
+
+  ~CDA_DOMName()
+  {
+    Free(mName);
+  }
+
+  CDA_DOMName&
+  operator=(const CDA_DOMName& aName)
+  {
+    if (mName != aName.mName)
+      Replace(Copy(aName.mName));
+    return *this;
+  }
+
+  CDA_DOMName&
+  operator=(const std::wstring& aName)
+  {
+    Replace(Make(aName));
+    return *this;
+  }
+
+  CDA_DOMName&
+  operator=(const wchar_t* aName)
+  {
+    Replace(Make(aName));
+    return *this;
+  }
+
+  CDA_DOMName&
+  operator+=(const std::wstring& aSuffix)
+  {
+    Replace(Make(*mName + aSuffix));
+    return *this;
+  }
+
+  operator const std::wstring&() const
+  {
+    return *mName;
+  }
+
+  const std::wstring& str() const { return *mName; }
+  const wchar_t* c_str() const { return mName->c_str(); }
+  size_t length() const { return mName->length(); }
+  bool empty() const { return mName->empty(); }
+
+  size_t
+  find(wchar_t aChar, size_t aPos = 0) const
+  {
+    return mName->find(aChar, aPos);
+  }
+
+  std::wstring
+  substr(size_t aPos = 0, size_t aLength = std::wstring::npos) const
+  {
+    return mName->substr(aPos, aLength);
+  }
+
+  // Two different names from the table always have different text, so only
+  // names which aren't both from it need their text compared.
+  bool
+  operator==(const CDA_DOMName& aName) const
+  {
+    return mName == aName.mName ||
+      ((!IsCommon(mName) || !IsCommon(aName.mName)) && *mName == *aName.mName);
+  }
+
+  bool operator!=(const CDA_DOMName& aName) const { return !(*this == aName); }
+  bool operator==(const std::wstring& aName) const { return *mName == aName; }
+  bool operator!=(const std::wstring& aName) const { return *mName != aName; }
+  bool operator==(const wchar_t* aName) const { return *mName == aName; }
+  bool operator!=(const wchar_t* aName) const { return *mName != aName; }
+
+private:
+  static const std::wstring* Make(const std::wstring& aName);
+  static const std::wstring* Empty();
+
+  static bool
+  IsCommon(const std::wstring* aName)
+  {
+    std::less<const std::wstring*> less;
+    return !less(aName, sCommonBegin) && less(aName, sCommonEnd);
+  }
+
+  static const std::wstring*
+  Copy(const std::wstring* aName)
+  {
+    return IsCommon(aName) ? aName : new std::wstring(*aName);
+  }
+
+  static void
+  Free(const std::wstring* aName)
+  {
+    if (!IsCommon(aName))
+      delete aName;
+  }
+
+  // Makes aNew the name, freeing the old one. aNew is made first, so it can
+  // be made from the old name.
+  void
+  Replace(const std::wstring* aNew)
+  {
+    Free(mName);
+    mName = aNew;
+  }
+
+  static const std::wstring* sCommonBegin, * sCommonEnd;
+  const std::wstring* mName;
+};
+
+#endif // _DOMNAME_HPP
@@ -983,11 +983,15 @@ CDA_AllTriplesEnumerator::CDA_AllTriplesEnumerator
 (
  CDA_DataSource* aDataSource,
  CDA_AllTriplesSet* aSet,
- const std::set<CDA_AllTriplesSet::RealTriple>::iterator& aPosition,
- const std::set<CDA_AllTriplesSet::RealTriple>::iterator& aEnd
+ const CDA_AllTriplesSet::TripleIndex::iterator& aPosition,
+ const CDA_AllTriplesSet::TripleIndex::iterator& aEnd,
+ CDA_Resource* aSubjectFilter,
+ CDA_Resource* aPredicateFilter,
+ CDA_RDFNode* aObjectFilter
 )
   : mSet(aSet), mDataSource(aDataSource),
-    mPosition(aPosition), mEnd(aEnd)
+    mPosition(aPosition), mEnd(aEnd), mSubjectFilter(aSubjectFilter),
+    mPredicateFilter(aPredicateFilter), mObjectFilter(aObjectFilter)
 {
 }
 
@@ -1005,23 +1009,35 @@ CDA_AllTriplesEnumerator::getNextTriple()
     return NULL;
   }
 
-  CDA_Triple* t = new CDA_Triple(mDataSource, (*mPosition).subj,
-                                 (*mPosition).pred, (*mPosition).obj);
+  const CDA_AllTriplesSet::RealTriple& rt = *mPosition;
+  if ((mSubjectFilter != NULL && rt.subj != mSubjectFilter) ||
+      (mPredicateFilter != NULL && rt.pred != mPredicateFilter) ||
+      (mObjectFilter != NULL && rt.obj != mObjectFilter))
+  {
+    mPosition = mEnd;
+    return NULL;
+  }
+
+  CDA_Triple* t = new CDA_Triple(mDataSource, rt.subj, rt.pred, rt.obj);
   mPosition++;
 
   return t;
 }
 
 void
-CDA_AllTriplesEnumerator::aboutToDelete(const std::set<CDA_AllTriplesSet::
-                                        RealTriple>::iterator& aWhere)
+CDA_AllTriplesEnumerator::aboutToDelete(const CDA_AllTriplesSet::RealTriple&
+                                        aWhat)
 {
-  if (aWhere == mPosition)
+  if (mPosition != mEnd && (*mPosition).subj == aWhat.subj &&
+      (*mPosition).pred == aWhat.pred && (*mPosition).obj == aWhat.obj)
     mPosition++;
 }
 
 CDA_AllTriplesSet::CDA_AllTriplesSet(CDA_DataSource* aDataSource)
-  : mDataSource(aDataSource)
+  : mRealTriples(TripleOrder(TripleOrder::SPO)),
+    mPOSTriples(TripleOrder(TripleOrder::POS)),
+    mOSPTriples(TripleOrder(TripleOrder::OSP)),
+    mDataSource(aDataSource)
 {
 }
 
@@ -1041,6 +1057,33 @@ CDA_AllTriplesSet::enumerateTriples()
   return te;
 }
 
+already_AddRefd<iface::rdf_api::TripleEnumerator>
+CDA_AllTriplesSet::enumerateMatchingTriples
+(
+ CDA_Resource* aSubject,
+ CDA_Resource* aPredicate,
+ CDA_RDFNode* aObject
+)
+{
+  // Pick the index where the given components come first...
+  TripleIndex* index;
+  if (aObject != NULL && aPredicate == NULL)
+    index = &mOSPTriples;
+  else if (aPredicate != NULL && aSubject == NULL)
+    index = &mPOSTriples;
+  else
+    index = &mRealTriples;
+
+  // Missing components sort first, so this finds the first match...
+  RealTriple rt(aSubject, aPredicate, aObject);
+  CDA_AllTriplesEnumerator* te =
+    new CDA_AllTriplesEnumerator(mDataSource, this, index->lower_bound(rt),
+                                 index->end(), aSubject, aPredicate, aObject);
+  mLiveEnumerators.insert(te);
+
+  return te;
+}
+
 bool
 CDA_AllTriplesSet::assert
 (
@@ -1050,10 +1093,11 @@ CDA_AllTriplesSet::assert
 )
 {
   RealTriple rt(aSubject, aPredicate, aObject);
-  if (mRealTriples.count(rt))
+  if (!mRealTriples.insert(rt).second)
     return false;
 
-  mRealTriples.insert(rt);
+  mPOSTriples.insert(rt);
+  mOSPTriples.insert(rt);
   return true;
 }
 
@@ -1067,7 +1111,7 @@ CDA_AllTriplesSet::unassert
 {
   RealTriple rt(aSubject, aPredicate, aObject);
 
-  std::set<RealTriple>::iterator i(mRealTriples.find(rt));
+  TripleIndex::iterator i(mRealTriples.find(rt));
 
   if (i == mRealTriples.end())
     return false;
@@ -1075,9 +1119,11 @@ CDA_AllTriplesSet::unassert
   for (std::set<CDA_AllTriplesEnumerator*>::iterator j = mLiveEnumerators.begin();
        j != mLiveEnumerators.end();
        j++)
-    (*j)->aboutToDelete(i);
+    (*j)->aboutToDelete(rt);
 
   mRealTriples.erase(i);
+  mPOSTriples.erase(rt);
+  mOSPTriples.erase(rt);
 
   return true;
 }
@@ -1092,8 +1138,6 @@ CDA_AllTriplesSet::exists
 {
   RealTriple rt(aSubject, aPredicate, aObject);
 
-  std::set<RealTriple>::iterator i(mRealTriples.find(rt));
-
   return mRealTriples.count(rt) > 0;
 }
 
@@ -1124,58 +1168,9 @@ already_AddRefd<iface::rdf_api::TripleEnumerator>
 CDA_FilteringTripleSet::enumerateTriples()
   throw(std::exception&)
 {
-  RETURN_INTO_OBJREF(ti, iface::rdf_api::TripleEnumerator,
-                     mMasterSource->enumerateTriples());
-  return new CDA_FilteringTripleEnumerator(ti, mSubjectFilter, mPredicateFilter,
-                                           mObjectFilter);
-}
-
-CDA_FilteringTripleEnumerator::CDA_FilteringTripleEnumerator
-(
- iface::rdf_api::TripleEnumerator* aMasterEnum, CDA_Resource* aSubjectFilter,
- CDA_Resource* aPredicateFilter, CDA_RDFNode* aObjectFilter
-)
-  : mMasterEnum(aMasterEnum), mSubjectFilter(aSubjectFilter),
-    mPredicateFilter(aPredicateFilter), mObjectFilter(aObjectFilter)
-{
-}
-
-CDA_FilteringTripleEnumerator::~CDA_FilteringTripleEnumerator()
-{
-}
-
-already_AddRefd<iface::rdf_api::Triple>
-CDA_FilteringTripleEnumerator::getNextTriple()
-  throw(std::exception&)
-{
-  while (true)
-  {
-    RETURN_INTO_OBJREF(t, iface::rdf_api::Triple, mMasterEnum->getNextTriple());
-    if (t == NULL)
-      return NULL;
-
-    if (mSubjectFilter)
-    {
-      RETURN_INTO_OBJREF(s, iface::rdf_api::Resource, t->subject());
-      if (CDA_objcmp(s, mSubjectFilter))
-        continue;
-    }
-    if (mPredicateFilter)
-    {
-      RETURN_INTO_OBJREF(p, iface::rdf_api::Resource, t->predicate());
-      if (CDA_objcmp(p, mPredicateFilter))
-        continue;
-    }
-    if (mObjectFilter)
-    {
-      RETURN_INTO_OBJREF(o, iface::rdf_api::Node, t->object());
-      if (CDA_objcmp(o, mObjectFilter))
-        continue;
-    }
-
-    t->add_ref();
-    return t.getPointer();
-  }
+  return mMasterSource->enumerateMatchingTriples(mSubjectFilter,
+                                                 mPredicateFilter,
+                                                 mObjectFilter);
 }
 
 CDA_RDFBootstrap::CDA_RDFBootstrap()
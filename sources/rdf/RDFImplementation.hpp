@@ -374,6 +374,12 @@ public:
               CDA_RDFNode* aObject);
   void enumeratorDeleted(CDA_AllTriplesEnumerator* aEnum);
 
+  // Enumerates the triples matching the non-NULL arguments.
+  already_AddRefd<iface::rdf_api::TripleEnumerator>
+  enumerateMatchingTriples(CDA_Resource* aSubject,
+                           CDA_Resource* aPredicate,
+                           CDA_RDFNode* aObject);
+
   struct RealTriple
   {
     RealTriple(CDA_Resource* aSubj, CDA_Resource* aPred, CDA_RDFNode* aObj)
@@ -383,23 +389,74 @@ public:
 
     CDA_Resource * subj, * pred;
     CDA_RDFNode* obj;
+  };
+
+  /*
+   * Orders triples by subject, predicate and object, in the order given. A
+   * NULL component sorts before everything else, so a triple with only the
+   * leading components filled in finds the start of all triples matching them.
+   */
+  class TripleOrder
+  {
+  public:
+    enum Order
+    {
+      SPO,
+      POS,
+      OSP
+    };
+
+    TripleOrder(Order aOrder = SPO)
+      : mOrder(aOrder)
+    {
+    }
 
     bool
-    operator<(const RealTriple& aRT) const
+    operator()(const RealTriple& aRT1, const RealTriple& aRT2) const
     {
-      if (subj == aRT.subj)
+      int ret;
+      switch (mOrder)
       {
-        if (pred == aRT.pred)
-          return *obj < *(aRT.obj);
-        else
-          return *pred < *(aRT.pred);
+      case SPO:
+        if ((ret = compare(aRT1.subj, aRT2.subj)) ||
+            (ret = compare(aRT1.pred, aRT2.pred)))
+          return ret < 0;
+        return compare(aRT1.obj, aRT2.obj) < 0;
+      case POS:
+        if ((ret = compare(aRT1.pred, aRT2.pred)) ||
+            (ret = compare(aRT1.obj, aRT2.obj)))
+          return ret < 0;
+        return compare(aRT1.subj, aRT2.subj) < 0;
+      default:
+        if ((ret = compare(aRT1.obj, aRT2.obj)) ||
+            (ret = compare(aRT1.subj, aRT2.subj)))
+          return ret < 0;
+        return compare(aRT1.pred, aRT2.pred) < 0;
       }
-      return *subj < *(aRT.subj);
     }
+
+  private:
+    static int
+    compare(const CDA_RDFNode* aN1, const CDA_RDFNode* aN2)
+    {
+      if (aN1 == aN2)
+        return 0;
+      if (aN1 == NULL)
+        return -1;
+      if (aN2 == NULL)
+        return 1;
+      return (*aN1 < *aN2) ? -1 : 1;
+    }
+
+    Order mOrder;
   };
 
+  typedef std::set<RealTriple, TripleOrder> TripleIndex;
+
 private:
-  std::set<RealTriple> mRealTriples;
+  // Every triple is in all three indexes, so that any combination of subject,
+  // predicate and object is a prefix of one of them.
+  TripleIndex mRealTriples, mPOSTriples, mOSPTriples;
   std::set<CDA_AllTriplesEnumerator*> mLiveEnumerators;
   CDA_DataSource* mDataSource;
 };
@@ -411,8 +468,11 @@ public:
   CDA_AllTriplesEnumerator(
                            CDA_DataSource* aDataSource,
                            CDA_AllTriplesSet* aSet,
-                           const std::set<CDA_AllTriplesSet::RealTriple>::iterator& aPosition,
-                           const std::set<CDA_AllTriplesSet::RealTriple>::iterator& aEnd
+                           const CDA_AllTriplesSet::TripleIndex::iterator& aPosition,
+                           const CDA_AllTriplesSet::TripleIndex::iterator& aEnd,
+                           CDA_Resource* aSubjectFilter = NULL,
+                           CDA_Resource* aPredicateFilter = NULL,
+                           CDA_RDFNode* aObjectFilter = NULL
                           );
   ~CDA_AllTriplesEnumerator();
 
@@ -421,12 +481,16 @@ public:
   CDA_IMPL_ID;
 
   already_AddRefd<iface::rdf_api::Triple> getNextTriple() throw(std::exception&);
-  void aboutToDelete(const std::set<CDA_AllTriplesSet::RealTriple>::iterator& aWhere);
+  void aboutToDelete(const CDA_AllTriplesSet::RealTriple& aWhat);
 
 private:
   ObjRef<CDA_AllTriplesSet> mSet;
   CDA_DataSource* mDataSource;
-  std::set<CDA_AllTriplesSet::RealTriple>::iterator mPosition, mEnd;
+  CDA_AllTriplesSet::TripleIndex::iterator mPosition, mEnd;
+  // The filters are all a prefix of the index's order, so the enumeration is
+  // finished at the first triple that doesn't match them.
+  ObjRef<CDA_Resource> mSubjectFilter, mPredicateFilter;
+  ObjRef<CDA_RDFNode> mObjectFilter;
 };
 
 class CDA_FilteringTripleSet
@@ -449,27 +513,6 @@ private:
   ObjRef<CDA_RDFNode> mObjectFilter;
 };
 
-class CDA_FilteringTripleEnumerator
-  : public iface::rdf_api::TripleEnumerator
-{
-public:
-  CDA_FilteringTripleEnumerator(iface::rdf_api::TripleEnumerator* aMasterEnum,
-                                CDA_Resource* aSubjectFilter,
-                                CDA_Resource* aPredicateFilter, CDA_RDFNode* aObjectFilter);
-  ~CDA_FilteringTripleEnumerator();
-
-  CDA_IMPL_REFCOUNT;
-  CDA_IMPL_QI1(rdf_api::TripleEnumerator);
-  CDA_IMPL_ID;
-
-  already_AddRefd<iface::rdf_api::Triple> getNextTriple() throw(std::exception&);
-
-private:
-  ObjRef<iface::rdf_api::TripleEnumerator> mMasterEnum;
-  ObjRef<CDA_Resource> mSubjectFilter, mPredicateFilter;
-  ObjRef<CDA_RDFNode> mObjectFilter;
-};
-
 class CDA_RDFBootstrap
   : public iface::rdf_api::Bootstrap
 {
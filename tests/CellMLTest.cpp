@@ -3353,6 +3353,66 @@ CellMLTest::testCellMLElementSet()
 
 #define CELLML_1_1_NS L"http://www.cellml.org/cellml/1.1#"
 
+void
+CellMLTest::testNamedSetMutation()
+{
+  loadBeelerReuter();
+  iface::cellml_api::UnitsSet* us = mBeelerReuter->localUnits();
+
+  // The first lookup builds the name map...
+  iface::cellml_api::Units* u = us->getUnits(L"microF_per_cm2");
+  CPPUNIT_ASSERT(u != NULL);
+
+  // ... which has to follow renames...
+  u->name(L"renamed_units");
+  iface::cellml_api::Units* u2 = us->getUnits(L"microF_per_cm2");
+  CPPUNIT_ASSERT(u2 == NULL);
+  u2 = us->getUnits(L"renamed_units");
+  CPPUNIT_ASSERT(u2 != NULL);
+  CPPUNIT_ASSERT_EQUAL(0, CDA_objcmp(u, u2));
+  u2->release_ref();
+
+  // ... and removals...
+  mBeelerReuter->removeElement(u);
+  u2 = us->getUnits(L"renamed_units");
+  CPPUNIT_ASSERT(u2 == NULL);
+  u->release_ref();
+
+  // ... and elements appended at the end...
+  iface::cellml_api::Units* newunits = mBeelerReuter->createUnits();
+  newunits->name(L"appended_units");
+  mBeelerReuter->addElement(newunits);
+  u2 = us->getUnits(L"appended_units");
+  CPPUNIT_ASSERT(u2 != NULL);
+  CPPUNIT_ASSERT_EQUAL(0, CDA_objcmp(newunits, u2));
+  u2->release_ref();
+  newunits->release_ref();
+
+  // ... or inserted before the others, straight into the DOM.
+  ObjRef<iface::cellml_api::CellMLDOMElement> cde(QueryInterface(mBeelerReuter));
+  iface::dom::Element* modelEl = cde->domElement();
+  iface::dom::Document* doc = modelEl->ownerDocument();
+  iface::dom::Element* newel = doc->createElementNS(CELLML_1_1_NS, L"units");
+  newel->setAttributeNS(L"", L"name", L"inserted_units");
+  iface::dom::Node* refnode = modelEl->firstChild();
+  modelEl->insertBefore(newel, refnode)->release_ref();
+  refnode->release_ref();
+  newel->release_ref();
+  doc->release_ref();
+  modelEl->release_ref();
+
+  u2 = us->getUnits(L"inserted_units");
+  CPPUNIT_ASSERT(u2 != NULL);
+  u2->release_ref();
+  // Everything else must still be found after that.
+  u2 = us->getUnits(L"appended_units");
+  CPPUNIT_ASSERT(u2 != NULL);
+  u2->release_ref();
+  CPPUNIT_ASSERT_EQUAL(11, (int)us->length());
+
+  us->release_ref();
+}
+
 void
 CellMLTest::testIteratorLiveness()
 {
@@ -3494,3 +3554,157 @@ CellMLTest::testImportClone()
 
   CPPUNIT_ASSERT_EQUAL(std::wstring(L"level1"), name);
 }
+
+void
+CellMLTest::testConcurrentImports()
+{
+  // Three different documents are imported at the top level, so they are
+  // loaded together, and one of them is imported twice.
+  RETURN_INTO_OBJREF(m, iface::cellml_api::Model,
+                     mModelLoader->loadFromURL
+                     (BASE_DIRECTORY L"subdir1/subdir2/multiple_imports.xml"));
+  m->fullyInstantiateImports();
+
+  RETURN_INTO_OBJREF(cis, iface::cellml_api::CellMLImportSet, m->imports());
+  RETURN_INTO_OBJREF(cii, iface::cellml_api::CellMLImportIterator,
+                     cis->iterateImports());
+  std::vector<iface::cellml_api::Model*> models;
+  while (true)
+  {
+    RETURN_INTO_OBJREF(imp, iface::cellml_api::CellMLImport,
+                       cii->nextImport());
+    if (imp == NULL)
+      break;
+    CPPUNIT_ASSERT(imp->wasInstantiated());
+    iface::cellml_api::Model* im = imp->importedModel();
+    CPPUNIT_ASSERT(im != NULL);
+    models.push_back(im);
+  }
+  CPPUNIT_ASSERT_EQUAL(4, (int)models.size());
+
+  // Each import gets the document it asked for, whatever order they finished
+  // loading in...
+  std::wstring name = models[0]->name();
+  CPPUNIT_ASSERT_EQUAL(std::wstring(L"level1"), name);
+  RETURN_INTO_OBJREF(ccs, iface::cellml_api::CellMLComponentSet,
+                     models[1]->localComponents());
+  RETURN_INTO_OBJREF(c, iface::cellml_api::CellMLComponent,
+                     ccs->getComponent(L"level2_component"));
+  CPPUNIT_ASSERT(c != NULL);
+  name = models[2]->name();
+  CPPUNIT_ASSERT_EQUAL(std::wstring(L"level1"), name);
+  name = models[3]->name();
+  CPPUNIT_ASSERT_EQUAL(std::wstring(L"units_test"), name);
+
+  // ... and imports of the same document get separate copies of it.
+  CPPUNIT_ASSERT(CDA_objcmp(models[0], models[2]) != 0);
+  models[0]->name(L"changed_level1");
+  name = models[2]->name();
+  CPPUNIT_ASSERT_EQUAL(std::wstring(L"level1"), name);
+
+  // The next level down was instantiated for both copies.
+  for (size_t i = 0; i < 3; i += 2)
+  {
+    RETURN_INTO_OBJREF(nis, iface::cellml_api::CellMLImportSet,
+                       models[i]->imports());
+    RETURN_INTO_OBJREF(nii, iface::cellml_api::CellMLImportIterator,
+                       nis->iterateImports());
+    RETURN_INTO_OBJREF(ni, iface::cellml_api::CellMLImport,
+                       nii->nextImport());
+    CPPUNIT_ASSERT(ni != NULL);
+    CPPUNIT_ASSERT(ni->wasInstantiated());
+  }
+
+  for (size_t i = 0; i < models.size(); i++)
+    models[i]->release_ref();
+}
+
+void
+CellMLTest::testDocumentCache()
+{
+  SetCellMLDocumentCacheLimit(10000000);
+
+  // The second load comes out of the cache, but has to be a document of its
+  // own...
+  RETURN_INTO_OBJREF(d1, iface::dom::Document,
+                     mLocalURLLoader->loadDocument
+                     (BASE_DIRECTORY L"beeler_reuter_model_1977.xml"));
+  CPPUNIT_ASSERT(d1 != NULL);
+  RETURN_INTO_OBJREF(d2, iface::dom::Document,
+                     mLocalURLLoader->loadDocument
+                     (BASE_DIRECTORY L"beeler_reuter_model_1977.xml"));
+  CPPUNIT_ASSERT(d2 != NULL);
+  CPPUNIT_ASSERT(CDA_objcmp(d1, d2) != 0);
+
+  // ... so changing one doesn't change the others, or later loads.
+  RETURN_INTO_OBJREF(de1, iface::dom::Element, d1->documentElement());
+  de1->setAttribute(L"name", L"changed_model");
+  RETURN_INTO_OBJREF(de2, iface::dom::Element, d2->documentElement());
+  std::wstring name = de2->getAttribute(L"name");
+  CPPUNIT_ASSERT_EQUAL(std::wstring(L"beeler_reuter_model_1977"), name);
+  RETURN_INTO_OBJREF(d3, iface::dom::Document,
+                     mLocalURLLoader->loadDocument
+                     (BASE_DIRECTORY L"beeler_reuter_model_1977.xml"));
+  RETURN_INTO_OBJREF(de3, iface::dom::Element, d3->documentElement());
+  name = de3->getAttribute(L"name");
+  CPPUNIT_ASSERT_EQUAL(std::wstring(L"beeler_reuter_model_1977"), name);
+
+  // Models built on cached documents are just like any other.
+  loadBeelerReuter();
+  RETURN_INTO_OBJREF(us, iface::cellml_api::UnitsSet,
+                     mBeelerReuter->localUnits());
+  CPPUNIT_ASSERT_EQUAL(10, (int)us->length());
+
+  // A limit smaller than the file throws it out, and loads still work.
+  SetCellMLDocumentCacheLimit(10);
+  RETURN_INTO_OBJREF(d4, iface::dom::Document,
+                     mLocalURLLoader->loadDocument
+                     (BASE_DIRECTORY L"beeler_reuter_model_1977.xml"));
+  CPPUNIT_ASSERT(d4 != NULL);
+
+  SetCellMLDocumentCacheLimit(0);
+}
+
+static int
+Sign(int aValue)
+{
+  return (aValue < 0) ? -1 : ((aValue > 0) ? 1 : 0);
+}
+
+void
+CellMLTest::testObjectIDs()
+{
+  loadBeelerReuter();
+
+  std::vector<iface::XPCOM::IObject*> objects;
+  objects.push_back(mBeelerReuter);
+  iface::cellml_api::CellMLComponentSet* ccs =
+    mBeelerReuter->modelComponents();
+  iface::cellml_api::CellMLComponentIterator* cci = ccs->iterateComponents();
+  ccs->release_ref();
+  iface::cellml_api::CellMLComponent* c;
+  while ((c = cci->nextComponent()) != NULL)
+    objects.push_back(c);
+  cci->release_ref();
+  // An object that only has a string ID has to fit into the same ordering.
+  objects.push_back(new MyUserData());
+
+  // Numbered objects must order exactly as their IDs do, so sets mixing them
+  // with other objects stay consistent.
+  for (size_t i = 0; i < objects.size(); i++)
+  {
+    CPPUNIT_ASSERT_EQUAL(0, CDA_objcmp(objects[i], objects[i]));
+    for (size_t j = i + 1; j < objects.size(); j++)
+    {
+      std::string id1 = objects[i]->objid(), id2 = objects[j]->objid();
+      CPPUNIT_ASSERT(id1 != id2);
+      CPPUNIT_ASSERT_EQUAL(Sign(id1.compare(id2)),
+                           Sign(CDA_objcmp(objects[i], objects[j])));
+      CPPUNIT_ASSERT_EQUAL(Sign(id2.compare(id1)),
+                           Sign(CDA_objcmp(objects[j], objects[i])));
+    }
+  }
+
+  for (size_t i = 1; i < objects.size(); i++)
+    objects[i]->release_ref();
+}
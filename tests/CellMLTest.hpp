@@ -36,9 +36,13 @@ class CellMLTest : public CppUnit::TestFixture
   CPPUNIT_TEST(testExtensionElementList);
   CPPUNIT_TEST(testExtensionAttributeSet);
   CPPUNIT_TEST(testCellMLElementSet);
+  CPPUNIT_TEST(testNamedSetMutation);
   CPPUNIT_TEST(testIteratorLiveness);
   CPPUNIT_TEST(testRelativeImports);
   CPPUNIT_TEST(testImportClone);
+  CPPUNIT_TEST(testConcurrentImports);
+  CPPUNIT_TEST(testDocumentCache);
+  CPPUNIT_TEST(testObjectIDs);
   CPPUNIT_TEST_SUITE_END();
 public:
   void setUp();
@@ -77,9 +81,13 @@ public:
   void testExtensionElementList();
   void testExtensionAttributeSet();
   void testCellMLElementSet();
+  void testNamedSetMutation();
   void testIteratorLiveness();
   void testRelativeImports();
   void testImportClone();
+  void testConcurrentImports();
+  void testDocumentCache();
+  void testObjectIDs();
 private:
   iface::cellml_api::CellMLBootstrap* mBootstrap;
   iface::cellml_api::DOMModelLoader* mModelLoader;
@@ -3,6 +3,9 @@
 #include "Utilities.hxx"
 #include "IfaceCellML_APISPEC.hxx"
 #include "CellMLBootstrap.hpp"
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 #ifndef BASE_DIRECTORY
 #ifdef WIN32
@@ -267,6 +270,35 @@ DOMTest::testSerialiseChildElements()
                  L"/subelns\"><foo:bar/></foo:test><test2/></tests>");
 }
 
+static bool
+AppendToString(void* aClosure, const char* aData, size_t aLength)
+{
+  static_cast<std::string*>(aClosure)->append(aData, aLength);
+  return true;
+}
+
+void
+DOMTest::testSerialiseUTF8()
+{
+  iface::dom::Element* de = doc->documentElement();
+  iface::dom::Text* txt = NULL;
+  CPPUNIT_ASSERT_NO_THROW(txt = doc->createTextNode(L"caf\u00E9 & \u20AC"));
+  de->appendChild(txt)->release_ref();
+  txt->release_ref();
+
+  DOMWriter dw;
+  std::string str;
+  {
+    DOMWriterUTF8Output out(AppendToString, &str);
+    dw.writeNode(NULL, de, out);
+  }
+  de->release_ref();
+
+  CPPUNIT_ASSERT(str ==
+                 "<tests xmlns=\"http://www.physiome.org/testsuite/1\">"
+                 "caf\xC3\xA9 &amp; \xE2\x82\xAC</tests>");
+}
+
 void
 DOMTest::testSetAttributeNodeNS()
 {
@@ -388,3 +420,45 @@ DOMTest::testGetElementByTagName()
 
   d->release_ref();
 }
+
+void
+DOMTest::testLoadReleasesMemory()
+{
+#ifdef __GLIBC__
+  iface::cellml_api::CellMLBootstrap* cb = CreateCellMLBootstrap();
+  iface::cellml_api::DOMURLLoader* ul = cb->localURLLoader();
+  cb->release_ref();
+
+  // The first load sets up things which stay around, like libxml's state.
+  ul->loadDocument(BASE_DIRECTORY L"glycolysis_pathway_1997.xml")->
+    release_ref();
+
+  long heapBefore = mallinfo().uordblks;
+  iface::dom::Document* d =
+    ul->loadDocument(BASE_DIRECTORY L"glycolysis_pathway_1997.xml");
+  long loaded = mallinfo().uordblks - heapBefore;
+
+  // Keep one node from near the start of the document after the rest of it
+  // has gone. It should only keep its own share of the document alive.
+  iface::dom::Element* de = d->documentElement();
+  iface::dom::Node* n = de->firstChild();
+  de->removeChild(n)->release_ref();
+  de->release_ref();
+  d->release_ref();
+  long kept = mallinfo().uordblks - heapBefore;
+  CPPUNIT_ASSERT(kept < loaded / 4);
+
+  n->release_ref();
+  long left = mallinfo().uordblks - heapBefore;
+  CPPUNIT_ASSERT(left < loaded / 16);
+
+  // Loading again and again doesn't leave anything behind.
+  for (int i = 0; i < 5; i++)
+    ul->loadDocument(BASE_DIRECTORY L"glycolysis_pathway_1997.xml")->
+      release_ref();
+  long repeated = mallinfo().uordblks - heapBefore;
+  CPPUNIT_ASSERT(repeated < loaded / 16);
+
+  ul->release_ref();
+#endif
+}
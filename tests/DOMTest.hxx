@@ -22,9 +22,11 @@ class DOMTest : public CppUnit::TestFixture
   CPPUNIT_TEST(testSerialiseBasicDocument);
   CPPUNIT_TEST(testSerialiseAttributes);
   CPPUNIT_TEST(testSerialiseChildElements);
+  CPPUNIT_TEST(testSerialiseUTF8);
   CPPUNIT_TEST(testSetAttributeNodeNS);
   CPPUNIT_TEST(testLoadDocument);
   CPPUNIT_TEST(testGetElementByTagName);
+  CPPUNIT_TEST(testLoadReleasesMemory);
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -41,10 +43,13 @@ public:
   void testSerialiseBasicDocument();
   void testSerialiseAttributes();
   void testSerialiseChildElements();
+  void testSerialiseUTF8();
 
   void testLoadDocument();
 
   void testGetElementByTagName();
+
+  void testLoadReleasesMemory();
 private:
   iface::dom::DOMImplementation* di;
   iface::dom::DocumentType* dt;
@@ -227,3 +227,38 @@ L"xor: #prec[25(30)](#expr1 != 0) ^ (#expr2 != 0)\r\n"
   mt->release_ref();
   m->release_ref();
 }
+
+void
+MaLaESTest::testTransformCache()
+{
+  const wchar_t* usedSpec = L"opengroup: (\r\nclosegroup: )\r\n";
+  const wchar_t* unusedSpec = L"opengroup: [\r\nclosegroup: ]\r\n";
+
+  // The same specification gives the same transform...
+  RETURN_INTO_OBJREF(used, iface::cellml_services::MaLaESTransform,
+                     mMaLaESBootstrap->compileTransformer(usedSpec));
+  RETURN_INTO_OBJREF(usedAgain, iface::cellml_services::MaLaESTransform,
+                     mMaLaESBootstrap->compileTransformer(usedSpec));
+  CPPUNIT_ASSERT(used == usedAgain);
+  RETURN_INTO_OBJREF(unused, iface::cellml_services::MaLaESTransform,
+                     mMaLaESBootstrap->compileTransformer(unusedSpec));
+  CPPUNIT_ASSERT(used != unused);
+
+  // Compile more specifications than the cache holds. The one that keeps
+  // being asked for stays cached, and the one that isn't is dropped.
+  for (uint32_t i = 0; i < 100; i++)
+  {
+    wchar_t spec[64];
+    any_swprintf(spec, 64, L"opengroup: (%u\r\nclosegroup: )\r\n", i);
+    RETURN_INTO_OBJREF(other, iface::cellml_services::MaLaESTransform,
+                       mMaLaESBootstrap->compileTransformer(spec));
+    CPPUNIT_ASSERT(other != used);
+    RETURN_INTO_OBJREF(stillUsed, iface::cellml_services::MaLaESTransform,
+                       mMaLaESBootstrap->compileTransformer(usedSpec));
+    CPPUNIT_ASSERT(stillUsed == used);
+  }
+
+  RETURN_INTO_OBJREF(unusedAgain, iface::cellml_services::MaLaESTransform,
+                     mMaLaESBootstrap->compileTransformer(unusedSpec));
+  CPPUNIT_ASSERT(unusedAgain != unused);
+}
@@ -14,6 +14,7 @@ class MaLaESTest : public CppUnit::TestFixture
   CPPUNIT_TEST_SUITE(MaLaESTest);
   CPPUNIT_TEST(testMaLaESBootstrap);
   CPPUNIT_TEST(testMaLaESObject);
+  CPPUNIT_TEST(testTransformCache);
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -22,6 +23,7 @@ public:
 
   void testMaLaESBootstrap();
   void testMaLaESObject();
+  void testTransformCache();
 
 private:
   iface::cellml_services::MaLaESBootstrap* mMaLaESBootstrap;
@@ -1014,6 +1014,108 @@ RDFTest::testRDFAPIImplementation()
   CPPUNIT_ASSERT_EQUAL(0, CDA_objcmp(dcp2o, dcpo));
 }
 
+static int
+countTriples(iface::rdf_api::TripleSet* aSet)
+{
+  RETURN_INTO_OBJREF(te, iface::rdf_api::TripleEnumerator,
+                     aSet->enumerateTriples());
+  int count = 0;
+  while (true)
+  {
+    RETURN_INTO_OBJREF(t, iface::rdf_api::Triple, te->getNextTriple());
+    if (t == NULL)
+      return count;
+    count++;
+  }
+}
+
+void
+RDFTest::testTripleIndexes()
+{
+  RETURN_INTO_OBJREF(bs, iface::rdf_api::Bootstrap, CreateRDFBootstrap());
+  RETURN_INTO_OBJREF(ds, iface::rdf_api::DataSource, bs->createDataSource());
+
+  RETURN_INTO_OBJREF(s1, iface::rdf_api::URIReference,
+                     ds->getURIReference(L"http://example.org/s1"));
+  RETURN_INTO_OBJREF(s2, iface::rdf_api::URIReference,
+                     ds->getURIReference(L"http://example.org/s2"));
+  RETURN_INTO_OBJREF(s3, iface::rdf_api::URIReference,
+                     ds->getURIReference(L"http://example.org/s3"));
+  RETURN_INTO_OBJREF(p1, iface::rdf_api::URIReference,
+                     ds->getURIReference(L"http://example.org/p1"));
+  RETURN_INTO_OBJREF(p2, iface::rdf_api::URIReference,
+                     ds->getURIReference(L"http://example.org/p2"));
+  RETURN_INTO_OBJREF(o1, iface::rdf_api::URIReference,
+                     ds->getURIReference(L"http://example.org/o1"));
+  RETURN_INTO_OBJREF(o2, iface::rdf_api::PlainLiteral,
+                     ds->getPlainLiteral(L"o2", L"en"));
+
+  s1->createTripleOutOf(p1, o1);
+  s1->createTripleOutOf(p2, o2);
+  s2->createTripleOutOf(p1, o2);
+  s3->createTripleOutOf(p1, o1);
+  s3->createTripleOutOf(p2, o1);
+  // Asserting a triple again changes nothing.
+  s3->createTripleOutOf(p2, o1);
+
+  RETURN_INTO_OBJREF(all, iface::rdf_api::TripleSet, ds->getAllTriples());
+  CPPUNIT_ASSERT_EQUAL(5, countTriples(all));
+
+  // Every combination of bound subject, predicate and object has to come out
+  // of one of the indexes with just the matching triples.
+  RETURN_INTO_OBJREF(ts1, iface::rdf_api::TripleSet,
+                     s1->getTriplesWhereSubject());
+  CPPUNIT_ASSERT_EQUAL(2, countTriples(ts1));
+  RETURN_INTO_OBJREF(tp1, iface::rdf_api::TripleSet,
+                     p1->getTriplesWherePredicate());
+  CPPUNIT_ASSERT_EQUAL(3, countTriples(tp1));
+  RETURN_INTO_OBJREF(to1, iface::rdf_api::TripleSet, o1->getTriplesInto());
+  CPPUNIT_ASSERT_EQUAL(3, countTriples(to1));
+  RETURN_INTO_OBJREF(to2, iface::rdf_api::TripleSet, o2->getTriplesInto());
+  CPPUNIT_ASSERT_EQUAL(2, countTriples(to2));
+  RETURN_INTO_OBJREF(tp1o1, iface::rdf_api::TripleSet,
+                     o1->getTriplesIntoByPredicate(p1));
+  CPPUNIT_ASSERT_EQUAL(2, countTriples(tp1o1));
+  RETURN_INTO_OBJREF(ts3p2, iface::rdf_api::TripleSet,
+                     s3->getTriplesOutOfByPredicate(p2));
+  CPPUNIT_ASSERT_EQUAL(1, countTriples(ts3p2));
+  RETURN_INTO_OBJREF(ts3o1, iface::rdf_api::TripleSet,
+                     s3->getTriplesOutOfByObject(o1));
+  CPPUNIT_ASSERT_EQUAL(2, countTriples(ts3o1));
+  RETURN_INTO_OBJREF(ts2o1, iface::rdf_api::TripleSet,
+                     s2->getTriplesOutOfByObject(o1));
+  CPPUNIT_ASSERT_EQUAL(0, countTriples(ts2o1));
+  CPPUNIT_ASSERT(s2->hasTripleOutOf(p1, o2));
+  CPPUNIT_ASSERT(!s2->hasTripleOutOf(p2, o2));
+
+  RETURN_INTO_OBJREF(t, iface::rdf_api::Triple,
+                     s3->getTripleOutOfByPredicateAndObject(p2, o1));
+  CPPUNIT_ASSERT(t != NULL);
+  RETURN_INTO_OBJREF(ts, iface::rdf_api::Resource, t->subject());
+  CPPUNIT_ASSERT_EQUAL(0, CDA_objcmp(ts, s3));
+
+  // Unasserting the triple an enumerator is on mustn't stop it seeing the
+  // rest of the range, and the sets are live.
+  RETURN_INTO_OBJREF(te, iface::rdf_api::TripleEnumerator,
+                     tp1->enumerateTriples());
+  RETURN_INTO_OBJREF(first, iface::rdf_api::Triple, te->getNextTriple());
+  CPPUNIT_ASSERT(first != NULL);
+  first->unassert();
+  int rest = 0;
+  while (true)
+  {
+    RETURN_INTO_OBJREF(next, iface::rdf_api::Triple, te->getNextTriple());
+    if (next == NULL)
+      break;
+    RETURN_INTO_OBJREF(np, iface::rdf_api::Resource, next->predicate());
+    CPPUNIT_ASSERT_EQUAL(0, CDA_objcmp(np, p1));
+    rest++;
+  }
+  CPPUNIT_ASSERT_EQUAL(2, rest);
+  CPPUNIT_ASSERT_EQUAL(2, countTriples(tp1));
+  CPPUNIT_ASSERT_EQUAL(4, countTriples(all));
+}
+
 void
 RDFTest::assertContainerContents
 (
@@ -11,6 +11,7 @@ class RDFTest : public CppUnit::TestFixture
   CPPUNIT_TEST(testW3CSuite);
   CPPUNIT_TEST(testContainerLibrary);
   CPPUNIT_TEST(testRDFAPIImplementation);
+  CPPUNIT_TEST(testTripleIndexes);
   CPPUNIT_TEST_SUITE_END();
 
   void assertContainerContents(iface::rdf_api::Container*, const wchar_t** aExpect);
@@ -21,6 +22,7 @@ public:
   void testRDFAPIImplementation();
   void testW3CSuite();
   void testContainerLibrary();
+  void testTripleIndexes();
 };
 
 #endif // RDFTEST_H
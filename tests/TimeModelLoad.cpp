@@ -7,6 +7,25 @@
 #include <sys/time.h>
 #endif
 #include <stdio.h>
+#include <vector>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+static int64_t
+timeInMicros()
+{
+#ifdef WIN32
+  FILETIME ft;
+  GetSystemTimeAsFileTime(&ft);
+  return (static_cast<int64_t>(ft.dwHighDateTime) * 0x100000000 +
+          ft.dwLowDateTime) / 10;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+#endif
+}
 
 void usage()
 {
@@ -37,32 +56,28 @@ int main(int argc, char**argv)
   buf[1023] = 0;
   std::wstring wmodelURL(buf);
 
-#ifdef WIN32
-  FILETIME ft1, ft2;
+  std::vector<iface::cellml_api::Model*> models;
+  models.reserve(numRepeats);
 
-  GetSystemTimeAsFileTime(&ft1);
-#else
-  struct timeval tv1, tv2;
-
-  gettimeofday(&tv1, NULL);
+#ifdef __GLIBC__
+  size_t heapBefore = mallinfo().uordblks;
 #endif
-
+  int64_t t1 = timeInMicros();
   for (int i = 0; i < numRepeats; i++)
-    modelLoader->loadFromURL(wmodelURL)->release_ref();
-
-#ifdef WIN32
-  GetSystemTimeAsFileTime(&ft2);
+    models.push_back(modelLoader->loadFromURL(wmodelURL));
+  int64_t t2 = timeInMicros();
+#ifdef __GLIBC__
+  size_t heapAfter = mallinfo().uordblks;
+#endif
+  for (int i = 0; i < numRepeats; i++)
+    models[i]->release_ref();
+  int64_t t3 = timeInMicros();
 
-  printf("Total time = %d micros\n",
-         (static_cast<int64_t>(ft2.dwHighDateTime -
-                               ft1.dwHighDateTime) *
-          0x100000000 +
-          static_cast<int64_t>(ft2.dwLowDateTime -
-                               ft1.dwLowDateTime)) / 10
-         );
-#else
-  gettimeofday(&tv2, NULL);
-  printf("Total time = %d micros\n",
-         (tv2.tv_sec - tv1.tv_sec) * 1000000 + tv2.tv_usec - tv1.tv_usec);
-#endif  
+  printf("Total time = %d micros\n", static_cast<int>(t3 - t1));
+  printf("Load time = %d micros\n", static_cast<int>(t2 - t1));
+  printf("Release time = %d micros\n", static_cast<int>(t3 - t2));
+#ifdef __GLIBC__
+  printf("Heap per model = %d bytes\n",
+         static_cast<int>((heapAfter - heapBefore) / numRepeats));
+#endif
 }
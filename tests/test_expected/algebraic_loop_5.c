@@ -0,0 +1,113 @@
+/* Model is correctly constrained.
+ * The following equations needed Newton-Raphson evaluation:
+ *   <equation with no cmeta ID>
+ *   in <math with no cmeta ID>
+ *   <equation with no cmeta ID>
+ *   in <math with no cmeta ID>
+ *   <equation with no cmeta ID>
+ *   in <math with no cmeta ID>
+ *   <equation with no cmeta ID>
+ *   in <math with no cmeta ID>
+ *   <equation with no cmeta ID>
+ *   in <math with no cmeta ID>
+ * The rate and state arrays need 1 entries.
+ * The algebraic variables array needs 6 entries.
+ * The constant array needs 0 entries.
+ * Variable storage is as follows:
+ * * Target a in component main
+ * * * Variable type: state variable
+ * * * Variable index: 0
+ * * * Variable storage: STATES[0]
+ * * Target b in component main
+ * * * Variable type: algebraic variable
+ * * * Variable index: 0
+ * * * Variable storage: ALGEBRAIC[0]
+ * * Target d^1/dt^1 a in component main
+ * * * Variable type: algebraic variable
+ * * * Variable index: 0
+ * * * Variable storage: RATES[0]
+ * * Target t in component main
+ * * * Variable type: variable of integration
+ * * * Variable index: 0
+ * * * Variable storage: VOI
+ * * Target x1 in component main
+ * * * Variable type: algebraic variable
+ * * * Variable index: 1
+ * * * Variable storage: ALGEBRAIC[1]
+ * * Target x2 in component main
+ * * * Variable type: algebraic variable
+ * * * Variable index: 2
+ * * * Variable storage: ALGEBRAIC[2]
+ * * Target x3 in component main
+ * * * Variable type: algebraic variable
+ * * * Variable index: 3
+ * * * Variable storage: ALGEBRAIC[3]
+ * * Target x4 in component main
+ * * * Variable type: algebraic variable
+ * * * Variable index: 4
+ * * * Variable storage: ALGEBRAIC[4]
+ * * Target x5 in component main
+ * * * Variable type: algebraic variable
+ * * * Variable index: 5
+ * * * Variable storage: ALGEBRAIC[5]
+ */
+void objfunc_0(double* p, double* hx, void *adata)
+{
+  struct rootfind_info* rfi = (struct rootfind_info*)adata;
+#define VOI rfi->aVOI
+#define CONSTANTS rfi->aCONSTANTS
+#define RATES rfi->aRATES
+#define STATES rfi->aSTATES
+#define ALGEBRAIC rfi->aALGEBRAIC
+#define pret rfi->aPRET
+  ALGEBRAIC[1] = p[0];
+  ALGEBRAIC[2] = p[1];
+  ALGEBRAIC[3] = p[2];
+  ALGEBRAIC[4] = p[3];
+  ALGEBRAIC[5] = p[4];
+  hx[0] = (ALGEBRAIC[1]+ALGEBRAIC[2]) - ALGEBRAIC[0];
+  hx[1] = (ALGEBRAIC[2] - ALGEBRAIC[3]) - 1.00000;
+  hx[2] = (ALGEBRAIC[3]+ALGEBRAIC[4]) - 2.00000;
+  hx[3] = (ALGEBRAIC[4] - ALGEBRAIC[5]) - 0.00000;
+  hx[4] = (ALGEBRAIC[5] -  2.00000*ALGEBRAIC[1]) - 0.00000;
+#undef VOI
+#undef CONSTANTS
+#undef RATES
+#undef STATES
+#undef ALGEBRAIC
+#undef pret
+}
+void rootfind_0(double VOI, double* CONSTANTS, double* RATES, double* STATES, double* ALGEBRAIC, int* pret)
+{
+  /* Solver for equations: Element with no id, Element with no id, Element with no id, Element with no id, Element with no id */
+  static double p[5] = {0.1,0.1,0.1,0.1,0.1};
+  struct rootfind_info rfi;
+  rfi.aVOI = VOI;
+  rfi.aCONSTANTS = CONSTANTS;
+  rfi.aRATES = RATES;
+  rfi.aSTATES = STATES;
+  rfi.aALGEBRAIC = ALGEBRAIC;
+  rfi.aPRET = pret;
+  do_nonlinearsolve(objfunc_0, p, pret, 5, &rfi);
+  ALGEBRAIC[1] = p[0];
+  ALGEBRAIC[2] = p[1];
+  ALGEBRAIC[3] = p[2];
+  ALGEBRAIC[4] = p[3];
+  ALGEBRAIC[5] = p[4];
+}
+void SetupFixedConstants(double* CONSTANTS, double* RATES, double* STATES)
+{
+/* Constant a */
+STATES[0] = 1;
+}
+void EvaluateVariables(double VOI, double* CONSTANTS, double* RATES, double* STATES, double* ALGEBRAIC)
+{
+}
+void ComputeRates(double VOI, double* STATES, double* RATES, double* CONSTANTS, double* ALGEBRAIC)
+{
+/* Element with no id */
+ALGEBRAIC[0] =  2.00000*STATES[0];
+rootfind_0(VOI, CONSTANTS, RATES, STATES, ALGEBRAIC, pret);
+/* Element with no id */
+RATES[0] = (ALGEBRAIC[5] - 6.00000)/10.0000;
+}